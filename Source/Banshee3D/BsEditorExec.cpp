@@ -20,13 +20,20 @@ int CALLBACK WinMain(
 {
 	CrashHandler::startUp();
 
+	int exitCode = 0;
 	__try
 	{
 		SPtr<EditorScriptLibrary> library = bs_shared_ptr_new<EditorScriptLibrary>();
 		ScriptManager::_setScriptLibrary(library);
 
-		EditorApplication::startUp();
-		EditorApplication::instance().runMainLoop();
+		EditorLaunchOptions options = EditorLaunchOptions::parse(__argc, __argv);
+		EditorApplication::startUp(options);
+
+		if (options.headless)
+			exitCode = gEditorApplication().runHeadless();
+		else
+			EditorApplication::instance().runMainLoop();
+
 		EditorApplication::shutDown();
 	}
 	__except (gCrashHandler().reportCrash(GetExceptionInformation()))
@@ -36,18 +43,26 @@ int CALLBACK WinMain(
 
 	CrashHandler::shutDown();
 
-	return 0;
+	return exitCode;
 }
 #else
 using namespace bs;
 
-int main()
+int main(int argc, char* argv[])
 {
 	SPtr<EditorScriptLibrary> library = bs_shared_ptr_new<EditorScriptLibrary>();
 	ScriptManager::_setScriptLibrary(library);
 
-	EditorApplication::startUp();
-	EditorApplication::instance().runMainLoop();
+	EditorLaunchOptions options = EditorLaunchOptions::parse(argc, argv);
+	EditorApplication::startUp(options);
+
+	int exitCode = 0;
+	if (options.headless)
+		exitCode = gEditorApplication().runHeadless();
+	else
+		EditorApplication::instance().runMainLoop();
+
 	EditorApplication::shutDown();
+	return exitCode;
 }
 #endif // End BS_PLATFORM
\ No newline at end of file
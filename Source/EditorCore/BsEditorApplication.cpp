@@ -12,6 +12,7 @@
 #include "EditorWindow/BsEditorWidgetLayout.h"
 #include "Scene/BsScenePicking.h"
 #include "Scene/BsSelection.h"
+#include "Scene/BsPrefabInstanceIndex.h"
 #include "Scene/BsGizmoManager.h"
 #include "CodeEditor/BsCodeEditor.h"
 #include "Build/BsBuildManager.h"
@@ -19,33 +20,55 @@
 #include "Library/BsEditorShaderIncludeHandler.h"
 #include "EditorWindow/BsDropDownWindowManager.h"
 #include "Library/BsProjectLibrary.h"
+#include "Library/BsImportWorkerPool.h"
 #include "Settings/BsProjectSettings.h"
 #include "Settings/BsEditorSettings.h"
 #include "Script/BsScriptManager.h"
 #include "Importer/BsImporter.h"
 #include "Input/BsVirtualInput.h"
+#include "Input/BsInput.h"
+#include "Debug/BsDebug.h"
+#include "Utility/BsTime.h"
 #include "Resources/BsResources.h"
 #include "Scene/BsSceneManager.h"
 #include "Utility/BsSplashScreen.h"
+#include "Utility/BsEditorProfiler.h"
+#include "Utility/BsEditorRenderPacket.h"
 #include "Utility/BsDynLib.h"
 #include "Scene/BsSceneManager.h"
 #include "BsEngineConfig.h"
+#include <iostream>
 
 namespace bs
 {
 	constexpr UINT32 SPLASH_SCREEN_DURATION_MS = 1000;
 
+	/** Time after last activity (input, log output, explicit invalidate) before the editor drops to the idle frame rate. */
+	constexpr UINT32 IDLE_DELAY_MS = 500;
+
 	const Path EditorApplication::WIDGET_LAYOUT_PATH = PROJECT_INTERNAL_DIR + "Layout.asset";
 	const Path EditorApplication::BUILD_DATA_PATH = PROJECT_INTERNAL_DIR + "BuildData.asset";
 	const Path EditorApplication::PROJECT_SETTINGS_PATH = PROJECT_INTERNAL_DIR + "Settings.asset";
 
-	START_UP_DESC createStartupDesc()
+	START_UP_DESC createStartupDesc(bool headless)
 	{
 		START_UP_DESC startUpDesc;
-		startUpDesc.renderAPI = BS_RENDER_API_MODULE;
-		startUpDesc.renderer = BS_RENDERER_MODULE;
-		startUpDesc.audio = BS_AUDIO_MODULE;
-		startUpDesc.physics = BS_PHYSICS_MODULE;
+		if (headless)
+		{
+			// No display is available, or required, when running headless
+			startUpDesc.renderAPI = "bsfNullRenderAPI";
+			startUpDesc.renderer = "bsfNullRenderer";
+			startUpDesc.audio = "bsfNullAudio";
+			startUpDesc.physics = "bsfNullPhysics";
+		}
+		else
+		{
+			startUpDesc.renderAPI = BS_RENDER_API_MODULE;
+			startUpDesc.renderer = BS_RENDERER_MODULE;
+			startUpDesc.audio = BS_AUDIO_MODULE;
+			startUpDesc.physics = BS_PHYSICS_MODULE;
+		}
+
 		startUpDesc.physicsCooking = true;
 
 		startUpDesc.primaryWindowDesc.videoMode = VideoMode(1920, 1080);
@@ -70,8 +93,77 @@ namespace bs
 		return Paths::getEditorDataPath() + "Settings.asset";
 	}
 
-	EditorApplication::EditorApplication()
-		:Application(createStartupDesc()), mIsProjectLoaded(false)
+	/** Prints a single machine-readable line describing the outcome of a headless step. */
+	static void reportHeadlessStep(const char* step, bool success, UINT64 timeMs)
+	{
+		std::cout << "{\"step\":\"" << step << "\",\"status\":\"" << (success ? "ok" : "failed") << "\",\"ms\":" 
+			<< timeMs << "}" << std::endl;
+	}
+
+	/** Returns the number of error messages in the log. */
+	static UINT32 getNumLoggedErrors()
+	{
+		UINT32 numErrors = 0;
+
+		Vector<LogEntry> entries = gDebug().getLog().getAllEntries();
+		for (auto& entry : entries)
+		{
+			if (entry.getVerbosity() == LogVerbosity::Error)
+				numErrors++;
+		}
+
+		return numErrors;
+	}
+
+	EditorLaunchOptions EditorLaunchOptions::parse(int argc, char* argv[])
+	{
+		EditorLaunchOptions options;
+		if (argc > 0)
+		{
+			String executable = argv[0];
+			options.executablePath = Path(executable);
+
+			// The executable is re-launched to spawn import workers, possibly after the working directory changed. Names
+			// without a directory are left alone, as those are looked up in PATH.
+			bool hasDirectory = executable.find_first_of("/\\") != String::npos;
+			if (hasDirectory && !options.executablePath.isAbsolute())
+				options.executablePath.makeAbsolute(FileSystem::getWorkingDirectoryPath());
+		}
+
+		for (int i = 1; i < argc; i++)
+		{
+			String arg = argv[i];
+
+			if (arg == "--project" && (i + 1) < argc)
+			{
+				options.projectPath = Path(argv[++i]);
+				options.headless = true;
+			}
+			else if (arg == "--import")
+			{
+				options.import = true;
+				options.headless = true;
+			}
+			else if (arg == "--build" && (i + 1) < argc)
+			{
+				options.build = true;
+				options.buildPlatform = argv[++i];
+				options.headless = true;
+			}
+			else if (arg == "--quit")
+				options.headless = true;
+			else if (arg == "--import-worker")
+			{
+				options.importWorker = true;
+				options.headless = true;
+			}
+		}
+
+		return options;
+	}
+
+	EditorApplication::EditorApplication(const EditorLaunchOptions& options)
+		:Application(createStartupDesc(options.headless)), mLaunchOptions(options), mIsProjectLoaded(false)
 	{
 
 	}
@@ -79,13 +171,18 @@ namespace bs
 	EditorApplication::~EditorApplication()
 	{
 		ProjectLibrary::shutDown();
-		BuiltinEditorResources::shutDown();
+
+		if (BuiltinEditorResources::isStarted())
+			BuiltinEditorResources::shutDown();
 	}
 
 	void EditorApplication::onStartUp()
 	{
 		Application::onStartUp();
 
+		EditorProfiler::startUp();
+		EditorRenderPacket::startUp();
+
 		// In editor we render game on a separate surface, handled in Game window
 		SceneManager::instance().setMainRenderTarget(nullptr);
 
@@ -98,6 +195,14 @@ namespace bs
 		// Hidden dependency: Needs to be done before BuiltinEditorResources import as shader include lookup requires it
 		ProjectLibrary::startUp();
 
+		// Headless mode only needs what's required for importing and packaging resources
+		if (isHeadless())
+		{
+			UndoRedo::startUp();
+			BuildManager::startUp();
+			return;
+		}
+
 		BuiltinEditorResources::startUp();
 
 		{
@@ -113,23 +218,63 @@ namespace bs
 		EditorWidgetManager::startUp();
 		DropDownWindowManager::startUp();
 
+		// Picking materials are created on first pick, so they don't delay the first frame
 		ScenePicking::startUp();
 		Selection::startUp();
+		PrefabInstanceIndex::startUp();
 		GizmoManager::startUp();
 		BuildManager::startUp();
 		CodeEditorManager::startUp();
+		ImportWorkerPool::startUp(mLaunchOptions.executablePath);
 
 		MainEditorWindow::create(getPrimaryWindow());
 		ScriptManager::startUp();
+
+		BuiltinEditorResources::instance().logLoadTimings();
+
+		// Any input or log output wakes the editor up from idle throttling
+		Input& input = gInput();
+		mActivityConns.push_back(input.onButtonDown.connect([this](const ButtonEvent&) { invalidate(); }));
+		mActivityConns.push_back(input.onButtonUp.connect([this](const ButtonEvent&) { invalidate(); }));
+		mActivityConns.push_back(input.onCharInput.connect([this](const TextInputEvent&) { invalidate(); }));
+		mActivityConns.push_back(input.onPointerMoved.connect([this](const PointerEvent&) { invalidate(); }));
+		mActivityConns.push_back(input.onPointerPressed.connect([this](const PointerEvent&) { invalidate(); }));
+		mActivityConns.push_back(input.onPointerReleased.connect([this](const PointerEvent&) { invalidate(); }));
+		mActivityConns.push_back(input.onPointerDoubleClick.connect([this](const PointerEvent&) { invalidate(); }));
+		mActivityConns.push_back(input.onInputCommand.connect([this](InputCommandType) { invalidate(); }));
+		mActivityConns.push_back(gDebug().onLogModified.connect([this]() { invalidate(); }));
 	}
 
 	void EditorApplication::onShutDown()
 	{
+		for (auto& conn : mActivityConns)
+			conn.disconnect();
+
+		mActivityConns.clear();
+
 		unloadProject();
 
+		if (isHeadless())
+		{
+			BuildManager::shutDown();
+
+			// Workers run alongside a regular editor instance which owns the settings
+			if (!mLaunchOptions.importWorker)
+				saveEditorSettings();
+
+			UndoRedo::shutDown();
+			EditorRenderPacket::shutDown();
+			EditorProfiler::shutDown();
+
+			Application::onShutDown();
+			return;
+		}
+
+		ImportWorkerPool::shutDown();
 		CodeEditorManager::shutDown();
 		BuildManager::shutDown();
 		GizmoManager::shutDown();
+		PrefabInstanceIndex::shutDown();
 		Selection::shutDown();
 		ScenePicking::shutDown();
 
@@ -139,17 +284,22 @@ namespace bs
 		EditorWidgetManager::shutDown();
 		EditorWindowManager::shutDown();
 		UndoRedo::shutDown();
+		EditorRenderPacket::shutDown();
+		EditorProfiler::shutDown();
 
 		Application::onShutDown();
 	}
 
-	void EditorApplication::startUp()
+	void EditorApplication::startUp(const EditorLaunchOptions& options)
 	{
-		CoreApplication::startUp<EditorApplication>();
+		CoreApplication::startUp<EditorApplication>(options);
 	}
 
 	void EditorApplication::startUpRenderer()
 	{
+		if (isHeadless())
+			return;
+
 		mSplashScreenTimer.reset();
 		SplashScreen::show();
 	}
@@ -168,6 +318,8 @@ namespace bs
 
 	void EditorApplication::preUpdate()
 	{
+		EditorProfiler::instance().beginFrame();
+
 		Application::preUpdate();
 
 		EditorWidgetManager::instance().update();
@@ -176,14 +328,23 @@ namespace bs
 
 	void EditorApplication::postUpdate()
 	{
-		ScriptManager::instance().update();
+		{
+			BS_ED_PROFILE_SCOPE("ScriptManager::update");
+			ScriptManager::instance().update();
+		}
 
 		// Call update on editor widgets before parent's postUpdate because the parent will render the GUI and we need
 		// to ensure editor widget's GUI is updated.
-		EditorWindowManager::instance().update();
+		{
+			BS_ED_PROFILE_SCOPE("EditorWindowManager::update");
+			EditorWindowManager::instance().update();
+		}
 
 		Application::postUpdate();
 
+		// All editor systems have been updated for this frame, send their render data before the frame is rendered
+		EditorRenderPacket::instance().submit();
+
 		if(mSplashScreenShown)
 		{
 			UINT64 currentTime = mSplashScreenTimer.getMilliseconds();
@@ -195,7 +356,60 @@ namespace bs
 			}
 		}
 
-		setFPSLimit(mEditorSettings->getFPSLimit());
+		updateFrameRate();
+	}
+
+	void EditorApplication::invalidate()
+	{
+		mIdleTimer.reset();
+	}
+
+	void EditorApplication::updateFrameRate()
+	{
+		const UINT32 fpsLimit = mEditorSettings->getFPSLimit();
+		const UINT32 idleFPSLimit = mEditorSettings->getIdleFPSLimit();
+
+		// Imports and saves report their progress in the status bar, keep it animating while they run
+		ProjectLibrary& projectLibrary = gProjectLibrary();
+		if (projectLibrary.getInProgressImportCount() > 0 || projectLibrary.getInProgressSaveCount() > 0)
+			invalidate();
+
+		bool idle = false;
+		if (idleFPSLimit > 0 && !mContinuousUpdate && !mSplashScreenShown)
+		{
+			if (!EditorWindowManager::instance().hasFocus())
+				idle = true;
+			else
+				idle = mIdleTimer.getMilliseconds() >= IDLE_DELAY_MS;
+		}
+
+		// Never throttle above the regular limit
+		if (idle && fpsLimit > 0 && idleFPSLimit >= fpsLimit)
+			idle = false;
+
+		if (idle)
+		{
+			setFPSLimit(idleFPSLimit);
+
+			if (mIsIdle && fpsLimit > 0)
+			{
+				// Count how many frames would have executed at the regular rate during the last (throttled) frame
+				mSkippedFrameFraction += gTime().getFrameDelta() * fpsLimit - 1.0f;
+				if (mSkippedFrameFraction >= 1.0f)
+				{
+					const UINT32 numSkipped = (UINT32)mSkippedFrameFraction;
+					mNumSkippedFrames += numSkipped;
+					mSkippedFrameFraction -= (float)numSkipped;
+				}
+			}
+		}
+		else
+		{
+			setFPSLimit(fpsLimit);
+			mSkippedFrameFraction = 0.0f;
+		}
+
+		mIsIdle = idle;
 	}
 
 	void EditorApplication::quitRequested()
@@ -212,7 +426,10 @@ namespace bs
 		buildDataPath.append(BUILD_DATA_PATH);
 
 		BuildManager::instance().save(buildDataPath);
-		saveWidgetLayout(EditorWidgetManager::instance().getLayout());
+
+		if (!isHeadless())
+			saveWidgetLayout(EditorWidgetManager::instance().getLayout());
+
 		saveEditorSettings();
 		saveProjectSettings();
 
@@ -230,7 +447,9 @@ namespace bs
 		BuildManager::instance().clear();
 		UndoRedo::instance().clear();
 
-		EditorWidgetManager::instance().closeAll();
+		if (!isHeadless())
+			EditorWidgetManager::instance().closeAll();
+
 		gProjectLibrary().unloadLibrary();
 		Resources::instance().unloadAllUnused();
 		gSceneManager().clearScene();
@@ -256,6 +475,9 @@ namespace bs
 		BuildManager::instance().load(buildDataPath);
 		gProjectLibrary().loadLibrary();
 
+		if (isHeadless())
+			return;
+
 		// Do this before restoring windows to ensure types are loaded
 		ScriptManager::instance().reload();
 		
@@ -264,6 +486,112 @@ namespace bs
 			EditorWidgetManager::instance().setLayout(layout);
 	}
 
+	int EditorApplication::runHeadless()
+	{
+		if (!isHeadless())
+			return 0;
+
+		if (mLaunchOptions.importWorker)
+			return ImportWorkerPool::runWorker();
+
+		Timer totalTimer;
+		Timer stepTimer;
+
+		// Load
+		if (!isValidProjectPath(mLaunchOptions.projectPath))
+		{
+			BS_LOG(Error, Editor, "Headless mode requires a valid absolute project path (--project <path>). "
+				"Provided: \"{0}\"", mLaunchOptions.projectPath);
+
+			reportHeadlessStep("load", false, stepTimer.getMilliseconds());
+			return 1;
+		}
+
+		loadProject(mLaunchOptions.projectPath);
+		reportHeadlessStep("load", true, stepTimer.getMilliseconds());
+
+		int exitCode = 0;
+
+		// Import
+		if (mLaunchOptions.import)
+		{
+			stepTimer.reset();
+			UINT32 numErrorsBefore = getNumLoggedErrors();
+
+			ProjectLibrary& projectLibrary = gProjectLibrary();
+			UINT32 numQueued = projectLibrary.checkForModifications(projectLibrary.getResourcesFolder());
+			projectLibrary._finishQueuedImports(true);
+
+			BS_LOG(Info, Editor, "Headless import finished, {0} resources imported.", numQueued);
+
+			bool success = getNumLoggedErrors() == numErrorsBefore;
+			reportHeadlessStep("import", success, stepTimer.getMilliseconds());
+
+			if (!success)
+				exitCode = 2;
+		}
+
+		// Build
+		if (mLaunchOptions.build && exitCode == 0)
+		{
+			stepTimer.reset();
+
+			BuildManager& buildManager = BuildManager::instance();
+
+			String platformName = mLaunchOptions.buildPlatform;
+			StringUtil::toLowerCase(platformName);
+
+			PlatformType platform = PlatformType::Count;
+			if (platformName == "windows")
+				platform = PlatformType::Windows;
+
+			SPtr<PlatformInfo> platformInfo;
+			const Vector<PlatformType>& availablePlatforms = buildManager.getAvailablePlatforms();
+			if (std::find(availablePlatforms.begin(), availablePlatforms.end(), platform) != availablePlatforms.end())
+				platformInfo = buildManager.getPlatformInfo(platform);
+
+			if (platformInfo == nullptr)
+			{
+				BS_LOG(Error, Editor, "Cannot build for unsupported platform: \"{0}\"", mLaunchOptions.buildPlatform);
+				exitCode = 3;
+			}
+			else
+			{
+				UINT32 numErrorsBefore = getNumLoggedErrors();
+
+				// Compiling the game assembly and copying the runtime requires the managed build, so only resources and
+				// startup settings are written here. Outputs of an earlier full build are kept rather than pruned as stale.
+				Path destinationRoot = buildManager.getBuildFolder(BuildFolder::DestinationRoot, platformInfo->type);
+				buildManager.beginBuild(destinationRoot);
+				buildManager.packageResources(destinationRoot, platformInfo);
+				buildManager.createStartupSettings(destinationRoot, platformInfo);
+				buildManager.endBuild(false);
+
+				Path executablePath = destinationRoot;
+				executablePath.append(buildManager.getMainExecutable(platformInfo->type).getFilename());
+
+				if (getNumLoggedErrors() != numErrorsBefore)
+					exitCode = 3;
+				else if (!FileSystem::isFile(executablePath))
+				{
+					BS_LOG(Warning, Editor, "Headless build only updates resources and startup settings, and the output "
+						"folder doesn't contain a full build. Build from the editor once to produce a runnable build.");
+					exitCode = 4;
+				}
+			}
+
+			reportHeadlessStep("build", exitCode == 0, stepTimer.getMilliseconds());
+		}
+
+		// Save
+		stepTimer.reset();
+		unloadProject();
+		reportHeadlessStep("save", true, stepTimer.getMilliseconds());
+
+		reportHeadlessStep("total", exitCode == 0, totalTimer.getMilliseconds());
+		return exitCode;
+	}
+
 	void EditorApplication::createProject(const Path& path)
 	{
 		Path resourceDir = Path::combine(path, ProjectLibrary::RESOURCES_DIR);
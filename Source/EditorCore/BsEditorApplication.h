@@ -12,15 +12,70 @@ namespace bs
 	 *  @{
 	 */
 
+	/** Options that control how the editor is started. Normally parsed from the command line. */
+	struct BS_ED_EXPORT EditorLaunchOptions
+	{
+		/** 
+		 * If true the editor is started without any windows and with null render, audio and physics backends. It performs
+		 * the requested operations (import, build) on the provided project and then exits. Enabled by --quit, and implied
+		 * by any of the batch options (--project, --import, --build), as the GUI editor doesn't perform them.
+		 */
+		bool headless = false;
+
+		/** Absolute path to the project to load. Provided by --project <path>. Implies headless. */
+		Path projectPath;
+
+		/** Imports any new or modified resources in the project. Enabled by --import. Implies headless. */
+		bool import = false;
+
+		/**
+		 * Packages the project resources and startup settings into the build folder. Game binaries and assemblies already
+		 * in the folder are kept. Enabled by --build <platform>. Implies headless.
+		 */
+		bool build = false;
+
+		/** Name of the platform to build for. */
+		String buildPlatform;
+
+		/**
+		 * If true the editor runs as an import worker for another editor instance, performing imports requested through
+		 * its standard input. Enabled by --import-worker. Implies headless. See ImportWorkerPool.
+		 */
+		bool importWorker = false;
+
+		/**
+		 * Path to the editor executable, as provided by the first command line argument. Relative paths are made absolute
+		 * against the working directory at startup.
+		 */
+		Path executablePath;
+
+		/** Parses launch options from a list of command line arguments. Unrecognized arguments are ignored. */
+		static EditorLaunchOptions parse(int argc, char* argv[]);
+	};
+
 	/**	Primary editor class containing the editor entry point. */
 	class BS_ED_EXPORT EditorApplication : public Application
 	{
 	public:
-		EditorApplication();
+		EditorApplication(const EditorLaunchOptions& options = EditorLaunchOptions());
 		virtual ~EditorApplication();
 
 		/**	Starts the editor with the specified render and audio systems. */
-		static void startUp();
+		static void startUp(const EditorLaunchOptions& options = EditorLaunchOptions());
+
+		/** 
+		 * Performs the operations requested by the launch options without running the main loop, printing a
+		 * machine-readable line with the status and timing of each step to standard output. Only valid when the editor
+		 * was started in headless mode.
+		 *
+		 * @return	Process exit code. Zero on success, 1 if the project couldn't be loaded, 2 if any resources failed to
+		 *			import, 3 if the build failed, 4 if the build only updated resources of a folder that doesn't hold a
+		 *			full build (game binaries and assemblies are only produced by a build from the editor).
+		 */
+		int runHeadless();
+
+		/** Checks if the editor was started in headless mode. See EditorLaunchOptions::headless. */
+		bool isHeadless() const { return mLaunchOptions.headless; }
 
 		/**	Checks whether the editor currently has a project loaded. */
 		bool isProjectLoaded() const { return mIsProjectLoaded; }
@@ -71,6 +126,29 @@ namespace bs
 		 */
 		bool isValidProjectPath(const Path& path);
 
+		/**
+		 * Notifies the editor that something changed and it should run at its regular frame rate, even if it is currently
+		 * idle. The editor will keep running at the regular rate for a short period after the last notification, after
+		 * which it returns to the idle frame rate.
+		 */
+		void invalidate();
+
+		/**
+		 * Enables or disables continuous updates. While enabled the editor will never drop to the idle frame rate. This
+		 * should be enabled whenever something needs to be animated every frame (e.g. while in play mode or when
+		 * previewing an animation).
+		 */
+		void setContinuousUpdate(bool enabled) { mContinuousUpdate = enabled; }
+
+		/** Checks is the editor currently running at the reduced, idle frame rate. */
+		bool isIdle() const { return mIsIdle; }
+
+		/**
+		 * Returns the number of frames that were skipped due to idle throttling, since the editor was started. Frames are
+		 * counted relative to the regular FPS limit, and are not counted if the regular limit is infinite.
+		 */
+		UINT64 getNumSkippedFrames() const { return mNumSkippedFrames; }
+
 		/** @copydoc Application::isEditor */
 		bool isEditor() const override { return true; }
 
@@ -122,6 +200,12 @@ namespace bs
 		 */
 		void loadProjectSettings();
 
+		/** 
+		 * Determines should the editor run at the regular or the idle frame rate this frame, and applies the relevant FPS
+		 * limit.
+		 */
+		void updateFrameRate();
+
 		/** @copydoc Application::getShaderIncludeHandler */
 		SPtr<IShaderIncludeHandler> getShaderIncludeHandler() const override;
 
@@ -130,6 +214,7 @@ namespace bs
 		static const Path BUILD_DATA_PATH;
 		static const Path PROJECT_SETTINGS_PATH;
 
+		EditorLaunchOptions mLaunchOptions;
 		SPtr<EditorSettings> mEditorSettings;
 		SPtr<ProjectSettings> mProjectSettings;
 
@@ -139,6 +224,13 @@ namespace bs
 
 		Timer mSplashScreenTimer;
 		bool mSplashScreenShown = true;
+
+		Timer mIdleTimer;
+		bool mIsIdle = false;
+		bool mContinuousUpdate = false;
+		UINT64 mNumSkippedFrames = 0;
+		float mSkippedFrameFraction = 0.0f;
+		Vector<HEvent> mActivityConns;
 	};
 
 	/**	Easy way to access EditorApplication. */
@@ -189,6 +189,10 @@ namespace bs
 	class ProjectSettings;
 	class GUIColorGradient;
 	class GUIColorGradientField;
+	class BuildManifest;
+	class ChildProcess;
+	class ImportWorkerPool;
+	class ResourceReferenceIndex;
 
 	static constexpr const char* EDITOR_ASSEMBLY = "MBansheeEditor";
 	static constexpr const char* SCRIPT_EDITOR_ASSEMBLY = "MScriptEditor";
@@ -248,7 +252,10 @@ namespace bs
 		TID_WindowFrameWidget = 40021,
 		TID_ProjectResourceMeta = 40022,
 		TID_SettingsValue = 40023,
-		TID_SettingsObjectValue = 40024
+		TID_SettingsObjectValue = 40024,
+		TID_BuildManifest = 40025,
+		TID_BuildManifestEntry = 40026,
+		TID_ResourceReferenceIndex = 40027
 	};
 
 	BS_LOG_CATEGORY(Editor, 60)
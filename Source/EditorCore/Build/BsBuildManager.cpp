@@ -1,10 +1,21 @@
 //********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "Build/BsBuildManager.h"
+#include "Build/BsBuildManifest.h"
 #include "Private/RTTI/BsBuildDataRTTI.h"
 #include "Serialization/BsFileSerializer.h"
 #include "FileSystem/BsFileSystem.h"
 #include "BsEditorApplication.h"
+#include "Library/BsProjectLibrary.h"
+#include "Library/BsProjectResourceMeta.h"
+#include "Resources/BsResources.h"
+#include "Resources/BsResourceManifest.h"
+#include "Resources/BsBuiltinResources.h"
+#include "Resources/BsGameResourceManager.h"
+#include "Scene/BsPrefab.h"
+#include "Scene/BsSceneObject.h"
+#include "Image/BsTexture.h"
+#include "Utility/BsGameSettings.h"
 
 namespace bs
 {
@@ -26,6 +37,7 @@ namespace bs
 	}
 
 	const char* BuildManager::BUILD_FOLDER_NAME = "Builds/";
+	const Path BuildManager::BUILD_MANIFEST_DIR = PROJECT_INTERNAL_DIR + "BuildManifests/";
 
 	BuildManager::BuildManager()
 	{
@@ -180,4 +192,361 @@ namespace bs
 		if (mBuildData == nullptr)
 			mBuildData = bs_shared_ptr_new<BuildData>();
 	}
+
+	void BuildManager::beginBuild(const Path& destinationRoot)
+	{
+		if (!FileSystem::exists(destinationRoot))
+			FileSystem::createDir(destinationRoot);
+
+		// Keep the manifest out of the build folder so it doesn't ship with the build. Each destination folder gets its
+		// own manifest, as builds into different folders are independent.
+		Path absoluteRoot = destinationRoot.getAbsolute(gEditorApplication().getProjectPath());
+		Path manifestPath = gEditorApplication().getProjectPath() + BUILD_MANIFEST_DIR;
+		manifestPath.setFilename(toString((UINT64)bs_hash(absoluteRoot.toString())) + ".asset");
+
+		mActiveManifest = BuildManifest::load(destinationRoot, manifestPath);
+	}
+
+	void BuildManager::copyToBuild(const Path& source, const Path& destination)
+	{
+		if (mActiveManifest == nullptr)
+		{
+			BS_LOG(Error, Editor, "Copying files to a build without calling beginBuild() first.");
+			return;
+		}
+
+		if (!FileSystem::isFile(source))
+		{
+			BS_LOG(Warning, Editor, "Cannot copy file to build, source file doesn't exist: {0}", source);
+			return;
+		}
+
+		UINT64 inputHash = BuildManifest::hashFile(source);
+		if (mActiveManifest->isUpToDate(destination, inputHash))
+			return;
+
+		Path destinationFolder = destination.getParent();
+		if (!FileSystem::exists(destinationFolder))
+			FileSystem::createDir(destinationFolder);
+
+		FileSystem::copy(source, destination, true);
+		mActiveManifest->recordOutput(destination, inputHash);
+	}
+
+	void BuildManager::endBuild(bool removeStale)
+	{
+		if (mActiveManifest == nullptr)
+			return;
+
+		UINT32 numRemoved = 0;
+		if (removeStale)
+			numRemoved = mActiveManifest->removeStaleOutputs();
+
+		mActiveManifest->save();
+
+		BS_LOG(Info, Editor, "Build finished. {0} files written, {1} files up to date and skipped ({2} bytes saved), "
+			"{3} stale files removed.", mActiveManifest->getNumWritten(), mActiveManifest->getNumSkipped(), 
+			mActiveManifest->getNumSkippedBytes(), numRemoved);
+
+		mActiveManifest = nullptr;
+	}
+
+	void BuildManager::packageResources(const Path& buildFolder, const SPtr<PlatformInfo>& platformInfo)
+	{
+		UnorderedSet<Path> usedResources;
+		SPtr<ResourceMapping> resourceMap = ResourceMapping::create();
+
+		// Get all resources manually included in build
+		Vector<USPtr<ProjectLibrary::FileEntry>> buildResources = gProjectLibrary().getResourcesForBuild();
+		for (auto& entry : buildResources)
+		{
+			if (entry->meta == nullptr)
+			{
+				BS_LOG(Warning, Editor, "Cannot include resource in build, missing meta file for: {0}", entry->path);
+				continue;
+			}
+
+			auto& resourceMetas = entry->meta->getResourceMetaData();
+			for(auto& resMeta : resourceMetas)
+			{
+				Path resourcePath;
+				if (gResources().getFilePathFromUUID(resMeta->getUUID(), resourcePath))
+					usedResources.insert(resourcePath);
+				else
+					BS_LOG(Warning, Editor, "Cannot include resource in build, missing imported asset for: {0}", entry->path);
+			}
+		}
+
+		// Include main scene
+		if (platformInfo != nullptr)
+		{
+			Path resourcePath;
+			if (gResources().getFilePathFromUUID(platformInfo->mainScene.getUUID(), resourcePath))
+				usedResources.insert(resourcePath);
+			else
+				BS_LOG(Warning, Editor, "Cannot include main scene in build, missing imported asset.");
+		}
+
+		// Find dependencies of all resources
+		Vector<Path> newResources;
+		for (auto& entry : usedResources)
+			newResources.push_back(entry);
+
+		while (!newResources.empty())
+		{
+			Vector<Path> allDependencies;
+			for (auto& entry : newResources)
+			{
+				// Use the library reference index when possible, falling back to reading the resource header for
+				// resources that aren't part of the library
+				UUID uuid;
+				Vector<UUID> curDependencies;
+				if (!gResources().getUUIDFromFilePath(entry, uuid) || 
+					!gProjectLibrary().getReferencedResources(uuid, curDependencies))
+					curDependencies = gResources().getDependencies(entry);
+
+				for (auto& entry : curDependencies)
+				{
+					Path resourcePath;
+					if (gResources().getFilePathFromUUID(entry, resourcePath))
+					{
+						if (usedResources.find(resourcePath) == usedResources.end())
+						{
+							allDependencies.push_back(resourcePath);
+							usedResources.insert(resourcePath);
+						}
+					}
+				}
+			}
+
+			newResources = allDependencies;
+		} 
+
+		// Copy resources
+		Path outputPath = buildFolder;
+		outputPath.append(GAME_RESOURCES_FOLDER_NAME);
+
+		FileSystem::createDir(outputPath);
+
+		Path libraryDir = gProjectLibrary().getResourcesFolder();
+
+		// Packaged prefabs are updated with the latest version of any prefabs nested in them, so their output also 
+		// depends on the contents of other prefabs. Since nested prefab links aren't tracked as dependencies, hash all 
+		// prefabs in the project (order independent) and combine it with each prefab's own hash.
+		bool prefabHashValid = false;
+		UINT64 allPrefabsHash = 0;
+		auto getAllPrefabsHash = [&prefabHashValid, &allPrefabsHash]()
+		{
+			if (prefabHashValid)
+				return allPrefabsHash;
+
+			Vector<USPtr<ProjectLibrary::LibraryEntry>> prefabEntries = gProjectLibrary().search("*", { TID_Prefab });
+			for (auto& libraryEntry : prefabEntries)
+			{
+				if (libraryEntry->type != ProjectLibrary::LibraryEntryType::File)
+					continue;
+
+				auto fileEntry = static_cast<ProjectLibrary::FileEntry*>(libraryEntry.get());
+				if (fileEntry->meta == nullptr)
+					continue;
+
+				for (auto& resMeta : fileEntry->meta->getResourceMetaData())
+				{
+					Path prefabPath;
+					if (gResources().getFilePathFromUUID(resMeta->getUUID(), prefabPath))
+						allPrefabsHash += BuildManifest::hashFile(prefabPath);
+				}
+			}
+
+			prefabHashValid = true;
+			return allPrefabsHash;
+		};
+
+		for (auto& entry : usedResources)
+		{
+			UUID uuid;
+
+			const bool found = gResources().getUUIDFromFilePath(entry, uuid);
+			BS_ASSERT(found);
+
+			Path sourcePath = gProjectLibrary().uuidToPath(uuid);
+			if (sourcePath.isEmpty()) // Resource not part of library, meaning its built-in and we don't need to copy those here
+				continue;
+
+			SPtr<ProjectResourceMeta> resMeta = gProjectLibrary().findResourceMeta(sourcePath);
+			assert(resMeta != nullptr);
+
+			Path destPath = outputPath;
+			destPath.setFilename(entry.getFilename());
+
+			// Create library -> packaged resource mapping
+			Path relSourcePath = sourcePath;
+			if (sourcePath.isAbsolute())
+				relSourcePath.makeRelative(libraryDir);
+
+			Path relDestPath = GAME_RESOURCES_FOLDER_NAME;
+			relDestPath.setFilename(entry.getFilename());
+
+			resourceMap->add(relSourcePath, relDestPath);
+
+			// Skip resources whose packaged version is still up to date with the imported asset
+			UINT64 inputHash = 0;
+			if (mActiveManifest != nullptr)
+			{
+				inputHash = BuildManifest::hashFile(entry);
+				if (resMeta->getTypeID() == TID_Prefab)
+					inputHash = BuildManifest::combineHash(inputHash, getAllPrefabsHash());
+
+				if (mActiveManifest->isUpToDate(destPath, inputHash))
+					continue;
+			}
+
+			// If resource is prefab make sure to update it in case any of the prefabs it is referencing changed
+			if (resMeta->getTypeID() == TID_Prefab)
+			{
+				bool reload = gResources().isLoaded(uuid);
+
+				HPrefab prefab = static_resource_cast<Prefab>(gProjectLibrary().load(sourcePath));
+
+				// Gather the hierarchy in a single pass, and only update child instances if the prefab actually has any
+				// nested prefab instances, as the update requires its own walk of the hierarchy
+				Vector<HSceneObject> hierarchy;
+				bool hasChildInstances = false;
+
+				Stack<HSceneObject> todo;
+				todo.push(prefab->_getRoot());
+
+				while (!todo.empty())
+				{
+					HSceneObject current = todo.top();
+					todo.pop();
+
+					hierarchy.push_back(current);
+
+					UINT32 numChildren = current->getNumChildren();
+					for (UINT32 i = 0; i < numChildren; i++)
+					{
+						HSceneObject child = current->getChild(i);
+						if (!child->_getPrefabLinkUUID().empty())
+							hasChildInstances = true;
+
+						todo.push(child);
+					}
+				}
+
+				if (hasChildInstances)
+				{
+					prefab->_updateChildInstances();
+
+					// Updating child instances can re-create parts of the hierarchy
+					hierarchy.clear();
+					todo.push(prefab->_getRoot());
+
+					while (!todo.empty())
+					{
+						HSceneObject current = todo.top();
+						todo.pop();
+
+						hierarchy.push_back(current);
+
+						UINT32 numChildren = current->getNumChildren();
+						for (UINT32 i = 0; i < numChildren; i++)
+							todo.push(current->getChild(i));
+					}
+				}
+
+				// Clear prefab diffs as they're not used in standalone
+				for (auto& entry : hierarchy)
+					entry->_clearPrefabDiff();
+
+				gResources().save(prefab, destPath, false);
+
+				// Need to unload this one as we modified it in memory, and we don't want to persist those changes past
+				// this point
+				gResources().release(prefab);
+
+				if (reload)
+					gProjectLibrary().load(sourcePath);
+			}
+			else
+				FileSystem::copy(entry, destPath);
+
+			if (mActiveManifest != nullptr)
+				mActiveManifest->recordOutput(destPath, inputHash);
+		}
+
+		// Save icon
+		Path iconFolder = BuiltinResources::getIconFolder();
+
+		Path sourceRoot = getBuildFolder(BuildFolder::SourceRoot, platformInfo->type);
+		iconFolder.makeRelative(sourceRoot);
+
+		Path destRoot = getBuildFolder(BuildFolder::DestinationRoot, platformInfo->type);
+		Path destIconFile = destRoot;
+		destIconFile.append(iconFolder);
+		destIconFile.setFilename(String(BuiltinResources::IconTextureName) + ".asset");
+
+		switch (platformInfo->type)
+		{
+		case PlatformType::Windows:
+		{
+			SPtr<WinPlatformInfo> winPlatformInfo = std::static_pointer_cast<WinPlatformInfo>(platformInfo);
+			
+			HTexture icon = static_resource_cast<Texture>(gResources().loadFromUUID(winPlatformInfo->icon.getUUID()));
+			if (icon != nullptr)
+				gResources().save(icon, destIconFile, true);
+		}
+			break;
+		default:
+			break;
+		};
+
+		// Save manifest
+		Path manifestPath = outputPath;
+		manifestPath.append(GAME_RESOURCE_MANIFEST_NAME);
+
+		Path internalResourcesFolder = gEditorApplication().getProjectPath();
+		internalResourcesFolder.append(PROJECT_INTERNAL_DIR);
+
+		SPtr<ResourceManifest> manifest = gProjectLibrary()._getManifest();
+		ResourceManifest::save(manifest, manifestPath, internalResourcesFolder);
+
+		// Save resource map
+		Path mappingPath = outputPath;
+		mappingPath.append(GAME_RESOURCE_MAPPING_NAME);
+
+		FileEncoder fe(mappingPath);
+		fe.encode(resourceMap.get());
+	}
+
+	void BuildManager::createStartupSettings(const Path& buildFolder, const SPtr<PlatformInfo>& platformInfo)
+	{
+		SPtr<GameSettings> gameSettings;
+		if (platformInfo != nullptr)
+		{
+			gameSettings = bs_shared_ptr_new<GameSettings>();
+			gameSettings->mainSceneUUID = platformInfo->mainScene.getUUID();
+			gameSettings->fullscreen = platformInfo->fullscreen;
+			gameSettings->resolutionWidth = platformInfo->windowedWidth;
+			gameSettings->resolutionHeight = platformInfo->windowedHeight;
+
+			switch (platformInfo->type)
+			{
+			case(PlatformType::Windows) :
+			{
+				SPtr<WinPlatformInfo> winPlatformInfo = std::static_pointer_cast<WinPlatformInfo>(platformInfo);
+				gameSettings->titleBarText = winPlatformInfo->titlebarText;
+			}
+				break;
+			default:
+				break;
+			}
+		}
+
+		Path outputPath = buildFolder;
+		outputPath.append(GAME_SETTINGS_NAME);
+
+		FileEncoder fe(outputPath);
+		fe.encode(gameSettings.get());
+	}
 }
\ No newline at end of file
@@ -90,10 +90,60 @@ namespace bs
 		/**	Clears currently active build settings. */
 		void clear();
 
+		/**
+		 * Starts a new incremental build into the specified folder. Loads the manifest of the previous build in that 
+		 * folder, if any, so that outputs that are still up to date don't need to be written again.
+		 */
+		void beginBuild(const Path& destinationRoot);
+
+		/**
+		 * Copies a file into the build started with beginBuild(). The copy is skipped if the destination already holds an
+		 * up to date copy of the source file.
+		 *
+		 * @param[in]	source		Absolute path of the file to copy.
+		 * @param[in]	destination	Absolute path to copy the file to. Must be within the build folder.
+		 */
+		void copyToBuild(const Path& source, const Path& destination);
+
+		/** 
+		 * Ends the build started with beginBuild(). Deletes any outputs of the previous build that are no longer used,
+		 * saves the build manifest and reports how much work was skipped.
+		 *
+		 * @param[in]	removeStale		If false, outputs of the previous build that weren't written by this build are
+		 *								kept, along with their manifest entries. Use this for builds that only produce a
+		 *								part of the outputs (e.g. only resources), so they don't delete the rest.
+		 */
+		void endBuild(bool removeStale = true);
+
+		/**
+		 * Finds all resources used by the build (resources explicitly included in the build, the main scene, and all of
+		 * their dependencies) and packages them into the build folder, along with the resource manifest, the resource
+		 * mapping and the application icon. If a build was started with beginBuild(), resources that are still up to
+		 * date are skipped.
+		 *
+		 * @param[in]	buildFolder		Absolute path to the root folder of the build.
+		 * @param[in]	platformInfo	Information about the platform the build is for.
+		 */
+		void packageResources(const Path& buildFolder, const SPtr<PlatformInfo>& platformInfo);
+
+		/**
+		 * Creates a game settings asset that contains the data necessary for starting up the game (e.g. the initial 
+		 * scene).
+		 *
+		 * @param[in]	buildFolder		Absolute path to the root folder of the build.
+		 * @param[in]	platformInfo	Information about the platform the build is for.
+		 */
+		void createStartupSettings(const Path& buildFolder, const SPtr<PlatformInfo>& platformInfo);
+
+		/** Returns the manifest of the build currently in progress, or null if no build is in progress. */
+		const SPtr<BuildManifest>& getActiveManifest() const { return mActiveManifest; }
+
 	private:
 		static const char* BUILD_FOLDER_NAME;
+		static const Path BUILD_MANIFEST_DIR;
 
 		SPtr<BuildData> mBuildData;
+		SPtr<BuildManifest> mActiveManifest;
 	};
 
 	/** @} */
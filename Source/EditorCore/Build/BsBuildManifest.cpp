@@ -0,0 +1,156 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Build/BsBuildManifest.h"
+#include "Private/RTTI/BsBuildManifestRTTI.h"
+#include "Serialization/BsFileSerializer.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+
+namespace bs
+{
+	SPtr<BuildManifest> BuildManifest::load(const Path& buildFolder, const Path& manifestPath)
+	{
+		SPtr<BuildManifest> manifest;
+		if (FileSystem::exists(manifestPath))
+		{
+			FileDecoder fd(manifestPath);
+			manifest = std::static_pointer_cast<BuildManifest>(fd.decode());
+		}
+
+		if (manifest == nullptr)
+			manifest = bs_shared_ptr_new<BuildManifest>();
+
+		manifest->mBuildFolder = buildFolder;
+		manifest->mManifestPath = manifestPath;
+		return manifest;
+	}
+
+	void BuildManifest::save()
+	{
+		Path manifestFolder = mManifestPath.getParent();
+		if (!FileSystem::exists(manifestFolder))
+			FileSystem::createDir(manifestFolder);
+
+		FileEncoder fe(mManifestPath);
+		fe.encode(this);
+	}
+
+	bool BuildManifest::isUpToDate(const Path& output, UINT64 inputHash)
+	{
+		String key = getKey(output);
+		mUsedEntries.insert(key);
+
+		auto iterFind = mEntries.find(key);
+		if (iterFind == mEntries.end())
+			return false;
+
+		const BuildManifestEntry& entry = iterFind->second;
+		if (entry.inputHash != inputHash)
+			return false;
+
+		// Make sure the output wasn't modified or deleted outside of the build
+		if (!FileSystem::isFile(output))
+			return false;
+
+		if (FileSystem::getFileSize(output) != entry.outputSize || 
+			FileSystem::getLastModifiedTime(output) != entry.outputTimestamp)
+			return false;
+
+		mNumSkipped++;
+		mNumSkippedBytes += entry.outputSize;
+		return true;
+	}
+
+	void BuildManifest::recordOutput(const Path& output, UINT64 inputHash)
+	{
+		String key = getKey(output);
+		mUsedEntries.insert(key);
+
+		BuildManifestEntry& entry = mEntries[key];
+		entry.inputHash = inputHash;
+		entry.outputSize = FileSystem::getFileSize(output);
+		entry.outputTimestamp = FileSystem::getLastModifiedTime(output);
+
+		mNumWritten++;
+	}
+
+	UINT32 BuildManifest::removeStaleOutputs()
+	{
+		UINT32 numRemoved = 0;
+		for (auto iter = mEntries.begin(); iter != mEntries.end();)
+		{
+			if (mUsedEntries.find(iter->first) != mUsedEntries.end())
+			{
+				++iter;
+				continue;
+			}
+
+			Path stalePath = mBuildFolder;
+			stalePath.append(iter->first);
+
+			if (FileSystem::isFile(stalePath))
+			{
+				FileSystem::remove(stalePath);
+				numRemoved++;
+			}
+
+			iter = mEntries.erase(iter);
+		}
+
+		return numRemoved;
+	}
+
+	UINT64 BuildManifest::hashFile(const Path& path)
+	{
+		SPtr<DataStream> stream = FileSystem::openFile(path);
+		if (stream == nullptr)
+			return 0;
+
+		// 64-bit FNV-1a
+		UINT64 hash = 14695981039346656037ULL;
+
+		static constexpr UINT32 CHUNK_SIZE = 16 * 1024;
+		UINT8* buffer = (UINT8*)bs_stack_alloc(CHUNK_SIZE);
+
+		while (!stream->eof())
+		{
+			size_t numRead = stream->read(buffer, CHUNK_SIZE);
+			if (numRead == 0)
+				break;
+
+			for (size_t i = 0; i < numRead; i++)
+			{
+				hash ^= buffer[i];
+				hash *= 1099511628211ULL;
+			}
+		}
+
+		bs_stack_free(buffer);
+		stream->close();
+
+		return hash;
+	}
+
+	UINT64 BuildManifest::combineHash(UINT64 a, UINT64 b)
+	{
+		return a ^ (b + 0x9e3779b97f4a7c15ULL + (a << 6) + (a >> 2));
+	}
+
+	String BuildManifest::getKey(const Path& output) const
+	{
+		Path relativePath = output;
+		relativePath.makeRelative(mBuildFolder);
+
+		return relativePath.toString();
+	}
+
+	RTTITypeBase* BuildManifest::getRTTIStatic()
+	{
+		return BuildManifestRTTI::instance();
+	}
+
+	RTTITypeBase* BuildManifest::getRTTI() const
+	{
+		return BuildManifest::getRTTIStatic();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Reflection/BsIReflectable.h"
+
+namespace bs
+{
+	/** @addtogroup Build
+	 *  @{
+	 */
+
+	/** Information about a single file output by a build, as stored in BuildManifest. */
+	struct BuildManifestEntry
+	{
+		UINT64 inputHash = 0; /**< Hash of all the inputs used for generating the output file. */
+		UINT64 outputSize = 0; /**< Size of the output file, in bytes, at the time it was written. */
+		std::time_t outputTimestamp = 0; /**< Last modified time of the output file at the time it was written. */
+	};
+
+	/**
+	 * Keeps track of all files output by a build, along with hashes of the inputs they were generated from. Stored in the
+	 * project's internal folder (so it doesn't ship with the build) and used for performing incremental builds, so that
+	 * only outputs whose inputs changed since the last build need to be written.
+	 */
+	class BS_ED_EXPORT BuildManifest : public IReflectable
+	{
+	public:
+		BuildManifest() = default;
+
+		/** 
+		 * Loads the manifest describing the contents of the provided build folder. If no manifest exists (e.g. first build
+		 * into the folder) an empty manifest is returned.
+		 *
+		 * @param[in]	buildFolder		Absolute path to the folder the build outputs are written to.
+		 * @param[in]	manifestPath	Absolute path to the file the manifest is stored in. Must be outside of the build
+		 *								folder.
+		 */
+		static SPtr<BuildManifest> load(const Path& buildFolder, const Path& manifestPath);
+
+		/** Saves the manifest to the path it was loaded from. */
+		void save();
+
+		/**
+		 * Checks if the output file at the provided path is up to date with the provided input hash. Output is considered
+		 * up to date if it was recorded with the same input hash, and it hasn't been modified or removed since. Either
+		 * way the output is marked as used by the current build.
+		 *
+		 * @param[in]	output		Absolute path to the output file.
+		 * @param[in]	inputHash	Hash of all the inputs used to generate the output file.
+		 * @return					True if the output file doesn't need to be written.
+		 */
+		bool isUpToDate(const Path& output, UINT64 inputHash);
+
+		/** 
+		 * Records that an output file was written during the current build. Must be called after the file has been 
+		 * written.
+		 *
+		 * @param[in]	output		Absolute path to the output file.
+		 * @param[in]	inputHash	Hash of all the inputs used to generate the output file.
+		 */
+		void recordOutput(const Path& output, UINT64 inputHash);
+
+		/** 
+		 * Deletes all output files recorded by a previous build that weren't used by the current build, and removes them 
+		 * from the manifest. Returns the number of deleted files.
+		 */
+		UINT32 removeStaleOutputs();
+
+		/** Returns the number of outputs that were up to date and skipped during the current build. */
+		UINT32 getNumSkipped() const { return mNumSkipped; }
+
+		/** Returns the total size of outputs that were up to date and skipped during the current build, in bytes. */
+		UINT64 getNumSkippedBytes() const { return mNumSkippedBytes; }
+
+		/** Returns the number of outputs that were written during the current build. */
+		UINT32 getNumWritten() const { return mNumWritten; }
+
+		/** Calculates a hash of the contents of the file at the provided path. Returns zero if the file doesn't exist. */
+		static UINT64 hashFile(const Path& path);
+
+		/** Combines two hash values into one. */
+		static UINT64 combineHash(UINT64 a, UINT64 b);
+
+	private:
+		/** Returns the manifest key for the provided absolute output path. */
+		String getKey(const Path& output) const;
+
+		Path mBuildFolder;
+		Path mManifestPath;
+		Map<String, BuildManifestEntry> mEntries;
+		UnorderedSet<String> mUsedEntries;
+
+		UINT32 mNumSkipped = 0;
+		UINT64 mNumSkippedBytes = 0;
+		UINT32 mNumWritten = 0;
+
+		/************************************************************************/
+		/* 								RTTI		                     		*/
+		/************************************************************************/
+	public:
+		friend class BuildManifestRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
+	/** @} */
+}
\ No newline at end of file
@@ -132,7 +132,10 @@ namespace bs
 
 		gResources().registerResourceManifest(mResourceManifest);
 
-		// Load basic resources
+		// Load basic resources. All loads are issued asynchronously so they can be processed in parallel, and are only
+		// waited on when first accessed.
+		mLoadTimer.reset();
+
 		mShaderDockOverlay = getShader(ShaderDockOverlayFile);
 		mShaderSceneGrid = getShader(ShaderSceneGridFile);
 		mShaderPicking[(int)CULL_NONE] = getShader(ShaderPickingCullNoneFile);
@@ -153,33 +156,71 @@ namespace bs
 		mShaderHandleLine = getShader(ShaderLineHandleFile);
 		mShaderSelection = getShader(ShaderSelectionFile);
 
-		mDefaultFont = gResources().load<Font>(BuiltinDataFolder + (DefaultFontFilename + ".asset"));
-		mDefaultAAFont = gResources().load<Font>(BuiltinDataFolder + (DefaultAAFontFilename + ".asset"));
-		mSkin = gResources().load<GUISkin>(BuiltinDataFolder + (GUISkinFile + ".json.asset"));
+		mDefaultFont = gResources().loadAsync<Font>(BuiltinDataFolder + (DefaultFontFilename + ".asset"));
+		mDefaultAAFont = gResources().loadAsync<Font>(BuiltinDataFolder + (DefaultAAFontFilename + ".asset"));
+		mSkin = gResources().loadAsync<GUISkin>(BuiltinDataFolder + (GUISkinFile + ".json.asset"));
+
+		mLoadIssueTimeUs = mLoadTimer.getMicroseconds();
 	}
 
-	HSpriteTexture BuiltinEditorResources::getGUIIcon(const String& name) const
+	void BuiltinEditorResources::waitUntilLoaded(const HResource& resource) const
 	{
-		Path texturePath = EditorIconSpritesFolder;
-		texturePath.append("sprite_" + name + ".asset");
+		if (resource.isLoaded())
+			return;
 
-		return gResources().load<SpriteTexture>(texturePath);
+		Timer timer;
+		resource.blockUntilLoaded();
+		mLoadBlockedTimeUs += timer.getMicroseconds();
 	}
 
-	HSpriteTexture BuiltinEditorResources::getGUIIcon3D(const String& name) const
+	const HShader& BuiltinEditorResources::waitUntilShaderLoaded(const HShader& shader) const
 	{
-		Path texturePath = EditorIcon3DSpritesFolder;
-		texturePath.append("sprite_" + name + ".asset");
+		waitUntilLoaded(HResource(shader));
 
-		return gResources().load<SpriteTexture>(texturePath);
+#if BS_DEBUG_MODE
+		if (mVerifiedShaders.insert(shader.getUUID()).second)
+			BuiltinResourcesHelper::verifyAndReportShader(shader);
+#endif
+
+		return shader;
+	}
+
+	void BuiltinEditorResources::logLoadTimings() const
+	{
+		BS_LOG(Info, Editor, "Builtin editor resources: loads issued in {0} ms, main thread blocked on them for {1} ms, "
+			"{2} ms since start of loading.", mLoadIssueTimeUs / 1000.0f, mLoadBlockedTimeUs / 1000.0f,
+			mLoadTimer.getMilliseconds());
+	}
+
+	HSpriteTexture BuiltinEditorResources::getGUIIcon(const String& name) const
+	{
+		return getCachedSprite(mGUIIconCache, EditorIconSpritesFolder, name);
+	}
+
+	HSpriteTexture BuiltinEditorResources::getGUIIcon3D(const String& name) const
+	{
+		return getCachedSprite(mGUIIcon3DCache, EditorIcon3DSpritesFolder, name);
 	}
 
 	HSpriteTexture BuiltinEditorResources::getAnimatedSprite(const String& name) const
 	{
-		Path texturePath = EditorAnimatedSpritesFolder;
+		return getCachedSprite(mAnimatedSpriteCache, EditorAnimatedSpritesFolder, name);
+	}
+
+	HSpriteTexture BuiltinEditorResources::getCachedSprite(UnorderedMap<String, HSpriteTexture>& cache, 
+		const Path& folder, const String& name) const
+	{
+		auto iterFind = cache.find(name);
+		if (iterFind != cache.end())
+			return iterFind->second;
+
+		Path texturePath = folder;
 		texturePath.append("sprite_" + name + ".asset");
 
-		return gResources().load<SpriteTexture>(texturePath);
+		HSpriteTexture sprite = gResources().load<SpriteTexture>(texturePath);
+		cache[name] = sprite;
+
+		return sprite;
 	}
 
 	HShader BuiltinEditorResources::getShader(const String& name) const
@@ -187,96 +228,108 @@ namespace bs
 		Path programPath = EditorShaderFolder;
 		programPath.append(name + ".asset");
 
-		HShader shader = gResources().load<Shader>(programPath);
-
-#if BS_DEBUG_MODE
-		BuiltinResourcesHelper::verifyAndReportShader(shader);
-#endif
-
-		return shader;
+		return gResources().loadAsync<Shader>(programPath);
 	}
 
 	HMaterial BuiltinEditorResources::createDockDropOverlayMaterial() const
 	{
-		return Material::create(mShaderDockOverlay);
+		return Material::create(waitUntilShaderLoaded(mShaderDockOverlay));
 	}
 
 	HMaterial BuiltinEditorResources::createSceneGridMaterial() const
 	{
-		return Material::create(mShaderSceneGrid);
+		return Material::create(waitUntilShaderLoaded(mShaderSceneGrid));
 	}
 
 	HMaterial BuiltinEditorResources::createPicking(CullingMode cullMode) const
 	{
 		UINT32 modeIdx = (UINT32)cullMode;
 
-		return Material::create(mShaderPicking[modeIdx]);
+		return Material::create(waitUntilShaderLoaded(mShaderPicking[modeIdx]));
 	}
 
 	HMaterial BuiltinEditorResources::createPickingAlpha(CullingMode cullMode) const
 	{
 		UINT32 modeIdx = (UINT32)cullMode;
 
-		return Material::create(mShaderPickingAlpha[modeIdx]);
+		return Material::create(waitUntilShaderLoaded(mShaderPickingAlpha[modeIdx]));
 	}
 
 	HMaterial BuiltinEditorResources::createLineGizmoMat() const
 	{
-		return Material::create(mShaderGizmoLine);
+		return Material::create(waitUntilShaderLoaded(mShaderGizmoLine));
 	}
 
 	HMaterial BuiltinEditorResources::createSolidGizmoMat() const
 	{
-		return Material::create(mShaderGizmoSolid);
+		return Material::create(waitUntilShaderLoaded(mShaderGizmoSolid));
 	}
 
 	HMaterial BuiltinEditorResources::createWireGizmoMat() const
 	{
-		return Material::create(mShaderGizmoWire);
+		return Material::create(waitUntilShaderLoaded(mShaderGizmoWire));
 	}
 
 	HMaterial BuiltinEditorResources::createIconGizmoMat() const
 	{
-		return Material::create(mShaderGizmoIcon);
+		return Material::create(waitUntilShaderLoaded(mShaderGizmoIcon));
 	}
 
 	HMaterial BuiltinEditorResources::createGizmoPickingMat() const
 	{
-		return Material::create(mShaderGizmoPicking);
+		return Material::create(waitUntilShaderLoaded(mShaderGizmoPicking));
 	}
 
 	HMaterial BuiltinEditorResources::createAlphaGizmoPickingMat() const
 	{
-		return Material::create(mShaderGizmoAlphaPicking);
+		return Material::create(waitUntilShaderLoaded(mShaderGizmoAlphaPicking));
 	}
 
 	HMaterial BuiltinEditorResources::createLineHandleMat() const
 	{
-		return Material::create(mShaderHandleLine);
+		return Material::create(waitUntilShaderLoaded(mShaderHandleLine));
 	}
 
 	HMaterial BuiltinEditorResources::createTextGizmoMat() const
 	{
-		return Material::create(mShaderGizmoText);
+		return Material::create(waitUntilShaderLoaded(mShaderGizmoText));
 	}
 
 	HMaterial BuiltinEditorResources::createSolidHandleMat() const
 	{
-		return Material::create(mShaderHandleSolid);
+		return Material::create(waitUntilShaderLoaded(mShaderHandleSolid));
 	}
 
 	HMaterial BuiltinEditorResources::createHandleClearAlphaMat() const
 	{
-		return Material::create(mShaderHandleClearAlpha);
+		return Material::create(waitUntilShaderLoaded(mShaderHandleClearAlpha));
 	}
 
 	HMaterial BuiltinEditorResources::createSelectionMat() const
 	{
-		return Material::create(mShaderSelection);
+		return Material::create(waitUntilShaderLoaded(mShaderSelection));
 	}
 
 	HSpriteTexture BuiltinEditorResources::getProjectLibraryIcon(ProjectLibraryIcon icon, int size) const
 	{
+		const UINT32 iconIdx = (UINT32)icon;
+		if (iconIdx >= NUM_PROJECT_LIBRARY_ICONS)
+			return HSpriteTexture();
+
+		UINT32 sizeIdx;
+		if (size <= 16)
+			sizeIdx = 0;
+		else if (size <= 32)
+			sizeIdx = 1;
+		else if (size <= 48)
+			sizeIdx = 2;
+		else
+			sizeIdx = 3;
+
+		HSpriteTexture& cachedIcon = mProjectLibraryIcons[iconIdx][sizeIdx];
+		if (cachedIcon)
+			return cachedIcon;
+
 		String iconName;
 
 		switch (icon)
@@ -337,14 +390,11 @@ namespace bs
 		if (iconName.empty())
 			return HSpriteTexture();
 
-		if (size <= 16)
-			iconName += "16";
-		else if (size <= 32)
-			iconName += "32";
-		else if (size <= 48)
-			iconName += "48";
+		static const char* SIZE_SUFFIXES[NUM_PROJECT_LIBRARY_ICON_SIZES] = { "16", "32", "48", "" };
+		iconName += SIZE_SUFFIXES[sizeIdx];
 
-		return getGUIIcon(iconName);
+		cachedIcon = getGUIIcon(iconName);
+		return cachedIcon;
 	}
 
 	HSpriteTexture BuiltinEditorResources::getToolbarIcon(ToolbarIcon icon) const
@@ -636,47 +686,30 @@ namespace bs
 
 	HSpriteTexture BuiltinEditorResources::getLogMessageIcon(LogMessageIcon icon, UINT32 size, bool dark) const
 	{
-		if (size < 24) // Round to 16
-		{
-			if (dark)
-			{
-				switch (icon)
-				{
-				case LogMessageIcon::Info:
-					return getGUIIcon("IconInfoDark.png");
-				case LogMessageIcon::Warning:
-					return getGUIIcon("IconWarningDark.png");
-				case LogMessageIcon::Error:
-					return getGUIIcon("IconErrorDark.png");
-				}
-			}
-			else
-			{
-				switch (icon)
-				{
-				case LogMessageIcon::Info:
-					return getGUIIcon("IconInfo.png");
-				case LogMessageIcon::Warning:
-					return getGUIIcon("IconWarning.png");
-				case LogMessageIcon::Error:
-					return getGUIIcon("IconError.png");
-				}
-			}
-		}
-		else // Round to 32
+		const UINT32 iconIdx = (UINT32)icon;
+		if (iconIdx >= NUM_LOG_MESSAGE_ICONS)
+			return HSpriteTexture();
+
+		// Round to 16 (light or dark), or to 32
+		UINT32 variantIdx;
+		if (size < 24)
+			variantIdx = dark ? 1 : 0;
+		else
+			variantIdx = 2;
+
+		HSpriteTexture& cachedIcon = mLogMessageIcons[iconIdx][variantIdx];
+		if (cachedIcon)
+			return cachedIcon;
+
+		static const char* ICON_NAMES[NUM_LOG_MESSAGE_ICONS][NUM_LOG_MESSAGE_ICON_VARIANTS] =
 		{
-			switch (icon)
-			{
-			case LogMessageIcon::Info:
-				return getGUIIcon("IconInfo32.png");
-			case LogMessageIcon::Warning:
-				return getGUIIcon("IconWarning32.png");
-			case LogMessageIcon::Error:
-				return getGUIIcon("IconError32.png");
-			}
-		}
+			{ "IconInfo.png", "IconInfoDark.png", "IconInfo32.png" },
+			{ "IconWarning.png", "IconWarningDark.png", "IconWarning32.png" },
+			{ "IconError.png", "IconErrorDark.png", "IconError32.png" }
+		};
 
-		return HSpriteTexture();
+		cachedIcon = getGUIIcon(ICON_NAMES[iconIdx][variantIdx]);
+		return cachedIcon;
 	}
 
 	HSpriteTexture BuiltinEditorResources::getSprite(EditorSprites sprite)
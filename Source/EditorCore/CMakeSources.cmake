@@ -9,6 +9,8 @@ set(BS_BANSHEEEDITOR_SRC_LIBRARY
 	"Library/BsProjectLibraryEntries.cpp"
 	"Library/BsProjectResourceMeta.cpp"
 	"Library/BsEditorShaderIncludeHandler.cpp"
+	"Library/BsImportWorkerPool.cpp"
+	"Library/BsResourceReferenceIndex.cpp"
 )
 
 set(BS_BANSHEEEDITOR_INC_EDITORWINDOW
@@ -34,6 +36,8 @@ set(BS_BANSHEEEDITOR_INC_SCENE
 	"Scene/BsSelection.h"
 	"Scene/BsSelectionRenderer.h"
 	"Scene/BsSerializedSceneObject.h"
+	"Scene/BsPrefabInstanceIndex.h"
+	"Scene/BsSceneSearchIndex.h"
 )
 
 set(BS_BANSHEEEDITOR_SRC_GUI
@@ -77,6 +81,8 @@ set(BS_BANSHEEEDITOR_INC_LIBRARY
 	"Library/BsProjectLibraryEntries.h"
 	"Library/BsProjectResourceMeta.h"
 	"Library/BsEditorShaderIncludeHandler.h"
+	"Library/BsImportWorkerPool.h"
+	"Library/BsResourceReferenceIndex.h"
 )
 
 set(BS_BANSHEEEDITOR_INC_GUI
@@ -131,6 +137,8 @@ set(BS_BANSHEEEDITOR_INC_UNDOREDO
 set(BS_BANSHEEEDITOR_INC_RTTI
 	"Private/RTTI/BsPlatformInfoRTTI.h"
 	"Private/RTTI/BsBuildDataRTTI.h"
+	"Private/RTTI/BsBuildManifestRTTI.h"
+	"Private/RTTI/BsResourceReferenceIndexRTTI.h"
 	"Private/RTTI/BsDockManagerLayoutRTTI.h"
 	"Private/RTTI/BsEditorWidgetLayoutRTTI.h"
 	"Private/RTTI/BsProjectLibraryEntriesRTTI.h"
@@ -152,6 +160,8 @@ set(BS_BANSHEEEDITOR_SRC_SCENE
 	"Scene/BsScenePicking.cpp"
 	"Scene/BsSceneGrid.cpp"
 	"Scene/BsSerializedSceneObject.cpp"
+	"Scene/BsPrefabInstanceIndex.cpp"
+	"Scene/BsSceneSearchIndex.cpp"
 )
 
 set(BS_BANSHEEEDITOR_INC_NOFILTER
@@ -174,6 +184,8 @@ set(BS_BANSHEEEDITOR_INC_HANDLES
 set(BS_BANSHEEEDITOR_SRC_UTILITY
 	"Utility/BsEditorUtility.cpp"
 	"Utility/BsSplashScreen.cpp"
+	"Utility/BsEditorProfiler.cpp"
+	"Utility/BsEditorRenderPacket.cpp"
 )
 
 set(BS_BANSHEEEDITOR_SRC_EDITORWINDOW
@@ -196,6 +208,9 @@ set(BS_BANSHEEEDITOR_INC_UTILITY
 	"Utility/BsEditorUtility.h"
 	"Utility/BsBuiltinEditorResources.h"
 	"Utility/BsSplashScreen.h"
+	"Utility/BsChildProcess.h"
+	"Utility/BsEditorProfiler.h"
+	"Utility/BsEditorRenderPacket.h"
 )
 
 set(BS_BANSHEEEDITOR_SRC_TESTING
@@ -222,11 +237,13 @@ set(BS_BANSHEEEDITOR_SRC_UNDOREDO
 
 set(BS_BANSHEEEDITOR_INC_BUILD
 	"Build/BsBuildManager.h"
+	"Build/BsBuildManifest.h"
 	"Build/BsPlatformInfo.h"
 )
 
 set(BS_BANSHEEEDITOR_SRC_BUILD
 	"Build/BsBuildManager.cpp"
+	"Build/BsBuildManifest.cpp"
 	"Build/BsBuiltinEditorResources.cpp"
 	"Build/BsPlatformInfo.cpp"
 )
@@ -264,15 +281,18 @@ set(BS_BANSHEEEDITOR_INC_WIN32
 set(BS_BANSHEEEDITOR_SRC_WIN32
 	"Private/Win32/BsVSCodeEditor.cpp"
 	"Private/Win32/BsWin32BrowseDialogs.cpp"
+	"Private/Win32/BsWin32ChildProcess.cpp"
 	"Private/Win32/BsEditorWin32Resource.rc"
 )
 
 set(BS_BANSHEEEDITOR_SRC_LINUX
 	"Private/Linux/BsLinuxBrowseDialogs.cpp"
+	"Private/Unix/BsUnixChildProcess.cpp"
 )
 
 set(BS_BANSHEEEDITOR_SRC_MACOS
 	"Private/MacOS/BsMacOSBrowseDialogs.mm"
+	"Private/Unix/BsUnixChildProcess.cpp"
 	)
 
 if(WIN32)
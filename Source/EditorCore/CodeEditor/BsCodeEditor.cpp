@@ -7,6 +7,8 @@
 #include "Resources/BsScriptCodeImportOptions.h"
 #include "Build/BsBuildManager.h"
 #include "CodeEditor/BsMDCodeEditor.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Utility/BsEditorProfiler.h"
 
 #if BS_PLATFORM == BS_PLATFORM_WIN32
 #include "Private/Win32/BsVSCodeEditor.h"
@@ -17,8 +19,28 @@
 namespace bs
 {
 	CodeEditorManager::CodeEditorManager()
-		:mActiveEditor(nullptr), mActiveEditorType(CodeEditorType::None)
+		:mActiveEditor(nullptr), mActiveEditorType(CodeEditorType::None), mPreferredEditorType(CodeEditorType::None)
+		, mHasPreferredEditor(false)
 	{
+		mDetectTask = Task::create("CodeEditorDetection", std::bind(&CodeEditorManager::detectEditors, this));
+		TaskScheduler::instance().addTask(mDetectTask);
+	}
+
+	CodeEditorManager::~CodeEditorManager()
+	{
+		waitUntilDetected();
+
+		for (auto& factory : mFactories)
+			bs_delete(factory);
+
+		if (mActiveEditor != nullptr)
+			bs_delete(mActiveEditor);
+	}
+
+	void CodeEditorManager::detectEditors()
+	{
+		BS_ED_PROFILE_SCOPE("CodeEditorManager::detectEditors");
+
 #if BS_PLATFORM == BS_PLATFORM_WIN32
 		VSCodeEditorFactory* vsCodeEditorFactory = bs_new<VSCodeEditorFactory>();
 		Vector<CodeEditorType> vsEditors = vsCodeEditorFactory->getAvailableEditors();
@@ -45,17 +67,26 @@ namespace bs
 		mFactories.push_back(mdCodeEditorFactory);
 	}
 
-	CodeEditorManager::~CodeEditorManager()
+	void CodeEditorManager::waitUntilDetected() const
 	{
-		for (auto& factory : mFactories)
-			bs_delete(factory);
+		if (mDetectTask->isComplete())
+			return;
 
-		if (mActiveEditor != nullptr)
-			bs_delete(mActiveEditor);
+		BS_ED_PROFILE_SCOPE("CodeEditorManager::waitUntilDetected");
+		mDetectTask->wait();
+	}
+
+	const Vector<CodeEditorType>& CodeEditorManager::getAvailableEditors() const
+	{
+		waitUntilDetected();
+		return mEditors;
 	}
 
 	void CodeEditorManager::setActive(CodeEditorType editor)
 	{
+		waitUntilDetected();
+		mHasPreferredEditor = false;
+
 		if (mActiveEditor != nullptr)
 		{
 			bs_delete(mActiveEditor);
@@ -70,8 +101,44 @@ namespace bs
 		mActiveEditorType = editor;
 	}
 
-	void CodeEditorManager::openFile(const Path& path, UINT32 lineNumber) const
+	void CodeEditorManager::setPreferred(CodeEditorType editor)
+	{
+		mPreferredEditorType = editor;
+		mHasPreferredEditor = true;
+	}
+
+	void CodeEditorManager::applyPreferred()
+	{
+		if (!mHasPreferredEditor)
+			return;
+
+		waitUntilDetected();
+
+		CodeEditorType editor = mPreferredEditorType;
+		if (std::find(mEditors.begin(), mEditors.end(), editor) == mEditors.end())
+		{
+			if (mEditors.empty())
+			{
+				mHasPreferredEditor = false;
+				return;
+			}
+
+			editor = mEditors[0];
+		}
+
+		setActive(editor);
+	}
+
+	CodeEditorType CodeEditorManager::getActive()
 	{
+		applyPreferred();
+		return mActiveEditorType;
+	}
+
+	void CodeEditorManager::openFile(const Path& path, UINT32 lineNumber)
+	{
+		applyPreferred();
+
 		if (mActiveEditor == nullptr)
 			return;
 
@@ -83,8 +150,10 @@ namespace bs
 	}
 
 	void CodeEditorManager::syncSolution(const String& gameProjectName, const CodeProjectReference& engineAssemblyRef, 
-			const CodeProjectReference& editorAssemblyRef) const
+			const CodeProjectReference& editorAssemblyRef)
 	{
+		applyPreferred();
+
 		if (mActiveEditor == nullptr)
 			return;
 
@@ -47,6 +47,10 @@ namespace bs
 	/**
 	 * Handles connectivity of the editor with external code editing tools. The system provides methods for interacting with
 	 * external tools but the exact tool used depends on the currently active setting.
+	 *
+	 * Detection of the installed code editors can be slow (e.g. querying installed Visual Studio instances), so it runs
+	 * on a worker thread when the manager is started, and is only waited on when the list of editors or the active editor
+	 * is first needed. Use setPreferred() to pick the active editor without waiting for detection.
 	 */
 	class BS_ED_EXPORT CodeEditorManager : public Module<CodeEditorManager>
 	{
@@ -55,7 +59,7 @@ namespace bs
 		~CodeEditorManager();
 
 		/**	Returns a list of all available code editors for this platform. */
-		const Vector<CodeEditorType>& getAvailableEditors() const { return mEditors; }
+		const Vector<CodeEditorType>& getAvailableEditors() const;
 
 		/**
 		 * Changes the active code editor. All further operations on this object will be executed using this editor. If the
@@ -63,8 +67,15 @@ namespace bs
 		 */
 		void setActive(CodeEditorType editor);
 
+		/**
+		 * Sets the code editor to activate once editor detection finishes. If the editor isn't available on this machine
+		 * the first available editor is activated instead. Unlike setActive() this doesn't wait for detection, and the
+		 * editor is only activated when the active editor is first needed. Overridden by any later call to setActive().
+		 */
+		void setPreferred(CodeEditorType editor);
+
 		/**	Returns the currently active code editor. */
-		CodeEditorType getActive() const { return mActiveEditorType; }
+		CodeEditorType getActive();
 
 		/**
 		 * Opens a code file in the active external editor. 
@@ -73,20 +84,32 @@ namespace bs
 		 *							The file should be part of a solution in the active editor.
 		 * @param[in]	lineNumber	Line number to focus on once the file is opened. Might not be supported by all editors.
 		 */
-		void openFile(const Path& path, UINT32 lineNumber) const;
+		void openFile(const Path& path, UINT32 lineNumber);
 
 		/**
 		 * Synchronizes all code files and assemblies in the active project and updates the project solution for the active
 		 * editor. Each project can only have one solution per editor.
 		 */
 		void syncSolution(const String& gameProjectName, const CodeProjectReference& engineAssemblyRef, 
-			const CodeProjectReference& editorAssemblyRef) const;
+			const CodeProjectReference& editorAssemblyRef);
 
 		/**	Returns the absolute path at which the external editor solution file should be stored. */
 		Path getSolutionPath() const;
 	private:
+		/** Creates the code editor factories and finds all the editors they support. Executed on a worker thread. */
+		void detectEditors();
+
+		/** Blocks until code editor detection started by the constructor finishes. */
+		void waitUntilDetected() const;
+
+		/** Activates the editor provided to setPreferred(), if any. Waits for editor detection to finish. */
+		void applyPreferred();
+
+		SPtr<Task> mDetectTask;
 		CodeEditor* mActiveEditor;
 		CodeEditorType mActiveEditorType;
+		CodeEditorType mPreferredEditorType;
+		bool mHasPreferredEditor;
 		Map<CodeEditorType, CodeEditorFactory*> mFactoryPerEditor;
 		Vector<CodeEditorType> mEditors;
 		Vector<CodeEditorFactory*> mFactories;
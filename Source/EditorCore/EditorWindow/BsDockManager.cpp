@@ -24,6 +24,7 @@
 #include "EditorWindow/BsEditorWindow.h"
 #include "GUI/BsGUIPanel.h"
 #include "CoreThread/BsCoreThread.h"
+#include "Utility/BsEditorRenderPacket.h"
 #include "Renderer/BsRendererUtility.h"
 
 using namespace std::placeholders;
@@ -492,9 +493,8 @@ namespace bs
 
 		HCamera camera = mParentWindow->getGUICamera();
 
-		ct::DockOverlayRenderer* renderer = mRenderer.get();
-		gCoreThread().queueCommand(std::bind(&ct::DockOverlayRenderer::updateData, renderer, camera->_getCamera()->getCore(),
-			mDropOverlayMesh->getCore(), mShowOverlay, mHighlightedDropLoc));
+		EditorRenderPacket::instance().queue(std::bind(&ct::DockOverlayRenderer::updateData, mRenderer,
+			camera->_getCamera()->getCore(), mDropOverlayMesh->getCore(), mShowOverlay, mHighlightedDropLoc));
 	}
 
 	void DockManager::insert(EditorWidgetContainer* relativeTo, EditorWidgetBase* widgetToInsert, DockLocation location)
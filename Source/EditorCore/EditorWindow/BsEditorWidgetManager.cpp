@@ -14,6 +14,7 @@
 #include "Managers/BsRenderWindowManager.h"
 #include "Math/BsVector2I.h"
 #include "CoreThread/BsCoreThread.h"
+#include "Utility/BsEditorProfiler.h"
 
 using namespace std::placeholders;
 
@@ -48,6 +49,8 @@ namespace bs
 
 	void EditorWidgetManager::update()
 	{
+		BS_ED_PROFILE_SCOPE("EditorWidgetManager::update");
+
 		if (gInput().isPointerButtonDown(PointerEventButton::Left) || gInput().isPointerButtonDown(PointerEventButton::Right))
 		{
 			for (auto& widgetData : mActiveWidgets)
@@ -14,9 +14,70 @@ namespace bs
 {
 	static constexpr int LINE_SPLIT_WIDTH = 2;
 	static constexpr int TANGENT_LINE_DISTANCE = 30;
+	static constexpr UINT32 SAMPLES_PER_COLUMN = 4;
 	static constexpr Color COLOR_MID_GRAY = Color(90.0f / 255.0f, 90.0f / 255.0f, 90.0f / 255.0f, 1.0f);
 	static constexpr Color COLOR_DARK_GRAY = Color(40.0f / 255.0f, 40.0f / 255.0f, 40.0f / 255.0f, 1.0f);
 
+	/** Polynomial form of a single curve segment, allowing it to be evaluated without searching for keyframes. */
+	struct CurveSegment
+	{
+		float start = 0.0f;
+		float invLength = 0.0f;
+		float a = 0.0f, b = 0.0f, c = 0.0f, d = 0.0f;
+
+		float evaluate(float time) const
+		{
+			const float t = (time - start) * invLength;
+			return ((a * t + b) * t + c) * t + d;
+		}
+	};
+
+	/**
+	 * Returns a segment of the curve ending at the keyframe with the specified index. Index 0 and indices past the last
+	 * keyframe return a constant segment, same as evaluating a non-looping curve out of its range.
+	 */
+	static CurveSegment getCurveSegment(const Vector<TKeyframe<float>>& keyframes, UINT32 idx)
+	{
+		CurveSegment segment;
+		if (idx == 0)
+		{
+			segment.d = keyframes[0].value;
+			return segment;
+		}
+
+		if (idx >= (UINT32)keyframes.size())
+		{
+			segment.d = keyframes.back().value;
+			return segment;
+		}
+
+		const TKeyframe<float>& lhs = keyframes[idx - 1];
+		const TKeyframe<float>& rhs = keyframes[idx];
+
+		segment.d = lhs.value;
+
+		const float length = rhs.time - lhs.time;
+		const bool isStep = lhs.outTangent == std::numeric_limits<float>::infinity() ||
+			rhs.inTangent == std::numeric_limits<float>::infinity();
+
+		if (isStep || Math::approxEquals(length, 0.0f))
+			return segment;
+
+		// Cubic Hermite basis expanded into polynomial coefficients, tangents scaled since the segment isn't unit length
+		const float p0 = lhs.value;
+		const float p1 = rhs.value;
+		const float m0 = lhs.outTangent * length;
+		const float m1 = rhs.inTangent * length;
+
+		segment.start = lhs.time;
+		segment.invLength = 1.0f / length;
+		segment.a = 2.0f * p0 + m0 - 2.0f * p1 + m1;
+		segment.b = -3.0f * p0 - 2.0f * m0 + 3.0f * p1 - m1;
+		segment.c = m0;
+
+		return segment;
+	}
+
 	GUICurves::GUICurves(CurveDrawOptions drawOptions, const String& styleName, const GUIDimensions& dimensions)
 		:GUITimeline(styleName, dimensions), mDrawOptions(drawOptions), mTickHandler(GUITickStepType::Time)
 	{ }
@@ -56,6 +117,10 @@ namespace bs
 			return;
 
 		mCurves = curves;
+
+		mCurveColumns.clear();
+		mCurveColumns.resize(mCurves.size());
+
 		_markContentAsDirty();
 	}
 
@@ -107,18 +172,25 @@ namespace bs
 		if (!pixelToCurveSpace(pixelCoords, curveCoords, true))
 			return (UINT32)-1;
 
-		const float time = curveCoords.x;
-
 		float nearestDistance = std::numeric_limits<float>::max();
 		auto curveIdx = (UINT32)-1;
 		for (UINT32 i = 0; i < (UINT32)mCurves.size(); i++)
 		{
-			const TAnimationCurve<float>& curve = mCurves[i].curve;
+			const Vector<CurveColumn>& columns = getCurveColumns(i);
+			if (pixelCoords.x >= (INT32)columns.size())
+				continue;
+
+			// Distance to the range of values the curve covers in the column under the pointer
+			const CurveColumn& column = columns[pixelCoords.x];
+			const INT32 top = curveToPixelSpace(Vector2(mOffset, column.max)).y;
+			const INT32 bottom = curveToPixelSpace(Vector2(mOffset, column.min)).y;
 
-			const float value = curve.evaluate(time, false);
-			const Vector2I curPixelPos = curveToPixelSpace(Vector2(time, value));
+			float distanceToKey = 0.0f;
+			if (pixelCoords.y < top)
+				distanceToKey = (float)(top - pixelCoords.y);
+			else if (pixelCoords.y > bottom)
+				distanceToKey = (float)(pixelCoords.y - bottom);
 
-			const auto distanceToKey = (float)pixelCoords.manhattanDist(curPixelPos);
 			if (distanceToKey < nearestDistance)
 			{
 				nearestDistance = distanceToKey;
@@ -391,101 +463,159 @@ namespace bs
 		}
 	}
 
-	void GUICurves::drawCurve(const TAnimationCurve<float>& curve, const Color& color)
+	void GUICurves::drawCurve(UINT32 curveIdx, const Color& color)
 	{
-		const float range = getRangeWithPadding();
-		const float widthPerPixel = range / getDrawableWidth();
-		const float heightPerPixel = mYRange / mLayoutData.area.height;
-
-		const Vector<TKeyframe<float>>& keyframes = curve.getKeyFrames();
+		const Vector<TKeyframe<float>>& keyframes = mCurves[curveIdx].curve.getKeyFrames();
 		if (keyframes.empty())
 			return;
 
+		const Vector2I firstKeyPixel = curveToPixelSpace(Vector2(keyframes.front().time, keyframes.front().value));
+		const Vector2I lastKeyPixel = curveToPixelSpace(Vector2(keyframes.back().time, keyframes.back().value));
+
 		// Draw start line
 		{
-			const float curveStart = keyframes[0].time;
-			const float curveValue = curve.evaluate(curveStart, false);
+			const Vector2I start = Vector2I(-(INT32)mPadding, firstKeyPixel.y);
 
-			const Vector2I end = curveToPixelSpace(Vector2(curveStart, curveValue));
-			const Vector2I start = Vector2I(-(INT32)mPadding, end.y);
-
-			if (start.x < end.x)
-				mCanvas->drawLine(start, end, COLOR_MID_GRAY);
+			if (start.x < firstKeyPixel.x)
+				mCanvas->drawLine(start, firstKeyPixel, COLOR_MID_GRAY);
 		}
 
-		Vector<Vector2I> linePoints;
+		// Draw in between keyframes, using the value range in each pixel column. This keeps the number of drawn points
+		// proportional to the element width, regardless of the number of keyframes.
+		const Vector<CurveColumn>& columns = getCurveColumns(curveIdx);
 
-		// Draw in between keyframes
-		const float startVisibleTime = mOffset;
-		const float endVisibleTime = startVisibleTime + range;
-		for (INT32 i = 0; i < (INT32)keyframes.size() - 1; i++)
-		{
-			const float start = keyframes[i].time;
-			const float end = keyframes[i + 1].time;
+		const INT32 firstColumn = std::max(firstKeyPixel.x + 1, 0);
+		const INT32 lastColumn = std::min(lastKeyPixel.x - 1, (INT32)columns.size() - 1);
 
-			if (end < startVisibleTime || start > endVisibleTime)
-				continue;
+		Vector<Vector2I> linePoints;
+		linePoints.push_back(firstKeyPixel);
 
-			const bool isStep = keyframes[i].outTangent == std::numeric_limits<float>::infinity() ||
-				keyframes[i + 1].inTangent == std::numeric_limits<float>::infinity();
+		for (INT32 i = firstColumn; i <= lastColumn; i++)
+		{
+			const CurveColumn& column = columns[i];
+			const INT32 top = curveToPixelSpace(Vector2(mOffset, column.max)).y;
+			const INT32 bottom = curveToPixelSpace(Vector2(mOffset, column.min)).y;
 
-			// If step tangent, draw the required lines without sampling, as the sampling will miss the step
-			if (isStep)
+			if (top == bottom)
+				linePoints.push_back(Vector2I(i, top));
+			else if (column.start <= column.end)
 			{
-				const float startValue = curve.evaluate(start, false);
-				const float endValue = curve.evaluate(end, false);
-
-				linePoints.push_back(curveToPixelSpace(Vector2(start, startValue)));
-				linePoints.push_back(curveToPixelSpace(Vector2(end, startValue)));
-				linePoints.push_back(curveToPixelSpace(Vector2(end, endValue)));
+				linePoints.push_back(Vector2I(i, bottom));
+				linePoints.push_back(Vector2I(i, top));
 			}
-			else // Draw normally
+			else
 			{
-				const float startValue = keyframes[i].value;
-				const float endValue = keyframes[i + 1].value;
+				linePoints.push_back(Vector2I(i, top));
+				linePoints.push_back(Vector2I(i, bottom));
+			}
+		}
 
-				Vector2I startPixel = curveToPixelSpace(Vector2(start, startValue));
-				Vector2I endPixel = curveToPixelSpace(Vector2(end, endValue));
+		linePoints.push_back(lastKeyPixel);
 
-				const UINT32 distance = startPixel.manhattanDist(endPixel);
+		if (keyframes.size() > 1)
+			mCanvas->drawPolyLine(linePoints, color);
 
-				INT32 numSplits;
-				float splitIncrement;
-				if (distance > 0)
-				{
-					const float fNumSplits = distance / (float)LINE_SPLIT_WIDTH;
+		// Draw end line
+		{
+			const Vector2I end = Vector2I(mLayoutData.area.width, lastKeyPixel.y);
 
-					numSplits = Math::ceilToInt(fNumSplits) + 1;
-					splitIncrement = (end - start) / (float)numSplits;
-				}
-				else
-				{
-					numSplits = 1;
-					splitIncrement = 0.0f;
-				}
+			if (lastKeyPixel.x < end.x)
+				mCanvas->drawLine(lastKeyPixel, end, COLOR_MID_GRAY);
+		}
+	}
 
-				for (int j = 0; j < numSplits; j++)
-				{
-					const float t = std::min(start + j * splitIncrement, end);
-					const float value = curve.evaluate(t, false);
+	const Vector<GUICurves::CurveColumn>& GUICurves::getCurveColumns(UINT32 curveIdx)
+	{
+		const float range = getRange();
+		const UINT32 drawableWidth = getDrawableWidth();
 
-					linePoints.push_back(curveToPixelSpace(Vector2(t, value)));
-				}
-			}
+		if (mSampledOffset != mOffset || mSampledRange != range || mSampledWidth != mLayoutData.area.width ||
+			mSampledDrawableWidth != drawableWidth)
+		{
+			for (auto& entry : mCurveColumns)
+				entry.clear();
+
+			mSampledOffset = mOffset;
+			mSampledRange = range;
+			mSampledWidth = mLayoutData.area.width;
+			mSampledDrawableWidth = drawableWidth;
 		}
 
-		mCanvas->drawPolyLine(linePoints, color);
+		Vector<CurveColumn>& columns = mCurveColumns[curveIdx];
+		if (columns.empty())
+			sampleCurve(mCurves[curveIdx].curve, columns);
 
-		// Draw end line
+		return columns;
+	}
+
+	void GUICurves::sampleCurve(const TAnimationCurve<float>& curve, Vector<CurveColumn>& columns) const
+	{
+		const UINT32 numColumns = mLayoutData.area.width;
+		columns.resize(numColumns);
+
+		const Vector<TKeyframe<float>>& keyframes = curve.getKeyFrames();
+		if (keyframes.empty())
 		{
-			const float curveEnd = keyframes[keyframes.size() - 1].time;
-			const float curveValue = curve.evaluate(curveEnd, false);
+			for (auto& column : columns)
+				column = { 0.0f, 0.0f, 0.0f, 0.0f };
 
-			const Vector2I start = curveToPixelSpace(Vector2(curveEnd, curveValue));
-			const Vector2I end = Vector2I(mLayoutData.area.width, start.y);
+			return;
+		}
+
+		const float timePerPixel = getRange() / getDrawableWidth();
+		const float timePerSample = timePerPixel / SAMPLES_PER_COLUMN;
+		const float startTime = mOffset - mPadding * timePerPixel;
+
+		// Index of the first keyframe past the current time, the sweep only ever moves it forward
+		auto keyIdx = (UINT32)(std::upper_bound(keyframes.begin(), keyframes.end(), startTime,
+			[](float time, const TKeyframe<float>& keyframe) { return time < keyframe.time; }) - keyframes.begin());
+
+		CurveSegment segment = getCurveSegment(keyframes, keyIdx);
+		for (UINT32 i = 0; i < numColumns; i++)
+		{
+			const float columnStart = startTime + i * timePerPixel;
+			const float columnEnd = columnStart + timePerPixel;
+
+			CurveColumn& column = columns[i];
+			column.start = segment.evaluate(columnStart);
+
+			if (keyIdx < (UINT32)keyframes.size() && keyframes[keyIdx].time <= columnEnd)
+			{
+				// Keyframes within the column, their values cover the extremes well enough. This is also where dense
+				// curves get decimated, as all the keyframes are folded into a single column.
+				column.min = column.start;
+				column.max = column.start;
+
+				while (keyIdx < (UINT32)keyframes.size() && keyframes[keyIdx].time <= columnEnd)
+				{
+					column.min = std::min(column.min, keyframes[keyIdx].value);
+					column.max = std::max(column.max, keyframes[keyIdx].value);
+					keyIdx++;
+				}
 
-			if (start.x < end.x)
-				mCanvas->drawLine(start, end, COLOR_MID_GRAY);
+				segment = getCurveSegment(keyframes, keyIdx);
+				column.end = segment.evaluate(columnEnd);
+			}
+			else
+			{
+				// Whole column is within a single segment, sample it in one batch
+				float values[SAMPLES_PER_COLUMN + 1];
+				for (UINT32 j = 0; j <= SAMPLES_PER_COLUMN; j++)
+					values[j] = segment.evaluate(columnStart + j * timePerSample);
+
+				column.end = values[SAMPLES_PER_COLUMN];
+				column.min = values[0];
+				column.max = values[0];
+
+				for (UINT32 j = 1; j <= SAMPLES_PER_COLUMN; j++)
+				{
+					column.min = std::min(column.min, values[j]);
+					column.max = std::max(column.max, values[j]);
+				}
+			}
+
+			column.min = std::min(column.min, column.end);
+			column.max = std::max(column.max, column.end);
 		}
 	}
 
@@ -799,16 +929,23 @@ namespace bs
 
 		// Draw curves
 		const bool drawKeyframes = mDrawOptions.isSet(CurveDrawOption::DrawKeyframes);
+		// Keyframes outside of the element (including the size of the keyframe diamond) don't need to be drawn
+		const float timePerPixel = getRange() / getDrawableWidth();
+		const float startVisibleTime = mOffset - (mPadding + 3) * timePerPixel;
+		const float endVisibleTime = startVisibleTime + (mLayoutData.area.width + 6) * timePerPixel;
 		for (UINT32 i = 0; i < curvesToDraw; i++)
 		{
-			drawCurve(mCurves[i].curve, mCurves[i].color);
+			drawCurve(i, mCurves[i].color);
 
 			// Draw keyframes
 			if (drawKeyframes)
 			{
-				const Vector<TKeyframe<float>> keyframes = mCurves[i].curve.getKeyFrames();
+				const Vector<TKeyframe<float>>& keyframes = mCurves[i].curve.getKeyFrames();
 				for (UINT32 j = 0; j < (UINT32)keyframes.size(); j++)
 				{
+					if (keyframes[j].time < startVisibleTime || keyframes[j].time > endVisibleTime)
+						continue;
+
 					const bool selected = isSelected(i, j);
 					drawKeyframe(keyframes[j].time, keyframes[j].value, selected);
 				}
@@ -274,10 +274,10 @@ namespace bs
 		/**
 		 * Draws the curve using the provided color.
 		 *
-		 * @param[in]	curve		Curve to draw within the currently set range.
+		 * @param[in]	curveIdx	Index of the curve to draw within the currently set range.
 		 * @param[in]	color		Color to draw the curve with.	
 		 */
-		void drawCurve(const TAnimationCurve<float>& curve, const Color& color);
+		void drawCurve(UINT32 curveIdx, const Color& color);
 
 		/*
 		 * Draws the area between two curves using the provided color.
@@ -294,6 +294,15 @@ namespace bs
 		bool _mouseEvent(const GUIMouseEvent& ev) override;
 
 	private:
+		/** Range of values a curve takes within a single pixel column. */
+		struct CurveColumn
+		{
+			float min;
+			float max;
+			float start; /**< Value at the left edge of the column. */
+			float end; /**< Value at the right edge of the column. */
+		};
+
 		/** Information about a currently selected keyframe. */
 		struct SelectedKeyframe
 		{
@@ -305,9 +314,27 @@ namespace bs
 			TangentMode tangentMode;
 		};
 
+		/**
+		 * Returns per-pixel column values of the curve at the specified index, for the currently visible range. Values
+		 * are cached until the curves, the visible range or the element width change.
+		 */
+		const Vector<CurveColumn>& getCurveColumns(UINT32 curveIdx);
+
+		/**
+		 * Samples the curve over all pixel columns of the element in a single forward pass over its keyframes, recording
+		 * the range of values the curve takes within each column.
+		 */
+		void sampleCurve(const TAnimationCurve<float>& curve, Vector<CurveColumn>& columns) const;
+
 		Vector<CurveDrawInfo> mCurves;
 		Vector<SelectedKeyframe> mSelectedKeyframes;
 
+		Vector<Vector<CurveColumn>> mCurveColumns;
+		float mSampledOffset = 0.0f;
+		float mSampledRange = 0.0f;
+		UINT32 mSampledWidth = 0;
+		UINT32 mSampledDrawableWidth = 0;
+
 		float mYRange = 20.0f;
 		float mYOffset = 0.0f;
 		CurveDrawOptions mDrawOptions;
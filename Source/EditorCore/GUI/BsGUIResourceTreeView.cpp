@@ -37,13 +37,14 @@ namespace bs
 	{
 		ResourceTreeViewLocator::_provide(this);
 
-		gProjectLibrary().onEntryAdded.connect(std::bind(&GUIResourceTreeView::entryAdded, this, _1));
-		gProjectLibrary().onEntryRemoved.connect(std::bind(&GUIResourceTreeView::entryRemoved, this, _1));
+		mEntriesChangedConn = gProjectLibrary().onEntriesChanged.connect(
+			std::bind(&GUIResourceTreeView::entriesChanged, this, _1, _2));
 
 		const ProjectLibrary::LibraryEntry* rootEntry = gProjectLibrary().getRootEntry().get();
 
 		mRootElement.mFullPath = rootEntry->path;
 		mRootElement.mElementName = mRootElement.mFullPath.getTail();
+		mElementLookup[mRootElement.mFullPath] = &mRootElement;
 
 		expandElement(&mRootElement);
 
@@ -52,12 +53,14 @@ namespace bs
 
 	GUIResourceTreeView::~GUIResourceTreeView()
 	{
+		mEntriesChangedConn.disconnect();
 		clearDropTarget();
 
 		for(auto& child : mRootElement.mChildren)
-			deleteTreeElement((ResourceTreeElement*)&child);
+			destroyTreeElement(static_cast<ResourceTreeElement*>(child));
 
 		mRootElement.mChildren.clear();
+		mElementLookup.clear();
 
 		ResourceTreeViewLocator::_provide(nullptr);
 	}
@@ -158,6 +161,7 @@ namespace bs
 		newChild->mElementName = fullPath.getTail();
 
 		parent->mChildren.push_back(newChild);
+		mElementLookup[fullPath] = newChild;
 
 		updateElementGUI(parent);
 		updateElementGUI(newChild);
@@ -165,12 +169,10 @@ namespace bs
 		return newChild;
 	}
 
-	void GUIResourceTreeView::deleteTreeElement(ResourceTreeElement* element)
+	void GUIResourceTreeView::destroyTreeElement(ResourceTreeElement* element)
 	{
-		closeTemporarilyExpandedElements(); // In case this element is one of them
-
 		for(auto& child : element->mChildren)
-			deleteTreeElement((ResourceTreeElement*)child);
+			destroyTreeElement(static_cast<ResourceTreeElement*>(child));
 
 		element->mChildren.clear();
 
@@ -180,18 +182,11 @@ namespace bs
 		if(element->mIsSelected)
 			unselectElement(element);
 
-		if(element->mParent != nullptr)
-		{
-			auto iterFind = std::find(element->mParent->mChildren.begin(), element->mParent->mChildren.end(), element);
-			if(iterFind != element->mParent->mChildren.end())
-				element->mParent->mChildren.erase(iterFind);
-
-			sortTreeElement(static_cast<ResourceTreeElement*>(element->mParent));
-			updateElementGUI(element->mParent);
-		}
-
 		if(&mRootElement != element)
+		{
+			mElementLookup.erase(element->mFullPath);
 			bs_delete(element);
+		}
 	}
 
 	void GUIResourceTreeView::sortTreeElement(ResourceTreeElement* element)
@@ -213,6 +208,12 @@ namespace bs
 
 	GUIResourceTreeView::ResourceTreeElement* GUIResourceTreeView::findTreeElement(const Path& fullPath)
 	{
+		auto iterFind = mElementLookup.find(fullPath);
+		if (iterFind != mElementLookup.end())
+			return iterFind->second;
+
+		// Path might be in a different form than the one reported by the library (e.g. a folder referenced as a file), 
+		// fall back to matching it element by element
 		if (!mRootElement.mFullPath.includes(fullPath))
 			return nullptr;
 
@@ -252,30 +253,97 @@ namespace bs
 		return nullptr;
 	}
 
-	void GUIResourceTreeView::entryAdded(const Path& path)
+	void GUIResourceTreeView::entriesChanged(const Vector<Path>& added, const Vector<Path>& removed)
 	{
-		Path parentPath = path.getParent();
+		closeTemporarilyExpandedElements(); // In case one of the removed elements is one of them
+
+		// Parents whose children changed, each is sorted only once after all the changes are applied
+		UnorderedSet<ResourceTreeElement*> dirtyParents;
 
-		ResourceTreeElement* parentElement = findTreeElement(parentPath);
-		assert(parentElement != nullptr);
+		if(!removed.empty())
+		{
+			UnorderedSet<ResourceTreeElement*> removedElements;
+			for(auto& path : removed)
+			{
+				// Might not exist if the entry was added and removed before we were notified
+				auto iterFind = mElementLookup.find(path);
+				if(iterFind != mElementLookup.end() && iterFind->second != &mRootElement)
+					removedElements.insert(iterFind->second);
+			}
 
-		ResourceTreeElement* newElement = addTreeElement(parentElement, path);
-		sortTreeElement(parentElement);
+			// Elements whose parents are also being removed will get destroyed along with their parents
+			for(auto& element : removedElements)
+			{
+				bool parentRemoved = false;
+				for(TreeElement* parent = element->mParent; parent != nullptr; parent = parent->mParent)
+				{
+					if(removedElements.find(static_cast<ResourceTreeElement*>(parent)) != removedElements.end())
+					{
+						parentRemoved = true;
+						break;
+					}
+				}
 
-		ProjectLibrary::LibraryEntry* libEntry = gProjectLibrary().findEntry(path).get();
-		
-		assert(libEntry != nullptr);
-		updateFromProjectLibraryEntry(newElement, libEntry);
+				if(!parentRemoved)
+					dirtyParents.insert(static_cast<ResourceTreeElement*>(element->mParent));
+			}
 
-		_markLayoutAsDirty();
-	}
+			auto isKept = [&removedElements](TreeElement* element)
+			{
+				return removedElements.find(static_cast<ResourceTreeElement*>(element)) == removedElements.end();
+			};
 
-	void GUIResourceTreeView::entryRemoved(const Path& path)
-	{
-		ResourceTreeElement* treeElement = findTreeElement(path);
-		
-		if(treeElement != nullptr)
-			deleteTreeElement(treeElement);
+			for(auto& parent : dirtyParents)
+			{
+				auto& children = parent->mChildren;
+				auto iterFirstRemoved = std::stable_partition(children.begin(), children.end(), isKept);
+
+				for(auto iter = iterFirstRemoved; iter != children.end(); ++iter)
+					destroyTreeElement(static_cast<ResourceTreeElement*>(*iter));
+
+				children.erase(iterFirstRemoved, children.end());
+			}
+		}
+
+		if(!added.empty())
+		{
+			// Add parents before their children, so children added along with their parent can be skipped
+			Vector<Path> sortedAdded = added;
+			auto getDepth = [](const Path& path)
+			{
+				return path.getNumDirectories() + (path.isFile() ? 1 : 0);
+			};
+
+			std::sort(sortedAdded.begin(), sortedAdded.end(), 
+				[&getDepth](const Path& a, const Path& b) { return getDepth(a) < getDepth(b); });
+
+			for(auto& path : sortedAdded)
+			{
+				if(mElementLookup.find(path) != mElementLookup.end())
+					continue;
+
+				// Might not exist if the entry was removed before we were notified
+				ProjectLibrary::LibraryEntry* libEntry = gProjectLibrary().findEntry(path).get();
+				if(libEntry == nullptr)
+					continue;
+
+				ResourceTreeElement* parentElement = findTreeElement(path.getParent());
+				assert(parentElement != nullptr);
+
+				ResourceTreeElement* newElement = addTreeElement(parentElement, path);
+				updateFromProjectLibraryEntry(newElement, libEntry);
+
+				dirtyParents.insert(parentElement);
+			}
+		}
+
+		for(auto& parent : dirtyParents)
+		{
+			sortTreeElement(parent);
+			updateElementGUI(parent);
+		}
+
+		_markLayoutAsDirty();
 	}
 
 	void GUIResourceTreeView::setDropTarget(RenderWindow* parentWindow, INT32 x, INT32 y, UINT32 width, UINT32 height)
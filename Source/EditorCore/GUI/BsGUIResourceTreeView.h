@@ -114,6 +114,9 @@ namespace bs
 		HEvent mDropTargetMoveConn;
 		HEvent mDropTargetLeaveConn;
 		HEvent mDropTargetDroppedConn;
+		HEvent mEntriesChangedConn;
+
+		UnorderedMap<Path, ResourceTreeElement*> mElementLookup;
 
 		GUIResourceTreeView(const String& backgroundStyle, const String& elementBtnStyle, const String& foldoutBtnStyle, 
 			const String& highlightBackgroundStyle, const String& selectionBackgroundStyle, const String& editBoxStyle,
@@ -172,8 +175,11 @@ namespace bs
 		 */
 		ResourceTreeElement* addTreeElement(ResourceTreeElement* parent, const Path& fullPath);
 
-		/**	Deletes the provided tree element. */
-		void deleteTreeElement(ResourceTreeElement* element);
+		/**
+		 * Releases the provided tree element and all of its children. Does not remove the element from its parent's list
+		 * of children.
+		 */
+		void destroyTreeElement(ResourceTreeElement* element);
 
 		/**	Sorts the children of the provided tree element by name. */
 		void sortTreeElement(ResourceTreeElement* element);
@@ -181,11 +187,11 @@ namespace bs
 		/** Attempts to find a tree element with the specified path. Returns null if one cannot be found. */
 		ResourceTreeElement* findTreeElement(const Path& fullPath);
 
-		/**	Called whenever a new entry is added to the project library. */
-		void entryAdded(const Path& path); 
-
-		/**	Called whenever an entry is removed from the project library. */
-		void entryRemoved(const Path& path);
+		/**
+		 * Called once per frame with all entries that were added to or removed from the project library. Each touched
+		 * directory is sorted only once, regardless of the number of changed entries it contains.
+		 */
+		void entriesChanged(const Vector<Path>& added, const Vector<Path>& removed);
 
 		/**
 		 * Sets an OS drag and drop target that allows this element to receive OS-specific drag and drop events originating
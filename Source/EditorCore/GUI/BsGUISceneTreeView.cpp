@@ -12,6 +12,7 @@
 #include "GUI/BsDragAndDropManager.h"
 #include "GUI/BsGUIResourceTreeView.h"
 #include "GUI/BsGUIContextMenu.h"
+#include "Utility/BsEditorProfiler.h"
 
 namespace bs
 {
@@ -34,7 +35,7 @@ namespace bs
 		const String& foldoutBtnStyle, const String& highlightBackgroundStyle, const String& selectionBackgroundStyle, 
 		const String& editBoxStyle, const String& dragHighlightStyle, const String& dragSepHighlightStyle, const GUIDimensions& dimensions)
 		:GUITreeView(backgroundStyle, elementBtnStyle, foldoutBtnStyle, highlightBackgroundStyle, selectionBackgroundStyle, editBoxStyle, dragHighlightStyle,
-		dragSepHighlightStyle, dimensions), mCutFlag(false)
+		dragSepHighlightStyle, dimensions), mCutFlag(false), mFilterDirty(false)
 	{
 		SceneTreeViewLocator::_provide(this);
 
@@ -173,8 +174,15 @@ namespace bs
 					newChild->mTint = isInternal ? Color::Red : (isPrefabInstance ? PREFAB_TINT : Color::White);
 					newChild->mIsPrefabInstance = isPrefabInstance;
 
+					for(auto& component : currentSOChild->getComponents())
+						newChild->mComponentIds.push_back(component->getInstanceId());
+
 					newChildren.push_back(newChild);
 
+					mSearchIndex.addObject(currentSOChild);
+					mElementsById[newChild->mId] = newChild;
+					mFilterDirty = true;
+
 					updateElementGUI(newChild);
 				}
 			}
@@ -196,11 +204,34 @@ namespace bs
 		}
 
 		// Check if name needs updating
+		bool needsReindex = false;
 		const String& name = element->mSceneObject->getName();
 		if(element->mName != name)
 		{
 			element->mName = name;
 			needsUpdate = true;	
+			needsReindex = true;
+		}
+
+		// Check if components were added, removed or replaced, as they're searchable by type
+		const Vector<HComponent>& components = element->mSceneObject->getComponents();
+		bool componentsChanged = element->mComponentIds.size() != components.size();
+		for(UINT32 i = 0; !componentsChanged && i < (UINT32)components.size(); i++)
+			componentsChanged = element->mComponentIds[i] != components[i]->getInstanceId();
+
+		if(componentsChanged)
+		{
+			element->mComponentIds.clear();
+			for(auto& component : components)
+				element->mComponentIds.push_back(component->getInstanceId());
+
+			needsReindex = true;
+		}
+
+		if(needsReindex && element != &mRootElement)
+		{
+			mSearchIndex.addObject(element->mSceneObject);
+			mFilterDirty = true;
 		}
 
 		// Check if active state needs updating
@@ -259,6 +290,8 @@ namespace bs
 
 	void GUISceneTreeView::updateTreeElementHierarchy()
 	{
+		BS_ED_PROFILE_SCOPE("GUISceneTreeView::updateTreeElementHierarchy");
+
 		HSceneObject root = gSceneManager().getMainScene()->getRoot();
 		mRootElement.mSceneObject = root;
 		mRootElement.mId = root->getInstanceId();
@@ -266,6 +299,52 @@ namespace bs
 		mRootElement.mIsExpanded = true;
 
 		updateTreeElement(&mRootElement);
+
+		if(mFilterDirty)
+			applyFilter();
+	}
+
+	void GUISceneTreeView::setFilter(const String& filter)
+	{
+		if(mFilter == filter)
+			return;
+
+		mFilter = filter;
+		applyFilter();
+	}
+
+	void GUISceneTreeView::applyFilter()
+	{
+		BS_ED_PROFILE_SCOPE("GUISceneTreeView::applyFilter");
+
+		mFilterDirty = false;
+
+		String query = mFilter;
+		StringUtil::trim(query);
+
+		if(query.empty())
+		{
+			if(!isFilterActive())
+				return;
+
+			clearFilter();
+
+			// Keep the selection in view once the full hierarchy is displayed again
+			for(auto& selectedElem : mSelectedElements)
+				expandToElement(selectedElem.element);
+
+			return;
+		}
+
+		Vector<TreeElement*> matches;
+		for(auto& instanceId : mSearchIndex.find(query))
+		{
+			auto iterFind = mElementsById.find(instanceId);
+			if(iterFind != mElementsById.end())
+				matches.push_back(iterFind->second);
+		}
+
+		setFilteredElements(matches);
 	}
 
 	void GUISceneTreeView::renameTreeElement(GUITreeView::TreeElement* element, const String& name)
@@ -303,6 +382,22 @@ namespace bs
 		if(element->mIsSelected)
 			unselectElement(element, false);
 
+		// A moved object might have already been registered by the element representing it under its new parent
+		SceneTreeElement* sceneTreeElement = static_cast<SceneTreeElement*>(element);
+		auto iterFind = mElementsById.find(sceneTreeElement->mId);
+		if(iterFind != mElementsById.end() && iterFind->second == sceneTreeElement)
+		{
+			mElementsById.erase(iterFind);
+			mSearchIndex.removeObject(sceneTreeElement->mId);
+		}
+
+		if(element->mInFilter)
+		{
+			mFilteredElements.erase(std::remove(mFilteredElements.begin(), mFilteredElements.end(), element),
+				mFilteredElements.end());
+		}
+
+		mFilterDirty = true;
 		bs_delete(element);
 	}
 
@@ -466,23 +561,12 @@ namespace bs
 
 	GUISceneTreeView::SceneTreeElement* GUISceneTreeView::findTreeElement(const HSceneObject& so)
 	{
-		Stack<SceneTreeElement*> todo;
-		todo.push(&mRootElement);
-
-		while (!todo.empty())
-		{
-			SceneTreeElement* currentElem = todo.top();
-			todo.pop();
-
-			if (so == currentElem->mSceneObject)
-				return currentElem;
+		if (so == mRootElement.mSceneObject)
+			return &mRootElement;
 
-			for (auto& child : currentElem->mChildren)
-			{
-				SceneTreeElement* sceneChild = static_cast<SceneTreeElement*>(child);
-				todo.push(sceneChild);
-			}
-		}
+		auto iterFind = mElementsById.find(so.getInstanceId());
+		if (iterFind != mElementsById.end() && so == iterFind->second->mSceneObject)
+			return iterFind->second;
 
 		return nullptr;
 	}
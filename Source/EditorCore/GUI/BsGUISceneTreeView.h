@@ -4,6 +4,7 @@
 
 #include "BsEditorPrerequisites.h"
 #include "GUI/BsGUITreeView.h"
+#include "Scene/BsSceneSearchIndex.h"
 #include "Utility/BsEvent.h"
 #include "Utility/BsServiceLocator.h"
 
@@ -49,6 +50,7 @@ namespace bs
 
 			HSceneObject mSceneObject;
 			UINT64 mId;
+			Vector<UINT64> mComponentIds;
 			bool mIsPrefabInstance;
 		};
 
@@ -123,6 +125,16 @@ namespace bs
 		/** Sets the expand/collapse state of the elements in the tree view. */
 		void setState(const SPtr<SceneTreeViewState>& state);
 
+		/**
+		 * Filters the tree view so only the scene objects matching the provided query are displayed, along with their
+		 * parents. The query can contain a name substring and any number of "t:Type" tokens that filter by component
+		 * type. Matching is case insensitive. Provide an empty string to disable filtering.
+		 */
+		void setFilter(const String& filter);
+
+		/** Returns the currently active filter query. */
+		const String& getFilter() const { return mFilter; }
+
 		/** Triggered whenever the selection changes. Call getSelection() to retrieve new selection. */
 		Event<void()> onSelectionChanged; 
 
@@ -196,6 +208,12 @@ namespace bs
 		/**	Attempts to find a tree element referencing the specified scene object. */
 		SceneTreeElement* findTreeElement(const HSceneObject& so);
 
+		/**
+		 * Looks up the current filter query in the search index and updates the displayed elements. Disables filtering if
+		 * the query is empty.
+		 */
+		void applyFilter();
+
 		/**	Creates a new scene object as a child of the currently selected object (if any). */
 		void createNewSO();
 
@@ -232,6 +250,11 @@ namespace bs
 		Vector<HSceneObject> mCopyList;
 		bool mCutFlag;
 
+		SceneSearchIndex mSearchIndex;
+		UnorderedMap<UINT64, SceneTreeElement*> mElementsById;
+		String mFilter;
+		bool mFilterDirty;
+
 		static const Color PREFAB_TINT;
 	};
 
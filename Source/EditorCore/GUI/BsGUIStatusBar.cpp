@@ -33,6 +33,7 @@ namespace bs
 		mScene = GUILabel::create(HEString("Scene: Unnamed"), GUIOptions(GUIOption::fixedWidth(150)));
 		mProject = GUILabel::create(HEString("Project: None"), GUIOptions(GUIOption::fixedWidth(200)));
 		mCompiling = GUILabel::create(HEString("Compiling..."), GUIOptions(GUIOption::fixedWidth(60)));
+		mSaving = GUILabel::create(HEString("Saving..."), GUIOptions(GUIOption::fixedWidth(50)));
 		mImporting = GUILabel::create(HEString("Importing..."), GUIOptions(GUIOption::fixedWidth(60)));
 		mImportProgressBar = GUIProgressBar::create(GUIOptions(GUIOption::fixedWidth(100)), "ProgressBarSmall");
 
@@ -53,6 +54,8 @@ namespace bs
 		horzLayout->addNewElement<GUIFixedSpace>(10);
 		horzLayout->addElement(mCompiling);
 		mCompilingSpace = horzLayout->addNewElement<GUIFixedSpace>(10);
+		horzLayout->addElement(mSaving);
+		mSavingSpace = horzLayout->addNewElement<GUIFixedSpace>(10);
 
 		horzLayout->addElement(mImporting);
 		mImportLayout = horzLayout->addNewElement<GUILayoutY>();
@@ -64,6 +67,7 @@ namespace bs
 		mBgPanel->addElement(mBackground);
 
 		setIsCompiling(false);
+		setIsSaving(false);
 		setIsImporting(false, 0.0f);
 
 		mLogEntryAddedConn = gDebug().onLogModified.connect(std::bind(&GUIStatusBar::logModified, this));
@@ -132,6 +136,12 @@ namespace bs
 		mCompilingSpace->setActive(compiling);
 	}
 
+	void GUIStatusBar::setIsSaving(bool saving)
+	{
+		mSaving->setActive(saving);
+		mSavingSpace->setActive(saving);
+	}
+
 	void GUIStatusBar::setIsImporting(bool importing, float percentage)
 	{
 		mImporting->setActive(importing);
@@ -65,6 +65,9 @@ namespace bs
 		/**	Activates or deactivates the "compilation in progress" visuals on the status bar. */
 		void setIsCompiling(bool compiling);
 
+		/**	Activates or deactivates the "save in progress" visuals on the status bar. */
+		void setIsSaving(bool saving);
+
 		/** 
 		 * Activates or deactives the "import in progress" visuals on the status bar, as well as updates the related 
 		 * progress bar to the specified percentage (if active).
@@ -107,6 +110,9 @@ namespace bs
 		GUIFixedSpace* mCompilingSpace;
 		GUILabel* mCompiling;
 
+		GUIFixedSpace* mSavingSpace;
+		GUILabel* mSaving;
+
 		GUILayout* mImportLayout;
 		GUIFixedSpace* mImportSpace;
 		GUILabel* mImporting;
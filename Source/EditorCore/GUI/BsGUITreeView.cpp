@@ -33,7 +33,7 @@ namespace bs
 
 	GUITreeView::TreeElement::TreeElement()
 		: mParent(nullptr), mFoldoutBtn(nullptr), mElement(nullptr), mSortedIdx(0), mIsExpanded(false), mIsSelected(false)
-		, mIsHighlighted(false), mIsVisible(true), mIsCut(false), mIsDisabled(false)
+		, mIsHighlighted(false), mIsVisible(true), mIsCut(false), mIsDisabled(false), mInFilter(false)
 	{ }
 
 	GUITreeView::TreeElement::~TreeElement()
@@ -86,7 +86,7 @@ namespace bs
 		, mDragHighlightStyle(dragHighlightStyle), mDragSepHighlightStyle(dragSepHighlightStyle), mIsElementSelected(false)
 		, mIsElementHighlighted(false), mEditElement(nullptr), mNameEditBox(nullptr), mDragInProgress(false)
 		, mDragHighlight(nullptr), mDragSepHighlight(nullptr), mScrollState(ScrollState::None), mLastScrollTime(0.0f)
-		, mMouseOverDragElement(nullptr), mMouseOverDragElementTime(0.0f)
+		, mMouseOverDragElement(nullptr), mMouseOverDragElementTime(0.0f), mFilterActive(false)
 	{
 		if(mBackgroundStyle == StringUtil::BLANK)
 			mBackgroundStyle = "TreeViewBackground";
@@ -755,7 +755,7 @@ namespace bs
 		if(element == &getRootElement())
 			return;
 
-		if(element->mIsVisible)
+		if(isElementDisplayed(element))
 		{
 			HString name(element->mName);
 			if(element->mElement == nullptr)
@@ -781,7 +781,8 @@ namespace bs
 			else
 				element->mElement->setTint(element->mTint);
 
-			if(element->mChildren.size() > 0)
+			// Filtered view always displays the matching children, so there is nothing to expand or collapse
+			if(element->mChildren.size() > 0 && !mFilterActive)
 			{
 				if(element->mFoldoutBtn == nullptr)
 				{
@@ -819,13 +820,126 @@ namespace bs
 				element->mFoldoutBtn = nullptr;
 			}
 
-			if(element->mIsSelected && element->mIsExpanded)
+			if(element->mIsSelected && element->mIsExpanded && !mFilterActive)
 				unselectElement(element);
 		}
 
 		_markLayoutAsDirty();
 	}
 
+	void GUITreeView::setFilteredElements(const Vector<TreeElement*>& matches)
+	{
+		TreeElement* root = &getRootElement();
+
+		// Find the matches along with their ancestors, stopping as soon as we reach an already visited ancestor
+		UnorderedSet<TreeElement*> newFiltered;
+		Vector<TreeElement*> newFilteredList;
+		for(auto& match : matches)
+		{
+			for(TreeElement* current = match; current != nullptr && current != root; current = current->mParent)
+			{
+				if(!newFiltered.insert(current).second)
+					break;
+
+				newFilteredList.push_back(current);
+			}
+		}
+
+		const bool wasActive = mFilterActive;
+		mFilterActive = true;
+
+		clearPing();
+
+		// Hide elements that were displayed before, but are no longer part of the filter
+		if(wasActive)
+		{
+			for(auto& element : mFilteredElements)
+			{
+				if(newFiltered.find(element) != newFiltered.end())
+					continue;
+
+				element->mInFilter = false;
+				updateElementGUI(element);
+			}
+		}
+		else
+		{
+			Stack<TreeElement*> todo;
+			todo.push(root);
+
+			while(!todo.empty())
+			{
+				TreeElement* current = todo.top();
+				todo.pop();
+
+				for(auto& child : current->mChildren)
+				{
+					if(!child->mIsVisible)
+						continue;
+
+					if(newFiltered.find(child) == newFiltered.end())
+						updateElementGUI(child);
+
+					todo.push(child);
+				}
+			}
+		}
+
+		// Show newly added elements. Elements that were displayed before are rebuilt only when entering filter mode, as
+		// their foldout buttons need to be removed.
+		for(auto& element : newFilteredList)
+		{
+			if(element->mInFilter && wasActive)
+				continue;
+
+			element->mInFilter = true;
+			updateElementGUI(element);
+		}
+
+		mFilteredElements.swap(newFilteredList);
+		_markLayoutAsDirty();
+	}
+
+	void GUITreeView::clearFilter()
+	{
+		if(!mFilterActive)
+			return;
+
+		mFilterActive = false;
+		clearPing();
+
+		for(auto& element : mFilteredElements)
+		{
+			element->mInFilter = false;
+
+			if(!element->mIsVisible)
+				updateElementGUI(element);
+		}
+
+		mFilteredElements.clear();
+
+		// Restore all elements visible under the normal view, including their foldout buttons
+		Stack<TreeElement*> todo;
+		todo.push(&getRootElement());
+
+		while(!todo.empty())
+		{
+			TreeElement* current = todo.top();
+			todo.pop();
+
+			for(auto& child : current->mChildren)
+			{
+				if(!child->mIsVisible)
+					continue;
+
+				updateElementGUI(child);
+				todo.push(child);
+			}
+		}
+
+		_markLayoutAsDirty();
+	}
+
 	void GUITreeView::elementToggled(TreeElement* element, bool toggled)
 	{
 		clearPing();
@@ -933,7 +1047,7 @@ namespace bs
 
 				for(auto& child : current->mChildren)
 				{
-					if(!child->mIsVisible)
+					if(!isElementDisplayed(child))
 						continue;
 
 					todo.push(UpdateTreeElement(child, currentUpdateElement.indent + 1));
@@ -1064,7 +1178,7 @@ namespace bs
 			{
 				TreeElement* child = *iter;
 
-				if(!child->mIsVisible)
+				if(!isElementDisplayed(child))
 					continue;
 
 				todo.push(UpdateTreeElement(child, indent + 1));
@@ -1078,7 +1192,10 @@ namespace bs
 
 		for(auto selectedElem : mSelectedElements)
 		{
+			// Selected elements can be hidden by the filter without being unselected
 			GUILabel* targetElement = selectedElem.element->mElement;
+			selectedElem.background->setVisible(targetElement != nullptr);
+
 			if (targetElement == nullptr)
 				continue;
 
@@ -59,6 +59,7 @@ namespace bs
 			bool mIsVisible;
 			bool mIsCut;
 			bool mIsDisabled;
+			bool mInFilter;
 			Color mTint;
 
 			bool isParentRec(TreeElement* element) const;
@@ -244,6 +245,25 @@ namespace bs
 		/**	Rebuilds the needed GUI elements for the provided TreeElement. */
 		void updateElementGUI(TreeElement* element);
 
+		/**
+		 * Enables filter mode, displaying only the provided elements along with all of their ancestors, regardless of
+		 * their expanded state. Only the elements whose displayed state changed since the last call are rebuilt. Calling
+		 * this again while the filter is active replaces the previous set of elements.
+		 */
+		void setFilteredElements(const Vector<TreeElement*>& matches);
+
+		/** Disables filter mode, if active, and restores the normal display of the tree based on expanded state. */
+		void clearFilter();
+
+		/** Checks is filter mode currently active. */
+		bool isFilterActive() const { return mFilterActive; }
+
+		/** Checks should the provided element be displayed, taking into account both expanded state and the filter. */
+		bool isElementDisplayed(const TreeElement* element) const
+		{
+			return mFilterActive ? element->mInFilter : element->mIsVisible;
+		}
+
 		/**	Close any elements that were temporarily expanded due to a drag operation hovering over them. */
 		void closeTemporarilyExpandedElements();
 
@@ -316,6 +336,9 @@ namespace bs
 		TreeElement* mMouseOverDragElement;
 		float mMouseOverDragElementTime;
 
+		bool mFilterActive;
+		Vector<TreeElement*> mFilteredElements;
+
 		static const UINT32 ELEMENT_EXTRA_SPACING;
 		static const UINT32 INDENT_SIZE;
 		static const UINT32 INITIAL_INDENT_OFFSET;
@@ -6,6 +6,7 @@
 #include "Material/BsGpuParamsSet.h"
 #include "Utility/BsBuiltinEditorResources.h"
 #include "CoreThread/BsCoreThread.h"
+#include "Utility/BsEditorRenderPacket.h"
 #include "Renderer/BsRendererManager.h"
 #include "Renderer/BsRenderer.h"
 #include "Mesh/BsMesh.h"
@@ -165,13 +166,13 @@ namespace bs
 
 	void HandleDrawManager::draw(const SPtr<Camera>& camera)
 	{
-		ct::HandleRenderer* renderer = mRenderer.get();
+		SPtr<ct::HandleRenderer> renderer = mRenderer;
 
 		// Clear meshes from previous frame
 		UINT64 frameIdx = gTime().getFrameIdx();
 		if(frameIdx != mLastFrameIdx)
 		{
-			gCoreThread().queueCommand(std::bind(&ct::HandleRenderer::clearQueued, renderer));
+			EditorRenderPacket::instance().queue([renderer]() { renderer->clearQueued(); });
 
 			clearMeshes();
 			mLastFrameIdx = frameIdx;
@@ -206,7 +207,11 @@ namespace bs
 			}
 		}
 
-		gCoreThread().queueCommand(std::bind(&ct::HandleRenderer::queueForDraw, renderer, camera->getCore(), proxyData));
+		EditorRenderPacket::instance().queue(
+			[renderer, coreCamera = camera->getCore(), proxyData = std::move(proxyData)]() mutable
+		{
+			renderer->queueForDraw(coreCamera, proxyData);
+		});
 	}
 
 	void HandleDrawManager::clear()
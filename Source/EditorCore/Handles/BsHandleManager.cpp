@@ -7,6 +7,7 @@
 #include "Scene/BsSceneObject.h"
 #include "Settings/BsEditorSettings.h"
 #include "Utility/BsTime.h"
+#include "Utility/BsEditorProfiler.h"
 
 namespace bs
 {
@@ -55,6 +56,8 @@ namespace bs
 
 	void HandleManager::draw(const SPtr<Camera>& camera)
 	{
+		BS_ED_PROFILE_SCOPE("HandleManager::draw");
+
 		UINT64 frameIdx = gTime().getFrameIdx();
 		if (frameIdx != mLastDrawFrameIdx)
 		{
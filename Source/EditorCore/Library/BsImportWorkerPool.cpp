@@ -0,0 +1,254 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Library/BsImportWorkerPool.h"
+#include "Utility/BsChildProcess.h"
+#include "Importer/BsImportOptions.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Serialization/BsFileSerializer.h"
+#include "Resources/BsResources.h"
+#include "Resources/BsResource.h"
+#include "Utility/BsUUID.h"
+#include "Debug/BsDebug.h"
+#include <iostream>
+
+namespace bs
+{
+	const char* ImportWorkerPool::DONE_MARKER = "BS_IMPORT_WORKER_DONE";
+	const char* ImportWorkerPool::RESULT_FILE = "Result.txt";
+
+	/** Placeholder sent instead of the import options path when default import options should be used. */
+	static const char* NO_IMPORT_OPTIONS = "-";
+
+	ImportWorkerPool::ImportWorkerPool(const Path& executable)
+		:mExecutable(executable)
+	{ }
+
+	ImportWorkerPool::~ImportWorkerPool()
+	{
+		// Closes the worker input, which makes them exit
+		Lock lock(mMutex);
+		mWorkers.clear();
+	}
+
+	void ImportWorkerPool::setMaxWorkers(UINT32 count)
+	{
+		Lock lock(mMutex);
+		mMaxWorkers = count;
+
+		// Drop idle workers above the limit, busy ones will be dropped when released
+		for (UINT32 i = (UINT32)mWorkers.size(); i > mMaxWorkers; i--)
+		{
+			if (!mWorkers[i - 1].busy)
+				mWorkers[i - 1].process = nullptr;
+		}
+	}
+
+	bool ImportWorkerPool::supportsFile(const Path& path)
+	{
+		// Shader includes are resolved through the project library, which isn't loaded in worker processes
+		String extension = path.getExtension();
+		StringUtil::toLowerCase(extension);
+
+		return extension != ".bsl" && extension != ".bslinc";
+	}
+
+	bool ImportWorkerPool::import(const Path& path, const SPtr<const ImportOptions>& importOptions,
+		const Path& tempFolder, Vector<SubResourceRaw>& resources, Vector<Path>& resourceFiles)
+	{
+		if (!FileSystem::isDirectory(tempFolder))
+			FileSystem::createDir(tempFolder);
+
+		const String jobName = UUIDGenerator::generateRandom().toString();
+
+		String importOptionsPathStr = NO_IMPORT_OPTIONS;
+		Path importOptionsPath = tempFolder;
+		importOptionsPath.setFilename(jobName + "-Options.asset");
+
+		if (importOptions != nullptr)
+		{
+			FileEncoder fs(importOptionsPath);
+			fs.encode(const_cast<ImportOptions*>(importOptions.get()));
+
+			importOptionsPathStr = importOptionsPath.toString();
+		}
+
+		Path resultPath = tempFolder;
+		resultPath.setFilename(jobName + RESULT_FILE);
+
+		const UINT32 workerIdx = acquireWorker();
+		SPtr<ChildProcess> process;
+		{
+			Lock lock(mMutex);
+			process = mWorkers[workerIdx].process;
+		}
+
+		bool success = false;
+		if (process != nullptr)
+		{
+			String request = path.toString() + "\t" + importOptionsPathStr + "\t" + tempFolder.toString() + "\t" + jobName;
+			if (process->writeLine(request))
+			{
+				// Anything else the worker prints (e.g. log output) is ignored
+				String line;
+				while (process->readLine(line))
+				{
+					if (line == DONE_MARKER)
+					{
+						success = true;
+						break;
+					}
+				}
+			}
+
+			if (!success)
+			{
+				BS_LOG(Error, Editor, "Import worker crashed while importing \"{0}\". The worker will be restarted.", path);
+
+				process->terminate();
+
+				Lock lock(mMutex);
+				mWorkers[workerIdx].process = nullptr;
+			}
+		}
+		else
+			BS_LOG(Error, Editor, "Unable to launch an import worker for \"{0}\".", path);
+
+		releaseWorker(workerIdx);
+
+		if (FileSystem::exists(importOptionsPath))
+			FileSystem::remove(importOptionsPath);
+
+		if (!success)
+			return false;
+
+		if (!FileSystem::exists(resultPath))
+			return true;
+
+		String resultStr = FileSystem::openFile(resultPath)->getAsString();
+		FileSystem::remove(resultPath);
+
+		Vector<String> names = StringUtil::split(resultStr, "\n");
+		for (UINT32 i = 0; i < (UINT32)names.size(); i++)
+		{
+			Path resourcePath = tempFolder;
+			resourcePath.setFilename(jobName + "-" + toString(i) + ".asset");
+
+			if (!FileSystem::isFile(resourcePath))
+				continue;
+
+			// Skip over the saved resource data header and decode the resource itself
+			FileDecoder fs(resourcePath);
+			fs.skip();
+
+			SPtr<IReflectable> decoded = fs.decode();
+			if (decoded == nullptr || !decoded->isDerivedFrom(Resource::getRTTIStatic()))
+			{
+				FileSystem::remove(resourcePath);
+				continue;
+			}
+
+			resources.push_back({ names[i], std::static_pointer_cast<Resource>(decoded) });
+			resourceFiles.push_back(resourcePath);
+		}
+
+		return true;
+	}
+
+	UINT32 ImportWorkerPool::acquireWorker()
+	{
+		Lock lock(mMutex);
+
+		while (true)
+		{
+			const UINT32 maxWorkers = std::max(mMaxWorkers, 1U);
+			for (UINT32 i = 0; i < maxWorkers; i++)
+			{
+				if (i >= (UINT32)mWorkers.size())
+					mWorkers.push_back(Worker());
+
+				Worker& worker = mWorkers[i];
+				if (worker.busy)
+					continue;
+
+				// Launch on first use, or to replace a worker that exited
+				if (worker.process == nullptr || !worker.process->isRunning())
+					worker.process = ChildProcess::create(mExecutable, { "--import-worker" });
+
+				worker.busy = true;
+				return i;
+			}
+
+			mWorkerReleased.wait(lock);
+		}
+	}
+
+	void ImportWorkerPool::releaseWorker(UINT32 idx)
+	{
+		{
+			Lock lock(mMutex);
+
+			Worker& worker = mWorkers[idx];
+			worker.busy = false;
+
+			if (idx >= mMaxWorkers)
+				worker.process = nullptr;
+		}
+
+		mWorkerReleased.notify_one();
+	}
+
+	int ImportWorkerPool::runWorker()
+	{
+		std::string line;
+		while (std::getline(std::cin, line))
+		{
+			if (!line.empty() && line.back() == '\r')
+				line.pop_back();
+
+			Vector<String> params = StringUtil::split(line.c_str(), "\t");
+			if (params.size() != 4)
+			{
+				std::cout << DONE_MARKER << std::endl;
+				continue;
+			}
+
+			const Path path = params[0];
+			const Path tempFolder = params[2];
+			const String& jobName = params[3];
+
+			SPtr<const ImportOptions> importOptions;
+			if (params[1] != NO_IMPORT_OPTIONS)
+			{
+				FileDecoder fs(params[1]);
+				SPtr<IReflectable> decoded = fs.decode();
+
+				if (decoded != nullptr && decoded->isDerivedFrom(ImportOptions::getRTTIStatic()))
+					importOptions = std::static_pointer_cast<ImportOptions>(decoded);
+			}
+
+			Vector<SubResourceRaw> importedResources = gImporter()._importAll(path, importOptions);
+
+			String result;
+			for (UINT32 i = 0; i < (UINT32)importedResources.size(); i++)
+			{
+				Path outputPath = tempFolder;
+				outputPath.setFilename(jobName + "-" + toString(i) + ".asset");
+
+				gResources()._save(importedResources[i].value, outputPath, true);
+				result += importedResources[i].name + "\n";
+			}
+
+			Path resultPath = tempFolder;
+			resultPath.setFilename(jobName + RESULT_FILE);
+
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(resultPath);
+			stream->writeString(result);
+			stream->close();
+
+			std::cout << DONE_MARKER << std::endl;
+		}
+
+		return 0;
+	}
+}
\ No newline at end of file
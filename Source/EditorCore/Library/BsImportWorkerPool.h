@@ -0,0 +1,94 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Utility/BsModule.h"
+#include "Importer/BsImporter.h"
+
+namespace bs
+{
+	/** @addtogroup Library
+	 *  @{
+	 */
+
+	/**
+	 * Performs resource imports in separate worker processes. Workers are instances of the editor executable started in
+	 * import worker mode (--import-worker). This ensures a misbehaving importer cannot bring down the editor, and allows
+	 * importers that rely on global locks to run in parallel.
+	 *
+	 * Workers are launched on demand, up to a set maximum, and are kept alive between imports. If a worker crashes only
+	 * the import it was working on fails, and a new worker is launched for the next import.
+	 */
+	class BS_ED_EXPORT ImportWorkerPool : public Module<ImportWorkerPool>
+	{
+		/** Information about a single worker process. */
+		struct Worker
+		{
+			SPtr<ChildProcess> process;
+			bool busy = false;
+		};
+
+	public:
+		/** @param[in]	executable	Path to the editor executable that will be used for launching workers. */
+		ImportWorkerPool(const Path& executable);
+		~ImportWorkerPool();
+
+		/**
+		 * Sets the maximum number of worker processes. If zero, out-of-process import is disabled. Reducing the number
+		 * of workers only takes effect once the extra workers finish their current import.
+		 */
+		void setMaxWorkers(UINT32 count);
+
+		/** Checks should imports be performed in worker processes. */
+		bool isEnabled() const { return mMaxWorkers > 0; }
+
+		/**
+		 * Checks can the provided file be imported by a worker process. Files whose importers require access to the
+		 * project library (e.g. shaders that reference project includes) must be imported in the editor process.
+		 */
+		static bool supportsFile(const Path& path);
+
+		/**
+		 * Imports the provided file in a worker process, blocking until the import finishes. Thread safe.
+		 *
+		 * @param[in]	path			Path to the file to import.
+		 * @param[in]	importOptions	Options to import the file with. Can be null for default options.
+		 * @param[in]	tempFolder		Folder in which to store the imported resources.
+		 * @param[out]	resources		Imported resources, deserialized from the output of the worker.
+		 * @param[out]	resourceFiles	Paths to the files containing the imported resources, as serialized by the worker.
+		 *								Each entry corresponds to an entry in @p resources. Files can be moved to the
+		 *								library directly, without needing to serialize the resources again.
+		 * @return						True if the import succeeded, false if the worker failed to launch or crashed.
+		 */
+		bool import(const Path& path, const SPtr<const ImportOptions>& importOptions, const Path& tempFolder,
+			Vector<SubResourceRaw>& resources, Vector<Path>& resourceFiles);
+
+		/**
+		 * Runs the import worker loop. Reads import requests from the standard input and performs them until the input
+		 * is closed. Should only be called from the worker process.
+		 *
+		 * @return	Process exit code.
+		 */
+		static int runWorker();
+
+	private:
+		/** Finds or launches a worker that isn't busy, blocking until one becomes available. */
+		UINT32 acquireWorker();
+
+		/** Marks the worker with the specified index as available for new imports. */
+		void releaseWorker(UINT32 idx);
+
+		static const char* DONE_MARKER;
+		static const char* RESULT_FILE;
+
+		Path mExecutable;
+		UINT32 mMaxWorkers = 0;
+		Vector<Worker> mWorkers;
+
+		Mutex mMutex;
+		Signal mWorkerReleased;
+	};
+
+	/** @} */
+}
\ No newline at end of file
@@ -15,15 +15,20 @@
 #include "Serialization/BsBinaryDiff.h"
 #include "Debug/BsDebug.h"
 #include "Library/BsProjectLibraryEntries.h"
+#include "Library/BsImportWorkerPool.h"
+#include "Library/BsResourceReferenceIndex.h"
 #include "Resources/BsResource.h"
 #include "BsEditorApplication.h"
+#include "Settings/BsEditorSettings.h"
 #include "Material/BsShader.h"
+#include "Material/BsShaderInclude.h"
 #include "Image/BsTexture.h"
 #include "String/BsUnicode.h"
 #include "CoreThread/BsCoreThread.h"
 #include "Threading/BsTaskScheduler.h"
 #include "RenderAPI/BsRenderTexture.h"
 #include "Renderer/BsRendererUtility.h"
+#include "Utility/BsEditorProfiler.h"
 #include <regex>
 
 using namespace std::placeholders;
@@ -104,6 +109,104 @@ namespace bs
 	const Path ProjectLibrary::INTERNAL_RESOURCES_DIR = PROJECT_INTERNAL_DIR + RESOURCES_DIR;
 	const char* ProjectLibrary::LIBRARY_ENTRIES_FILENAME = "ProjectLibrary.asset";
 	const char* ProjectLibrary::RESOURCE_MANIFEST_FILENAME = "ResourceManifest.asset";
+	const char* ProjectLibrary::REFERENCE_INDEX_FILENAME = "ResourceReferences.asset";
+
+	/** 
+	 * Calculates a hash of shader source code, ignoring comments and differences in whitespace. Line breaks are preserved
+	 * as they are significant for preprocessor directives, and string and character literals are hashed verbatim.
+	 */
+	static UINT64 hashShaderSource(const String& source)
+	{
+		String normalized;
+		normalized.reserve(source.size());
+
+		bool pendingSpace = false;
+		const size_t size = source.size();
+		for (size_t i = 0; i < size; i++)
+		{
+			const char ch = source[i];
+
+			// Line comment, skip until line break
+			if (ch == '/' && (i + 1) < size && source[i + 1] == '/')
+			{
+				while ((i + 1) < size && source[i + 1] != '\n')
+					i++;
+
+				continue;
+			}
+
+			// Block comment, skip until terminator but keep any line breaks
+			if (ch == '/' && (i + 1) < size && source[i + 1] == '*')
+			{
+				i += 2;
+				while (i < size && !(source[i] == '*' && (i + 1) < size && source[i + 1] == '/'))
+				{
+					if (source[i] == '\n')
+						normalized += '\n';
+
+					i++;
+				}
+
+				i++;
+				pendingSpace = true;
+				continue;
+			}
+
+			// String or character literal, copy verbatim including any escaped characters
+			if (ch == '"' || ch == '\'')
+			{
+				if (pendingSpace && !normalized.empty() && normalized.back() != '\n')
+					normalized += ' ';
+
+				pendingSpace = false;
+				normalized += ch;
+				while ((i + 1) < size && source[i + 1] != ch && source[i + 1] != '\n')
+				{
+					i++;
+					normalized += source[i];
+
+					if (source[i] == '\\' && (i + 1) < size)
+					{
+						i++;
+						normalized += source[i];
+					}
+				}
+
+				// Closing quote
+				if ((i + 1) < size && source[i + 1] == ch)
+				{
+					i++;
+					normalized += ch;
+				}
+
+				continue;
+			}
+
+			if (ch == '\n')
+			{
+				// Skip empty lines
+				if (!normalized.empty() && normalized.back() != '\n')
+					normalized += '\n';
+
+				pendingSpace = false;
+				continue;
+			}
+
+			if (ch == ' ' || ch == '\t' || ch == '\r')
+			{
+				pendingSpace = true;
+				continue;
+			}
+
+			if (pendingSpace && !normalized.empty() && normalized.back() != '\n')
+				normalized += ' ';
+
+			pendingSpace = false;
+			normalized += ch;
+		}
+
+		return (UINT64)bs_hash(normalized);
+	}
 
 	ProjectLibrary::LibraryEntry::LibraryEntry()
 		:type(LibraryEntryType::Directory)
@@ -126,6 +229,7 @@ namespace bs
 		: mRootEntry(nullptr), mIsLoaded(false)
 	{
 		mRootEntry = bs_ushared_ptr_new<DirectoryEntry>(mResourcesFolder, mResourcesFolder.getTail(), nullptr);
+		mReferenceIndex = ResourceReferenceIndex::create();
 	}
 
 	ProjectLibrary::~ProjectLibrary()
@@ -329,7 +433,7 @@ namespace bs
 		parent->mChildren.push_back(newResource);
 
 		reimportResourceInternal(newResource.get(), importOptions, forceReimport, false, synchronous);
-		onEntryAdded(newResource->path);
+		notifyEntryAdded(newResource->path);
 
 		return newResource;
 	}
@@ -339,7 +443,7 @@ namespace bs
 		USPtr<DirectoryEntry> newEntry = bs_ushared_ptr_new<DirectoryEntry>(dirPath, dirPath.getTail(), parent);
 		parent->mChildren.push_back(newEntry);
 
-		onEntryAdded(newEntry->path);
+		notifyEntryAdded(newEntry->path);
 		return newEntry;
 	}
 
@@ -352,6 +456,14 @@ namespace bs
 			{
 				const UUID& uuid = entry->getUUID();
 
+				// Make sure a pending save doesn't write the file back after we delete it
+				const auto iterSave = mQueuedSaves.find(uuid);
+				if(iterSave != mQueuedSaves.end())
+				{
+					iterSave->second->saveTask->wait();
+					mQueuedSaves.erase(iterSave);
+				}
+
 				Path path;
 				if (mResourceManifest->uuidToFilePath(uuid, path))
 				{
@@ -362,6 +474,8 @@ namespace bs
 				}
 
 				mUUIDToPath.erase(uuid);
+				mReferenceIndex->remove(uuid);
+				mIncludeHashes.erase(uuid);
 			}
 		}
 
@@ -376,7 +490,7 @@ namespace bs
 		parent->mChildren.erase(findIter);
 
 		Path originalPath = resource->path;
-		onEntryRemoved(originalPath);
+		notifyEntryRemoved(originalPath);
 
 		const auto iterQueuedImport = mQueuedImports.find(resource.get());
 		if(iterQueuedImport != mQueuedImports.end())
@@ -411,7 +525,7 @@ namespace bs
 			parent->mChildren.erase(findIter);
 		}
 
-		onEntryRemoved(directory->path);
+		notifyEntryRemoved(directory->path);
 		*directory = DirectoryEntry();
 	}
 
@@ -516,25 +630,46 @@ namespace bs
 						queuedImport->resources.emplace_back(entry->getUniqueName(), nullptr, entry->getUUID());
 				}
 
+				// Optionally import in a separate process, so a failing importer cannot take down the editor
+				bool importInWorker = false;
+				if (ImportWorkerPool::isStarted())
+				{
+					ImportWorkerPool& importWorkerPool = ImportWorkerPool::instance();
+					importWorkerPool.setMaxWorkers(gEditorApplication().getEditorSettings()->getImportWorkerCount());
+
+					importInWorker = importWorkerPool.isEnabled() && ImportWorkerPool::supportsFile(fileEntry->path);
+				}
+
 				// Perform import, register the resources and their UUID in the QueuedImport structure and save the
 				// resource on disk
-				const auto importAsync = [queuedImportWeak, &projectFolder = mProjectFolder, &mutex = mQueuedImportMutex]()
+				const auto importAsync = [queuedImportWeak, importInWorker, &projectFolder = mProjectFolder, 
+					&mutex = mQueuedImportMutex]()
 				{
 					SPtr<QueuedImport> queuedImport = queuedImportWeak.lock();
 
-					Vector<SubResourceRaw> importedResources = gImporter()._importAll(queuedImport->filePath, 
-						queuedImport->importOptions);
+					Path outputPath = projectFolder;
+					outputPath.append(INTERNAL_TEMP_DIR);
 
-					if (!importedResources.empty())
+					// If imported by a worker the resources are already serialized, in which case we just move the files
+					Vector<SubResourceRaw> importedResources;
+					Vector<Path> importedFiles;
+
+					if (importInWorker)
 					{
-						Path outputPath = projectFolder;
-						outputPath.append(INTERNAL_TEMP_DIR);
+						ImportWorkerPool::instance().import(queuedImport->filePath, queuedImport->importOptions, 
+							outputPath, importedResources, importedFiles);
+					}
+					else
+						importedResources = gImporter()._importAll(queuedImport->filePath, queuedImport->importOptions);
 
+					if (!importedResources.empty())
+					{
 						if (!FileSystem::isDirectory(outputPath))
 							FileSystem::createDir(outputPath);
 
-						for (auto& entry : importedResources)
+						for (UINT32 i = 0; i < (UINT32)importedResources.size(); i++)
 						{
+							const SubResourceRaw& entry = importedResources[i];
 							String subresourceName = entry.name;
 							Path::stripInvalid(subresourceName);
 
@@ -568,7 +703,11 @@ namespace bs
 							const String uuidStr = uuid.toString();
 
 							outputPath.setFilename(uuidStr + ".asset");
-							gResources()._save(entry.value, outputPath, true);
+
+							if (i < (UINT32)importedFiles.size())
+								FileSystem::move(importedFiles[i], outputPath, true);
+							else
+								gResources()._save(entry.value, outputPath, true);
 						}
 					}
 				};
@@ -691,6 +830,10 @@ namespace bs
 		Path tempResourcesPath = mProjectFolder;
 		tempResourcesPath.append(INTERNAL_TEMP_DIR);
 
+		// Shader includes whose source only changed in comments or whitespace don't require dependants to be reimported
+		bool hasIncludes = false;
+		bool includesModified = false;
+
 		// See which sub-resource metas need to be updated, removed or added based on the new resource set
 		bool isFirst = true;
 		for (const auto& entry : import.resources)
@@ -706,6 +849,19 @@ namespace bs
 			tempResourcesPath.setFilename(uuidStr + ".asset");
 			internalResourcesPath.setFilename(uuidStr + ".asset");
 
+			if (entry.resource->getTypeId() == TID_ShaderInclude)
+			{
+				// Compare against the previous import, before it gets overwritten
+				const UINT64 newHash = hashShaderSource(static_cast<ShaderInclude&>(*entry.resource).getString());
+
+				UINT64 oldHash = 0;
+				if (!getIncludeHash(entry.uuid, internalResourcesPath, oldHash) || oldHash != newHash)
+					includesModified = true;
+
+				mIncludeHashes[entry.uuid] = newHash;
+				hasIncludes = true;
+			}
+
 			FileSystem::move(tempResourcesPath, internalResourcesPath);
 
 			String name = entry.name;
@@ -771,6 +927,9 @@ namespace bs
 
 			// Register path in manifest
 			mResourceManifest->registerResource(entry.uuid, internalResourcesPath);
+
+			// Update the list of resources this resource references, in case it changed
+			updateReferences(entry.uuid, internalResourcesPath);
 		}
 
 		// Keep resource metas that we are not currently using, in case they get restored so their references
@@ -780,6 +939,11 @@ namespace bs
 			for (auto& metaEntry : existingMetas)
 				fileEntry->meta->addInactive(metaEntry);
 		}
+		else
+		{
+			for (auto& metaEntry : existingMetas)
+				mReferenceIndex->remove(metaEntry->getUUID());
+		}
 
 		// Note: Ideally we replace this with a specialized BinaryCompare method
 		bool metaModified = true;
@@ -806,13 +970,82 @@ namespace bs
 		onEntryImported(fileEntry->path);
 
 		// Queue any resources dependant on this one for import
-		reimportDependants(fileEntry->path);
+		if (!hasIncludes || includesModified)
+			reimportDependants(fileEntry->path);
 
 		return true;
 	}
 
+	bool ProjectLibrary::finishQueuedSave(const QueuedSave& save, bool wait)
+	{
+		if (!save.saveTask->isComplete())
+		{
+			if (wait)
+				save.saveTask->wait();
+			else
+				return false;
+		}
+
+		if (!save.succeeded)
+		{
+			BS_LOG(Error, Editor, "Failed to save \"{0}\".", save.filePath);
+			return true;
+		}
+
+		BS_LOG(Info, Editor, "Saved \"{0}\".", save.filePath.getFilename());
+
+		// Refresh the internal copy of the resource, in the background as well
+		LibraryEntry* fileEntry = findEntry(save.filePath).get();
+		if(fileEntry && fileEntry->type == LibraryEntryType::File)
+			reimportResourceInternal(static_cast<FileEntry*>(fileEntry), nullptr, true, false, false);
+
+		return true;
+	}
+
+	void ProjectLibrary::waitForQueuedSave(const HResource& resource)
+	{
+		const auto iterFind = mQueuedSaves.find(resource.getUUID());
+		if (iterFind == mQueuedSaves.end())
+			return;
+
+		// Remove first, as finalizing the save can queue other operations
+		SPtr<QueuedSave> queuedSave = iterFind->second;
+		mQueuedSaves.erase(iterFind);
+
+		finishQueuedSave(*queuedSave, true);
+	}
+
+	void ProjectLibrary::waitForQueuedSaves()
+	{
+		while (!mQueuedSaves.empty())
+		{
+			auto iter = mQueuedSaves.begin();
+
+			SPtr<QueuedSave> queuedSave = iter->second;
+			mQueuedSaves.erase(iter);
+
+			finishQueuedSave(*queuedSave, true);
+		}
+	}
+
 	void ProjectLibrary::_finishQueuedImports(bool wait)
 	{
+		BS_ED_PROFILE_SCOPE("ProjectLibrary::_finishQueuedImports");
+
+		for(auto iter = mQueuedSaves.begin(); iter != mQueuedSaves.end();)
+		{
+			// Copy, as finalizing the save can queue other operations
+			SPtr<QueuedSave> queuedSave = iter->second;
+			if (!queuedSave->saveTask->isComplete() && !wait)
+			{
+				++iter;
+				continue;
+			}
+
+			iter = mQueuedSaves.erase(iter);
+			finishQueuedSave(*queuedSave, true);
+		}
+
 		for(auto iter = mQueuedImports.begin(); iter != mQueuedImports.end();)
 		{
 			if(finishQueuedImport(iter->first, *iter->second, wait))
@@ -820,6 +1053,29 @@ namespace bs
 			else
 				++iter;
 		}
+
+		if(!mPendingAddedEntries.empty() || !mPendingRemovedEntries.empty())
+		{
+			// Swap out first, as listeners might modify the library
+			Vector<Path> addedEntries;
+			Vector<Path> removedEntries;
+			std::swap(addedEntries, mPendingAddedEntries);
+			std::swap(removedEntries, mPendingRemovedEntries);
+
+			onEntriesChanged(addedEntries, removedEntries);
+		}
+	}
+
+	void ProjectLibrary::notifyEntryAdded(const Path& path)
+	{
+		mPendingAddedEntries.push_back(path);
+		onEntryAdded(path);
+	}
+
+	void ProjectLibrary::notifyEntryRemoved(const Path& path)
+	{
+		mPendingRemovedEntries.push_back(path);
+		onEntryRemoved(path);
 	}
 
 	bool ProjectLibrary::isUpToDate(FileEntry* resource) const
@@ -1100,6 +1356,63 @@ namespace bs
 		return Path::BLANK;
 	}
 
+	bool ProjectLibrary::getReferencedResources(const UUID& uuid, Vector<UUID>& output) const
+	{
+		return mReferenceIndex->getReferences(uuid, output);
+	}
+
+	Vector<UUID> ProjectLibrary::getReferencingResources(const UUID& uuid) const
+	{
+		return mReferenceIndex->getReferencingResources(uuid);
+	}
+
+	Vector<USPtr<ProjectLibrary::LibraryEntry>> ProjectLibrary::findReferencingEntries(const Path& path) const
+	{
+		Vector<USPtr<LibraryEntry>> output;
+
+		Path sourcePath = path;
+		if (isSubresource(sourcePath))
+			sourcePath.makeParent();
+
+		const LibraryEntry* sourceEntry = findEntry(sourcePath).get();
+		if (sourceEntry == nullptr)
+			return output;
+
+		UnorderedSet<const LibraryEntry*> foundEntries;
+		for (auto& uuid : getResourceUUIDs(path))
+		{
+			Vector<UUID> referencingResources = mReferenceIndex->getReferencingResources(uuid);
+			for (auto& referencingUUID : referencingResources)
+			{
+				auto iterFind = mUUIDToPath.find(referencingUUID);
+				if (iterFind == mUUIDToPath.end())
+					continue;
+
+				Path referencingPath = iterFind->second;
+				if (isSubresource(referencingPath))
+					referencingPath.makeParent();
+
+				USPtr<LibraryEntry> referencingEntry = findEntry(referencingPath);
+				if (referencingEntry == nullptr || referencingEntry.get() == sourceEntry)
+					continue;
+
+				// References between entries within the same folder don't break when the folder is deleted
+				if (sourceEntry->type == LibraryEntryType::Directory && sourceEntry->path.includes(referencingEntry->path))
+					continue;
+
+				if (foundEntries.insert(referencingEntry.get()).second)
+					output.push_back(referencingEntry);
+			}
+		}
+
+		return output;
+	}
+
+	bool ProjectLibrary::isReferenced(const Path& path) const
+	{
+		return !findReferencingEntries(path).empty();
+	}
+
 	void ProjectLibrary::createEntry(const HResource& resource, const Path& path)
 	{
 		if (resource == nullptr)
@@ -1134,7 +1447,7 @@ namespace bs
 		addResourceInternal(entryParent, absPath, nullptr, true, true);
 	}
 
-	void ProjectLibrary::saveEntry(const HResource& resource)
+	void ProjectLibrary::saveEntry(const HResource& resource, bool synchronous)
 	{
 		if (resource == nullptr)
 			return;
@@ -1149,6 +1462,50 @@ namespace bs
 
 		filePath.makeAbsolute(getResourcesFolder());
 
+		// Never allow two writes of the same file to run at once
+		waitForQueuedSave(resource);
+
+		if(!synchronous && resource.isLoaded(false))
+		{
+			Path tempPath = mProjectFolder;
+			tempPath.append(INTERNAL_TEMP_DIR);
+
+			if (!FileSystem::isDirectory(tempPath))
+				FileSystem::createDir(tempPath);
+
+			tempPath.setFilename(resource.getUUID().toString() + ".save");
+
+			SPtr<QueuedSave> queuedSave = bs_shared_ptr_new<QueuedSave>();
+			queuedSave->filePath = filePath;
+
+			// Write the full file next to the project first, and only then replace the original. This ensures the
+			// original is never left partially written if the editor exits mid-save.
+			std::weak_ptr<QueuedSave> queuedSaveWeak = queuedSave;
+			const auto saveAsync = [queuedSaveWeak, resourcePtr = resource.getInternalPtr(), tempPath]()
+			{
+				SPtr<QueuedSave> queuedSave = queuedSaveWeak.lock();
+				if (!queuedSave)
+					return;
+
+				// Don't let a leftover from an interrupted save be mistaken for a successful write
+				if (FileSystem::exists(tempPath))
+					FileSystem::remove(tempPath);
+
+				gResources()._save(resourcePtr, tempPath, false);
+				if (!FileSystem::isFile(tempPath))
+					return;
+
+				FileSystem::move(tempPath, queuedSave->filePath, true);
+				queuedSave->succeeded = true;
+			};
+
+			queuedSave->saveTask = Task::create("ProjectLibrarySave", saveAsync, TaskPriority::Normal);
+			mQueuedSaves[resource.getUUID()] = queuedSave;
+
+			TaskScheduler::instance().addTask(queuedSave->saveTask);
+			return;
+		}
+
 		Resources::instance().save(resource, filePath, true);
 
 		LibraryEntry* fileEntry = findEntry(filePath).get();
@@ -1224,7 +1581,7 @@ namespace bs
 			}
 			else // Just moving internally
 			{
-				onEntryRemoved(oldEntry->path);
+				notifyEntryRemoved(oldEntry->path);
 
 				USPtr<FileEntry> fileEntry = nullptr;
 				if (oldEntry->type == LibraryEntryType::File)
@@ -1302,7 +1659,7 @@ namespace bs
 					}
 				}
 
-				onEntryAdded(oldEntry->path);
+				notifyEntryAdded(oldEntry->path);
 
 				if (fileEntry != nullptr)
 				{
@@ -1563,7 +1920,13 @@ namespace bs
 		ResourceLoadFlags loadFlags = ResourceLoadFlag::Default | ResourceLoadFlag::KeepSourceData;
 
 		const UUID& resUUID = meta->getUUID();
-		return gResources().loadFromUUID(resUUID, false, loadFlags);
+		HResource resource = gResources().loadFromUUID(resUUID, false, loadFlags);
+
+		// The resource is being encoded on a worker thread and must not be modified until that finishes. Any caller
+		// could go on to modify the returned resource, so complete the save first.
+		if (resource != nullptr)
+			waitForQueuedSave(resource);
+		return resource;
 	}
 
 	void ProjectLibrary::createInternalParentHierarchy(const Path& fullPath, DirectoryEntry** newHierarchyRoot, 
@@ -1645,6 +2008,8 @@ namespace bs
 		mRootEntry = bs_ushared_ptr_new<DirectoryEntry>(mResourcesFolder, mResourcesFolder.getTail(), nullptr);
 
 		mDependencies.clear();
+		mIncludeHashes.clear();
+		mReferenceIndex->clear();
 		gResources().unregisterResourceManifest(mResourceManifest);
 		mResourceManifest = nullptr;
 		mIsLoaded = false;
@@ -1713,6 +2078,13 @@ namespace bs
 		resourceManifestPath.append(RESOURCE_MANIFEST_FILENAME);
 
 		ResourceManifest::save(mResourceManifest, resourceManifestPath, mProjectFolder);
+
+		Path referenceIndexPath = mProjectFolder;
+		referenceIndexPath.append(PROJECT_INTERNAL_DIR);
+		referenceIndexPath.append(REFERENCE_INDEX_FILENAME);
+
+		FileEncoder referenceIndexFs(referenceIndexPath);
+		referenceIndexFs.encode(mReferenceIndex.get());
 	}
 
 	void ProjectLibrary::loadLibrary()
@@ -1753,6 +2125,26 @@ namespace bs
 
 		gResources().registerResourceManifest(mResourceManifest);
 
+		// Load the resource reference index, or rebuild it once all meta files are loaded if it doesn't exist
+		Path referenceIndexPath = mProjectFolder;
+		referenceIndexPath.append(PROJECT_INTERNAL_DIR);
+		referenceIndexPath.append(REFERENCE_INDEX_FILENAME);
+
+		bool rebuildReferences = true;
+		std::time_t referenceIndexTime = 0;
+		if (FileSystem::exists(referenceIndexPath))
+		{
+			FileDecoder fs(referenceIndexPath);
+			SPtr<IReflectable> loadedIndex = fs.decode();
+
+			if (loadedIndex != nullptr && loadedIndex->isDerivedFrom(ResourceReferenceIndex::getRTTIStatic()))
+			{
+				mReferenceIndex = std::static_pointer_cast<ResourceReferenceIndex>(loadedIndex);
+				referenceIndexTime = FileSystem::getLastModifiedTime(referenceIndexPath);
+				rebuildReferences = false;
+			}
+		}
+
 		// Load all meta files
 		Stack<DirectoryEntry*> todo;
 		todo.push(mRootEntry.get());
@@ -1830,6 +2222,11 @@ namespace bs
 				deleteDirectoryInternal(static_pointer_cast<DirectoryEntry>(deletedEntry));
 		}
 
+		if (rebuildReferences)
+			rebuildReferenceIndex();
+		else
+			updateStaleReferences(referenceIndexTime);
+
 		// Clean up internal library folder from obsolete files
 		Path internalResourcesFolder = mProjectFolder;
 		internalResourcesFolder.append(INTERNAL_RESOURCES_DIR);
@@ -1843,6 +2240,7 @@ namespace bs
 				if (mUUIDToPath.find(uuid) == mUUIDToPath.end())
 				{
 					mResourceManifest->unregisterResource(uuid);
+					mReferenceIndex->remove(uuid);
 					toDelete.push_back(file);
 				}
 
@@ -1935,15 +2333,36 @@ namespace bs
 
 	void ProjectLibrary::reimportDependants(const Path& entryPath)
 	{
-		auto iterFind = mDependencies.find(entryPath);
-		if (iterFind == mDependencies.end())
-			return;
+		// Gather all direct and indirect dependants first, since we might modify the dependency lists during reimport
+		Vector<Path> dependants;
+		UnorderedSet<Path> visited = { entryPath };
 
-		// Make a copy since we might modify this list during reimport
-		Vector<Path> dependencies = iterFind->second;
-		for (auto& dependency : dependencies)
+		Stack<Path> todo;
+		todo.push(entryPath);
+
+		while (!todo.empty())
+		{
+			Path current = todo.top();
+			todo.pop();
+
+			auto iterFind = mDependencies.find(current);
+			if (iterFind == mDependencies.end())
+				continue;
+
+			for (auto& dependant : iterFind->second)
+			{
+				if (!visited.insert(dependant).second)
+					continue;
+
+				dependants.push_back(dependant);
+				todo.push(dependant);
+			}
+		}
+
+		// Imports are queued as separate tasks, so the dependants are reimported in parallel
+		for (auto& dependant : dependants)
 		{
-			LibraryEntry* entry = findEntry(dependency).get();
+			LibraryEntry* entry = findEntry(dependant).get();
 			if (entry != nullptr && entry->type == LibraryEntryType::File)
 			{
 				FileEntry* resEntry = static_cast<FileEntry*>(entry);
@@ -1957,6 +2376,105 @@ namespace bs
 		}
 	}
 
+	bool ProjectLibrary::getIncludeHash(const UUID& uuid, const Path& importedPath, UINT64& hash)
+	{
+		auto iterFind = mIncludeHashes.find(uuid);
+		if (iterFind != mIncludeHashes.end())
+		{
+			hash = iterFind->second;
+			return true;
+		}
+
+		if (!FileSystem::isFile(importedPath))
+			return false;
+
+		// Skip over the saved resource data header and decode the include itself
+		FileDecoder fs(importedPath);
+		fs.skip();
+
+		SPtr<IReflectable> decoded = fs.decode();
+		if (decoded == nullptr || !decoded->isDerivedFrom(ShaderInclude::getRTTIStatic()))
+			return false;
+
+		hash = hashShaderSource(std::static_pointer_cast<ShaderInclude>(decoded)->getString());
+		return true;
+	}
+
+	Vector<UUID> ProjectLibrary::getResourceUUIDs(const Path& path) const
+	{
+		Vector<UUID> output;
+
+		if (isSubresource(path))
+		{
+			SPtr<ProjectResourceMeta> resMeta = findResourceMeta(path);
+			if (resMeta != nullptr)
+				output.push_back(resMeta->getUUID());
+
+			return output;
+		}
+
+		LibraryEntry* entry = findEntry(path).get();
+		if (entry == nullptr)
+			return output;
+
+		Stack<LibraryEntry*> todo;
+		todo.push(entry);
+
+		while (!todo.empty())
+		{
+			LibraryEntry* current = todo.top();
+			todo.pop();
+
+			if (current->type == LibraryEntryType::Directory)
+			{
+				for (auto& child : static_cast<DirectoryEntry*>(current)->mChildren)
+					todo.push(child.get());
+
+				continue;
+			}
+
+			FileEntry* fileEntry = static_cast<FileEntry*>(current);
+			if (fileEntry->meta == nullptr)
+				continue;
+
+			for (auto& resMeta : fileEntry->meta->getResourceMetaData())
+				output.push_back(resMeta->getUUID());
+		}
+
+		return output;
+	}
+
+	void ProjectLibrary::updateReferences(const UUID& uuid, const Path& importedPath)
+	{
+		// Only reads the resource header, the resource itself doesn't need to be loaded
+		mReferenceIndex->setReferences(uuid, gResources().getDependencies(importedPath));
+	}
+
+	void ProjectLibrary::rebuildReferenceIndex()
+	{
+		mReferenceIndex->clear();
+
+		for (auto& entry : mUUIDToPath)
+		{
+			Path importedPath;
+			if (mResourceManifest->uuidToFilePath(entry.first, importedPath) && FileSystem::isFile(importedPath))
+				updateReferences(entry.first, importedPath);
+		}
+	}
+
+	void ProjectLibrary::updateStaleReferences(std::time_t indexTime)
+	{
+		for (auto& entry : mUUIDToPath)
+		{
+			Path importedPath;
+			if (!mResourceManifest->uuidToFilePath(entry.first, importedPath) || !FileSystem::isFile(importedPath))
+				continue;
+
+			if (!mReferenceIndex->contains(entry.first) || FileSystem::getLastModifiedTime(importedPath) > indexTime)
+				updateReferences(entry.first, importedPath);
+		}
+	}
+
 	BS_ED_EXPORT ProjectLibrary& gProjectLibrary()
 	{
 		return ProjectLibrary::instance();
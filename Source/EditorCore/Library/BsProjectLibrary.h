@@ -134,6 +134,42 @@ namespace bs
 		 */
 		Path uuidToPath(const UUID& uuid) const;
 
+		/**
+		 * Returns a list of resources referenced by the resource with the provided UUID (e.g. textures referenced by a
+		 * material). Uses the library reference index and doesn't require the resource to be loaded.
+		 *
+		 * @param[in]	uuid	UUID of the resource to look up.
+		 * @param[out]	output	UUIDs of the referenced resources.
+		 * @return				False if the resource isn't part of the library.
+		 */
+		bool getReferencedResources(const UUID& uuid, Vector<UUID>& output) const;
+
+		/** 
+		 * Returns UUIDs of all resources in the library that reference the resource with the provided UUID. Uses the
+		 * library reference index and doesn't require any resources to be loaded.
+		 */
+		Vector<UUID> getReferencingResources(const UUID& uuid) const;
+
+		/**
+		 * Finds all file entries containing resources that reference any of the resources in the entry at the provided
+		 * path. The entry itself is not included, even if its resources reference each other. If the entry is a folder,
+		 * all resources within it are checked, and entries within the folder are not included.
+		 *
+		 * @param[in]	path	Path to the entry, either absolute or relative to resources folder. If a sub-resource is
+		 *						provided only references to that sub-resource are returned.
+		 * @return				A list of referencing entries. Values returned by this method are transient, they may be
+		 *						destroyed on any following ProjectLibrary call.
+		 */
+		Vector<USPtr<LibraryEntry>> findReferencingEntries(const Path& path) const;
+
+		/**
+		 * Checks are any of the resources in the entry at the provided path referenced by resources in other entries.
+		 * Deleting a referenced entry will break the references.
+		 *
+		 * @param[in]	path	Path to the entry, either absolute or relative to resources folder.
+		 */
+		bool isReferenced(const Path& path) const;
+
 		/**
 		 * Registers a new resource in the library.
 		 *
@@ -150,8 +186,29 @@ namespace bs
 		 */
 		void createFolderEntry(const Path& path);
 
-		/**	Updates a resource that is already in the library. */
-		void saveEntry(const HResource& resource);
+		/**
+		 * Updates a resource that is already in the library.
+		 *
+		 * @param[in]	resource	Resource to save. Must have previously been registered with the library.
+		 * @param[in]	synchronous	If true the resource will be written to disk on the calling thread. If false the
+		 *							resource will be encoded and written on a worker thread, into a temporary file that 
+		 *							replaces the existing file once complete. The resource is encoded directly from
+		 *							its live copy, so the caller must pass a resource nothing else is modifying (e.g.
+		 *							a freshly updated snapshot), and must not modify it until the save completes (see
+		 *							waitForQueuedSave()). load() waits for the save before returning the resource.
+		 *							You must call _finishQueuedImports() to finalize the save once the worker thread
+		 *							finishes.
+		 */
+		void saveEntry(const HResource& resource, bool synchronous = true);
+
+		/** 
+		 * Blocks until any asynchronous save operation queued for the provided resource finishes. Does nothing if the
+		 * resource isn't being saved.
+		 */
+		void waitForQueuedSave(const HResource& resource);
+
+		/** Blocks until all queued asynchronous save operations finish. */
+		void waitForQueuedSaves();
 
 		/**
 		 * Moves a library entry from one path to another.
@@ -254,6 +311,9 @@ namespace bs
 		/** Returns the number of resources currently queued for import. */
 		UINT32 getInProgressImportCount() const { return (UINT32)mQueuedImports.size(); }
 
+		/** Returns the number of resources currently being asynchronously saved. */
+		UINT32 getInProgressSaveCount() const { return (UINT32)mQueuedSaves.size(); }
+
 		/**
 		 * Saves all the project library data so it may be restored later, at the default save location in the project
 		 * folder. Project must be loaded when calling this.
@@ -278,6 +338,14 @@ namespace bs
 		/** Triggered when a resource is being (re)imported. Path provided is absolute. */
 		Event<void(const Path&)> onEntryImported; 
 
+		/**
+		 * Triggered at most once per _finishQueuedImports() call, with a list of all entries added and removed since the
+		 * last time the event was triggered. Paths provided are absolute. Preferable to onEntryAdded and onEntryRemoved
+		 * when many entries can change at once (e.g. when a large folder is imported or deleted). The same path can be
+		 * present in both lists, in which case the current state of the library should be used to resolve it.
+		 */
+		Event<void(const Vector<Path>&, const Vector<Path>&)> onEntriesChanged;
+
 		/** @name Internal 
 		 *  @{
 		 */
@@ -286,10 +354,11 @@ namespace bs
 		const SPtr<ResourceManifest>& _getManifest() const { return mResourceManifest; }
 
 		/** 
-		 * Iterates over any queued import operations, checks if they have finished and finalizes them. This should be
-		 * called on a regular basis (e.g. every frame).
+		 * Iterates over any queued import and save operations, checks if they have finished and finalizes them. This 
+		 * should be called on a regular basis (e.g. every frame). Also triggers the onEntriesChanged event with any
+		 * entries added or removed since the last call.
 		 *
-		 * @param[in]	wait	If true the method will block until all imports finish.
+		 * @param[in]	wait	If true the method will block until all imports and saves finish.
 		 */
 		void _finishQueuedImports(bool wait = false);
 
@@ -329,6 +398,14 @@ namespace bs
 			std::time_t timestamp = 0;
 		};
 
+		/** Information about a resource being asynchronously written to disk. */
+		struct QueuedSave
+		{
+			Path filePath;
+			SPtr<Task> saveTask;
+			bool succeeded = false;
+		};
+
 		/**
 		 * Common code for adding a new resource entry to the library.
 		 *
@@ -436,9 +513,50 @@ namespace bs
 		/**	Removes any import dependencies for the specified resource. */
 		void removeDependencies(const FileEntry* entry);
 
-		/**	Finds dependants resource for the specified resource entry and reimports them. */
+		/**	
+		 * Finds dependants resource for the specified resource entry and reimports them. Dependants of dependants are 
+		 * reimported as well.
+		 */
 		void reimportDependants(const Path& entryPath);
 
+		/**
+		 * Returns a hash of the source (ignoring comments and whitespace) of the shader include with the provided UUID, as of
+		 * its last import. If not cached, the hash is calculated from the imported resource file.
+		 *
+		 * @param[in]	uuid			UUID of the shader include.
+		 * @param[in]	importedPath	Path to the imported shader include resource file.
+		 * @param[out]	hash			Hash of the include source.
+		 * @return						False if the include wasn't previously imported.
+		 */
+		bool getIncludeHash(const UUID& uuid, const Path& importedPath, UINT64& hash);
+
+		/** 
+		 * Returns UUIDs of the resources at the provided path. Includes all resources in a file if the path points to a
+		 * file, all resources in all files within a folder (recursively) if it points to a folder, or a single resource
+		 * if it points to a sub-resource.
+		 */
+		Vector<UUID> getResourceUUIDs(const Path& path) const;
+
+		/** 
+		 * Registers the resources the provided resource references with the reference index, reading them from the
+		 * imported resource file.
+		 */
+		void updateReferences(const UUID& uuid, const Path& importedPath);
+
+		/** 
+		 * Rebuilds the reference index from all imported resources in the library. Used when the index is missing (e.g.
+		 * for projects created before the index existed).
+		 */
+		void rebuildReferenceIndex();
+
+		/**
+		 * Updates the reference index entries of resources that are missing from the index, or whose imported files were
+		 * modified after the index was saved (e.g. the editor exited without saving the library after an import).
+		 *
+		 * @param[in]	indexTime	Last modified time of the loaded reference index file.
+		 */
+		void updateStaleReferences(std::time_t indexTime);
+
 		/**	Makes all library entry paths relative to the current resources folder. */
 		void makeEntriesRelative();
 
@@ -469,10 +587,28 @@ namespace bs
 		 */
 		void waitForQueuedImport(FileEntry* fileEntry);
 
+		/** 
+		 * Finalizes a queued save operation if the save task has finished, by triggering a reimport of the saved file.
+		 *
+		 * @param[in]	save			Structure containing information about the save.
+		 * @param[in]	wait			If true waits until the asynchronous save task finishes before returning.
+		 * @return						True if the save was finalized. Will be false if the save task has not yet 
+		 *								finished and @p wait is false.
+		 */
+		bool finishQueuedSave(const QueuedSave& save, bool wait);
+
+		/** Triggers the onEntryAdded event and queues the entry for the next onEntriesChanged event. */
+		void notifyEntryAdded(const Path& path);
+
+		/** Triggers the onEntryRemoved event and queues the entry for the next onEntriesChanged event. */
+		void notifyEntryRemoved(const Path& path);
+
 		static const char* LIBRARY_ENTRIES_FILENAME;
 		static const char* RESOURCE_MANIFEST_FILENAME;
+		static const char* REFERENCE_INDEX_FILENAME;
 
 		SPtr<ResourceManifest> mResourceManifest;
+		SPtr<ResourceReferenceIndex> mReferenceIndex;
 		USPtr<DirectoryEntry> mRootEntry;
 		Path mProjectFolder;
 		Path mResourcesFolder;
@@ -480,9 +616,14 @@ namespace bs
 
 		Mutex mQueuedImportMutex;
 		UnorderedMap<FileEntry*, SPtr<QueuedImport>> mQueuedImports;
+		UnorderedMap<UUID, SPtr<QueuedSave>> mQueuedSaves;
 
 		UnorderedMap<Path, Vector<Path>> mDependencies;
+		UnorderedMap<UUID, UINT64> mIncludeHashes;
 		UnorderedMap<UUID, Path> mUUIDToPath;
+
+		Vector<Path> mPendingAddedEntries;
+		Vector<Path> mPendingRemovedEntries;
 	};
 
 	/**	Provides easy access to ProjectLibrary. */
@@ -0,0 +1,108 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Library/BsResourceReferenceIndex.h"
+#include "Private/RTTI/BsResourceReferenceIndexRTTI.h"
+
+namespace bs
+{
+	void ResourceReferenceIndex::setReferences(const UUID& uuid, const Vector<UUID>& references)
+	{
+		remove(uuid);
+
+		Vector<UUID>& entry = mReferences[uuid];
+		for (auto& reference : references)
+		{
+			// Ignore self-references and duplicates
+			if (reference == uuid || reference.empty())
+				continue;
+
+			if (std::find(entry.begin(), entry.end(), reference) != entry.end())
+				continue;
+
+			entry.push_back(reference);
+			mReferencedBy[reference].insert(uuid);
+		}
+	}
+
+	void ResourceReferenceIndex::remove(const UUID& uuid)
+	{
+		auto iterFind = mReferences.find(uuid);
+		if (iterFind == mReferences.end())
+			return;
+
+		for (auto& reference : iterFind->second)
+		{
+			auto iterReverse = mReferencedBy.find(reference);
+			if (iterReverse == mReferencedBy.end())
+				continue;
+
+			iterReverse->second.erase(uuid);
+			if (iterReverse->second.empty())
+				mReferencedBy.erase(iterReverse);
+		}
+
+		mReferences.erase(iterFind);
+	}
+
+	bool ResourceReferenceIndex::getReferences(const UUID& uuid, Vector<UUID>& output) const
+	{
+		auto iterFind = mReferences.find(uuid);
+		if (iterFind == mReferences.end())
+			return false;
+
+		output = iterFind->second;
+		return true;
+	}
+
+	Vector<UUID> ResourceReferenceIndex::getReferencingResources(const UUID& uuid) const
+	{
+		Vector<UUID> output;
+
+		auto iterFind = mReferencedBy.find(uuid);
+		if (iterFind == mReferencedBy.end())
+			return output;
+
+		output.reserve(iterFind->second.size());
+		for (auto& entry : iterFind->second)
+			output.push_back(entry);
+
+		return output;
+	}
+
+	bool ResourceReferenceIndex::isReferenced(const UUID& uuid) const
+	{
+		return mReferencedBy.find(uuid) != mReferencedBy.end();
+	}
+
+	void ResourceReferenceIndex::clear()
+	{
+		mReferences.clear();
+		mReferencedBy.clear();
+	}
+
+	void ResourceReferenceIndex::rebuildReverseMapping()
+	{
+		mReferencedBy.clear();
+
+		for (auto& entry : mReferences)
+		{
+			for (auto& reference : entry.second)
+				mReferencedBy[reference].insert(entry.first);
+		}
+	}
+
+	SPtr<ResourceReferenceIndex> ResourceReferenceIndex::create()
+	{
+		return bs_shared_ptr_new<ResourceReferenceIndex>();
+	}
+
+	RTTITypeBase* ResourceReferenceIndex::getRTTIStatic()
+	{
+		return ResourceReferenceIndexRTTI::instance();
+	}
+
+	RTTITypeBase* ResourceReferenceIndex::getRTTI() const
+	{
+		return ResourceReferenceIndex::getRTTIStatic();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Reflection/BsIReflectable.h"
+
+namespace bs
+{
+	/** @addtogroup Library
+	 *  @{
+	 */
+
+	/**
+	 * Keeps track of references between resources in the project library (e.g. a material referencing a texture), in
+	 * both directions. Allows queries such as "which resources use this texture" without having to load or scan any of
+	 * the resources.
+	 *
+	 * Only the resource -> referenced resources mapping is serialized. The reverse mapping is rebuilt after
+	 * deserialization.
+	 */
+	class BS_ED_EXPORT ResourceReferenceIndex : public IReflectable
+	{
+	public:
+		ResourceReferenceIndex() = default;
+
+		/**
+		 * Sets a list of resources referenced by the resource with the provided UUID, replacing any previously registered
+		 * references.
+		 */
+		void setReferences(const UUID& uuid, const Vector<UUID>& references);
+
+		/**
+		 * Removes the resource with the provided UUID from the index. Other resources referencing it will still report
+		 * the reference.
+		 */
+		void remove(const UUID& uuid);
+
+		/** Checks does the index contain reference information for the resource with the provided UUID. */
+		bool contains(const UUID& uuid) const { return mReferences.find(uuid) != mReferences.end(); }
+
+		/**
+		 * Returns a list of resources referenced by the resource with the provided UUID. Returns false if the resource is
+		 * not part of the index.
+		 */
+		bool getReferences(const UUID& uuid, Vector<UUID>& output) const;
+
+		/** Returns a list of resources in the index that reference the resource with the provided UUID. */
+		Vector<UUID> getReferencingResources(const UUID& uuid) const;
+
+		/** Checks is the resource with the provided UUID referenced by any resource in the index. */
+		bool isReferenced(const UUID& uuid) const;
+
+		/** Removes all entries from the index. */
+		void clear();
+
+		/** Creates a new empty reference index. */
+		static SPtr<ResourceReferenceIndex> create();
+
+	private:
+		/** Rebuilds the reverse (referenced -> referencing) mapping from the forward mapping. */
+		void rebuildReverseMapping();
+
+		Map<UUID, Vector<UUID>> mReferences;
+		UnorderedMap<UUID, UnorderedSet<UUID>> mReferencedBy;
+
+		/************************************************************************/
+		/* 								RTTI		                     		*/
+		/************************************************************************/
+	public:
+		friend class ResourceReferenceIndexRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
+	/** @} */
+}
\ No newline at end of file
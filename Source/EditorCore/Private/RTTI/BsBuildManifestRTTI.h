@@ -0,0 +1,91 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Reflection/BsRTTIType.h"
+#include "Reflection/BsRTTIPlain.h"
+#include "RTTI/BsStdRTTI.h"
+#include "Build/BsBuildManifest.h"
+
+namespace bs
+{
+	/** @cond RTTI */
+	/** @addtogroup RTTI-Impl-Editor
+	 *  @{
+	 */
+
+	class BuildManifestRTTI : public RTTIType <BuildManifest, IReflectable, BuildManifestRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN(mEntries, 0)
+		BS_END_RTTI_MEMBERS
+	public:
+		BuildManifestRTTI()
+			:mInitMembers(this)
+		{ }
+
+		const String& getRTTIName() override
+		{
+			static String name = "BuildManifest";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_BuildManifest;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr_new<BuildManifest>();
+		}
+	};
+
+	template<> struct RTTIPlainType <BuildManifestEntry>
+	{
+		enum { id = TID_BuildManifestEntry }; enum { hasDynamicSize = 1 };
+
+		static BitLength toMemory(const BuildManifestEntry& data, Bitstream& stream, const RTTIFieldInfo& fieldInfo, 
+			bool compress)
+		{
+			return rtti_write_with_size_header(stream, data, compress, [&data, &stream]()
+			{
+				BitLength size = 0;
+				size += rtti_write(data.inputHash, stream);
+				size += rtti_write(data.outputSize, stream);
+				size += rtti_write((UINT64)data.outputTimestamp, stream);
+
+				return size;
+			});
+		}
+
+		static BitLength fromMemory(BuildManifestEntry& data, Bitstream& stream, const RTTIFieldInfo& fieldInfo, 
+			bool compress)
+		{
+			BitLength size;
+			rtti_read_size_header(stream, compress, size);
+
+			UINT64 timestamp;
+			rtti_read(data.inputHash, stream);
+			rtti_read(data.outputSize, stream);
+			rtti_read(timestamp, stream);
+
+			data.outputTimestamp = (std::time_t)timestamp;
+			return size;
+		}
+
+		static BitLength getSize(const BuildManifestEntry& data, const RTTIFieldInfo& fieldInfo, bool compress)
+		{
+			BitLength dataSize = rtti_size(data.inputHash) + rtti_size(data.outputSize) + 
+				rtti_size((UINT64)data.outputTimestamp);
+
+			rtti_add_header_size(dataSize, compress);
+			return dataSize;
+		}
+	};
+
+	/** @} */
+	/** @endcond */
+}
\ No newline at end of file
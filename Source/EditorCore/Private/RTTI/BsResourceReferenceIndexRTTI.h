@@ -0,0 +1,53 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Reflection/BsRTTIType.h"
+#include "RTTI/BsStdRTTI.h"
+#include "Library/BsResourceReferenceIndex.h"
+
+namespace bs
+{
+	/** @cond RTTI */
+	/** @addtogroup RTTI-Impl-Editor
+	 *  @{
+	 */
+
+	class ResourceReferenceIndexRTTI : public RTTIType <ResourceReferenceIndex, IReflectable, ResourceReferenceIndexRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN(mReferences, 0)
+		BS_END_RTTI_MEMBERS
+	public:
+		ResourceReferenceIndexRTTI()
+			:mInitMembers(this)
+		{ }
+
+		void onDeserializationEnded(IReflectable* obj, SerializationContext* context) override
+		{
+			ResourceReferenceIndex* index = static_cast<ResourceReferenceIndex*>(obj);
+			index->rebuildReverseMapping();
+		}
+
+		const String& getRTTIName() override
+		{
+			static String name = "ResourceReferenceIndex";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_ResourceReferenceIndex;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return ResourceReferenceIndex::create();
+		}
+	};
+
+	/** @} */
+	/** @endcond */
+}
\ No newline at end of file
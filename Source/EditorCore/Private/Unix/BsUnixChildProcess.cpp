@@ -0,0 +1,213 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Utility/BsChildProcess.h"
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <errno.h>
+
+namespace bs
+{
+	/**
+	 * Creates a pipe whose ends are closed on exec. Otherwise every child launched afterwards would inherit them, keeping
+	 * the pipe open after this end is closed, and the reading end would never see an end of file.
+	 */
+	static bool createPipe(int fds[2])
+	{
+#if BS_PLATFORM == BS_PLATFORM_LINUX
+		return pipe2(fds, O_CLOEXEC) == 0;
+#else
+		if (pipe(fds) != 0)
+			return false;
+
+		fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+		fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+		return true;
+#endif
+	}
+
+	struct ChildProcess::Pimpl
+	{
+		pid_t pid = -1;
+		int input = -1;
+		int output = -1;
+		String readBuffer;
+		mutable bool exited = false;
+	};
+
+	ChildProcess::ChildProcess()
+		:m(bs_new<Pimpl>())
+	{ }
+
+	ChildProcess::~ChildProcess()
+	{
+		if (m->input != -1)
+			close(m->input);
+
+		if (m->output != -1)
+			close(m->output);
+
+		if (m->pid != -1 && !m->exited)
+		{
+			// Give the child a chance to exit on its own after noticing its input was closed, but never block forever
+			// on a child that is stuck
+			const UINT32 numPolls = EXIT_TIMEOUT_MS / 10;
+			for (UINT32 i = 0; i < numPolls; i++)
+			{
+				if (waitpid(m->pid, nullptr, WNOHANG) != 0)
+				{
+					m->exited = true;
+					break;
+				}
+
+				usleep(10 * 1000);
+			}
+
+			if (!m->exited)
+			{
+				kill(m->pid, SIGKILL);
+				waitpid(m->pid, nullptr, 0);
+			}
+		}
+
+		bs_delete(m);
+	}
+
+	SPtr<ChildProcess> ChildProcess::create(const Path& executable, const Vector<String>& arguments)
+	{
+		// Writing to a pipe of a child that exited would otherwise terminate the editor. Failed writes are reported
+		// through return values instead.
+		static bool ignoringSigPipe = false;
+		if (!ignoringSigPipe)
+		{
+			signal(SIGPIPE, SIG_IGN);
+			ignoringSigPipe = true;
+		}
+
+		int inputPipe[2];
+		int outputPipe[2];
+
+		if (!createPipe(inputPipe))
+			return nullptr;
+
+		if (!createPipe(outputPipe))
+		{
+			close(inputPipe[0]);
+			close(inputPipe[1]);
+			return nullptr;
+		}
+
+		String executableStr = executable.toString();
+
+		Vector<char*> argv;
+		argv.push_back(const_cast<char*>(executableStr.c_str()));
+		for (auto& entry : arguments)
+			argv.push_back(const_cast<char*>(entry.c_str()));
+
+		argv.push_back(nullptr);
+
+		pid_t pid = fork();
+		if (pid == 0)
+		{
+			// Duplicated descriptors don't inherit the close-on-exec flag, while the originals (and the pipes of any other
+			// children) are closed on exec
+			dup2(inputPipe[0], STDIN_FILENO);
+			dup2(outputPipe[1], STDOUT_FILENO);
+
+			close(inputPipe[0]);
+			close(inputPipe[1]);
+			close(outputPipe[0]);
+			close(outputPipe[1]);
+
+			execvp(argv[0], argv.data());
+			_exit(127);
+		}
+
+		close(inputPipe[0]);
+		close(outputPipe[1]);
+
+		if (pid < 0)
+		{
+			close(inputPipe[1]);
+			close(outputPipe[0]);
+			return nullptr;
+		}
+
+		SPtr<ChildProcess> process = bs_shared_ptr(new (bs_alloc<ChildProcess>()) ChildProcess());
+		process->m->pid = pid;
+		process->m->input = inputPipe[1];
+		process->m->output = outputPipe[0];
+
+		return process;
+	}
+
+	bool ChildProcess::writeLine(const String& line)
+	{
+		String data = line + "\n";
+
+		size_t numWritten = 0;
+		while (numWritten < data.size())
+		{
+			ssize_t result = write(m->input, data.data() + numWritten, data.size() - numWritten);
+			if (result < 0)
+			{
+				if (errno == EINTR)
+					continue;
+
+				return false;
+			}
+
+			numWritten += (size_t)result;
+		}
+
+		return true;
+	}
+
+	bool ChildProcess::readLine(String& line)
+	{
+		while (true)
+		{
+			size_t newlinePos = m->readBuffer.find('\n');
+			if (newlinePos != String::npos)
+			{
+				line = m->readBuffer.substr(0, newlinePos);
+				m->readBuffer.erase(0, newlinePos + 1);
+				return true;
+			}
+
+			char buffer[512];
+			ssize_t numRead = read(m->output, buffer, sizeof(buffer));
+			if (numRead < 0 && errno == EINTR)
+				continue;
+
+			if (numRead <= 0)
+				return false;
+
+			m->readBuffer.append(buffer, (size_t)numRead);
+		}
+	}
+
+	bool ChildProcess::isRunning() const
+	{
+		if (m->pid == -1 || m->exited)
+			return false;
+
+		if (waitpid(m->pid, nullptr, WNOHANG) == 0)
+			return true;
+
+		m->exited = true;
+		return false;
+	}
+
+	void ChildProcess::terminate()
+	{
+		if (!isRunning())
+			return;
+
+		kill(m->pid, SIGKILL);
+		waitpid(m->pid, nullptr, 0);
+		m->exited = true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,194 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Utility/BsChildProcess.h"
+#include "String/BsUnicode.h"
+#include <windows.h>
+
+namespace bs
+{
+	/** Quotes a command line argument so it gets parsed as a single argument by the receiving process. */
+	static WString quoteArgument(const WString& argument)
+	{
+		WString output = L"\"";
+		UINT32 numBackslashes = 0;
+
+		for (auto& entry : argument)
+		{
+			if (entry == L'\\')
+			{
+				numBackslashes++;
+				continue;
+			}
+
+			// Backslashes only need escaping when they precede a quote
+			if (entry == L'"')
+				output.append(numBackslashes * 2 + 1, L'\\');
+			else
+				output.append(numBackslashes, L'\\');
+
+			numBackslashes = 0;
+			output.push_back(entry);
+		}
+
+		output.append(numBackslashes * 2, L'\\');
+		output.push_back(L'"');
+
+		return output;
+	}
+
+	struct ChildProcess::Pimpl
+	{
+		HANDLE process = nullptr;
+		HANDLE input = nullptr;
+		HANDLE output = nullptr;
+		String readBuffer;
+	};
+
+	ChildProcess::ChildProcess()
+		:m(bs_new<Pimpl>())
+	{ }
+
+	ChildProcess::~ChildProcess()
+	{
+		if (m->input != nullptr)
+			CloseHandle(m->input);
+
+		if (m->output != nullptr)
+			CloseHandle(m->output);
+
+		if (m->process != nullptr)
+		{
+			// Give the child a chance to exit on its own after noticing its input was closed, but never block forever
+			// on a child that is stuck
+			if (WaitForSingleObject(m->process, EXIT_TIMEOUT_MS) == WAIT_TIMEOUT)
+			{
+				TerminateProcess(m->process, 1);
+				WaitForSingleObject(m->process, INFINITE);
+			}
+
+			CloseHandle(m->process);
+		}
+
+		bs_delete(m);
+	}
+
+	SPtr<ChildProcess> ChildProcess::create(const Path& executable, const Vector<String>& arguments)
+	{
+		SECURITY_ATTRIBUTES securityAttributes;
+		securityAttributes.nLength = sizeof(SECURITY_ATTRIBUTES);
+		securityAttributes.bInheritHandle = TRUE;
+		securityAttributes.lpSecurityDescriptor = nullptr;
+
+		HANDLE inputRead, inputWrite;
+		if (!CreatePipe(&inputRead, &inputWrite, &securityAttributes, 0))
+			return nullptr;
+
+		HANDLE outputRead, outputWrite;
+		if (!CreatePipe(&outputRead, &outputWrite, &securityAttributes, 0))
+		{
+			CloseHandle(inputRead);
+			CloseHandle(inputWrite);
+			return nullptr;
+		}
+
+		// Only the child ends of the pipes should be inherited
+		SetHandleInformation(inputWrite, HANDLE_FLAG_INHERIT, 0);
+		SetHandleInformation(outputRead, HANDLE_FLAG_INHERIT, 0);
+
+		WString commandLine = quoteArgument(UTF8::toWide(executable.toString()));
+		for (auto& entry : arguments)
+			commandLine += L" " + quoteArgument(UTF8::toWide(entry));
+
+		STARTUPINFOW startupInfo;
+		ZeroMemory(&startupInfo, sizeof(startupInfo));
+		startupInfo.cb = sizeof(startupInfo);
+		startupInfo.dwFlags = STARTF_USESTDHANDLES;
+		startupInfo.hStdInput = inputRead;
+		startupInfo.hStdOutput = outputWrite;
+		startupInfo.hStdError = GetStdHandle(STD_ERROR_HANDLE);
+
+		PROCESS_INFORMATION processInfo;
+		ZeroMemory(&processInfo, sizeof(processInfo));
+
+		BOOL success = CreateProcessW(nullptr, &commandLine[0], nullptr, nullptr, TRUE, CREATE_NO_WINDOW, nullptr,
+			nullptr, &startupInfo, &processInfo);
+
+		CloseHandle(inputRead);
+		CloseHandle(outputWrite);
+
+		if (!success)
+		{
+			CloseHandle(inputWrite);
+			CloseHandle(outputRead);
+			return nullptr;
+		}
+
+		CloseHandle(processInfo.hThread);
+
+		SPtr<ChildProcess> process = bs_shared_ptr(new (bs_alloc<ChildProcess>()) ChildProcess());
+		process->m->process = processInfo.hProcess;
+		process->m->input = inputWrite;
+		process->m->output = outputRead;
+
+		return process;
+	}
+
+	bool ChildProcess::writeLine(const String& line)
+	{
+		String data = line + "\n";
+
+		DWORD numWritten = 0;
+		while (numWritten < (DWORD)data.size())
+		{
+			DWORD result = 0;
+			if (!WriteFile(m->input, data.data() + numWritten, (DWORD)data.size() - numWritten, &result, nullptr))
+				return false;
+
+			numWritten += result;
+		}
+
+		return true;
+	}
+
+	bool ChildProcess::readLine(String& line)
+	{
+		while (true)
+		{
+			size_t newlinePos = m->readBuffer.find('\n');
+			if (newlinePos != String::npos)
+			{
+				line = m->readBuffer.substr(0, newlinePos);
+				m->readBuffer.erase(0, newlinePos + 1);
+
+				if (!line.empty() && line.back() == '\r')
+					line.pop_back();
+
+				return true;
+			}
+
+			char buffer[512];
+			DWORD numRead = 0;
+			if (!ReadFile(m->output, buffer, sizeof(buffer), &numRead, nullptr) || numRead == 0)
+				return false;
+
+			m->readBuffer.append(buffer, numRead);
+		}
+	}
+
+	bool ChildProcess::isRunning() const
+	{
+		if (m->process == nullptr)
+			return false;
+
+		return WaitForSingleObject(m->process, 0) == WAIT_TIMEOUT;
+	}
+
+	void ChildProcess::terminate()
+	{
+		if (!isRunning())
+			return;
+
+		TerminateProcess(m->process, 1);
+		WaitForSingleObject(m->process, INFINITE);
+	}
+}
\ No newline at end of file
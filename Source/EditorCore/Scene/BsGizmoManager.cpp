@@ -9,6 +9,7 @@
 #include "Components/BsCCamera.h"
 #include "Image/BsSpriteTexture.h"
 #include "CoreThread/BsCoreThread.h"
+#include "Utility/BsEditorRenderPacket.h"
 #include "Utility/BsBuiltinEditorResources.h"
 #include "Material/BsMaterial.h"
 #include "RenderAPI/BsGpuParams.h"
@@ -18,6 +19,7 @@
 #include "Renderer/BsRendererUtility.h"
 #include "Renderer/BsRendererManager.h"
 #include "Utility/BsDrawHelper.h"
+#include "Utility/BsEditorProfiler.h"
 
 using namespace std::placeholders;
 
@@ -455,6 +457,8 @@ namespace bs
 
 	void GizmoManager::update(const SPtr<Camera>& camera, const GizmoDrawSettings& drawSettings)
 	{
+		BS_ED_PROFILE_SCOPE("GizmoManager::update");
+
 		mActiveMeshes.clear();
 		mActiveMeshes = mDrawHelper->buildMeshes(DrawHelper::SortType::BackToFront, camera.get());
 
@@ -466,15 +470,18 @@ namespace bs
 		if(mIconMesh != nullptr)
 			iconMesh = mIconMesh->getCore();
 
-		ct::GizmoRenderer* renderer = mGizmoRenderer.get();
-
-		gCoreThread().queueCommand(std::bind(&ct::GizmoRenderer::updateData, renderer, camera->getCore(),
-			proxyData, iconMesh, iconRenderData));
+		EditorRenderPacket::instance().queue([renderer = mGizmoRenderer, coreCamera = camera->getCore(),
+			proxyData = std::move(proxyData), iconMesh = std::move(iconMesh), iconRenderData = std::move(iconRenderData)]()
+		{
+			renderer->updateData(coreCamera, proxyData, iconMesh, iconRenderData);
+		});
 	}
 
 	void GizmoManager::renderForPicking(const SPtr<Camera>& camera, const GizmoDrawSettings& drawSettings, 
 		std::function<Color(UINT32)> idxToColorCallback)
 	{
+		BS_ED_PROFILE_SCOPE("GizmoManager::renderForPicking");
+
 		Vector<IconData> iconData;
 		IconRenderDataVecPtr iconRenderData;
 
@@ -706,11 +713,13 @@ namespace bs
 		mActiveMeshes.clear();
 		mIconMesh = nullptr;
 
-		ct::GizmoRenderer* renderer = mGizmoRenderer.get();
+		SPtr<ct::GizmoRenderer> renderer = mGizmoRenderer;
 		IconRenderDataVecPtr iconRenderData = bs_shared_ptr_new<IconRenderDataVec>();
 		
-		gCoreThread().queueCommand(std::bind(&ct::GizmoRenderer::updateData, renderer,
-			nullptr, Vector<MeshRenderData>(), nullptr, iconRenderData));
+		EditorRenderPacket::instance().queue([renderer, iconRenderData]()
+		{
+			renderer->updateData(nullptr, Vector<MeshRenderData>(), nullptr, iconRenderData);
+		});
 	}
 
 	SPtr<Mesh> GizmoManager::buildIconMesh(const SPtr<Camera>& camera, const GizmoDrawSettings& drawSettings, 
@@ -0,0 +1,162 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Scene/BsPrefabInstanceIndex.h"
+#include "Scene/BsSceneObject.h"
+#include "Scene/BsSceneManager.h"
+#include "Scene/BsPrefab.h"
+#include "Scene/BsPrefabDiff.h"
+#include "Scene/BsPrefabUtility.h"
+
+namespace bs
+{
+	const Vector<HSceneObject> PrefabInstanceIndex::EMPTY_INSTANCES;
+
+	template<class T>
+	void PrefabInstanceIndex::forEachInstanceRoot(const HSceneObject& sceneObject, T callback)
+	{
+		if (sceneObject.isDestroyed())
+			return;
+
+		Stack<HSceneObject> todo;
+		todo.push(sceneObject);
+
+		while (!todo.empty())
+		{
+			HSceneObject current = todo.top();
+			todo.pop();
+
+			const UUID& prefabLink = current->_getPrefabLinkUUID();
+			if (!prefabLink.empty())
+				callback(prefabLink, current);
+
+			UINT32 numChildren = current->getNumChildren();
+			for (UINT32 i = 0; i < numChildren; i++)
+				todo.push(current->getChild(i));
+		}
+	}
+
+	void PrefabInstanceIndex::registerInstance(const HSceneObject& sceneObject)
+	{
+		rebuildIfDirty();
+
+		forEachInstanceRoot(sceneObject, [this](const UUID& prefabUUID, const HSceneObject& instance)
+		{
+			Vector<HSceneObject>& instances = mInstances[prefabUUID];
+
+			auto iterFind = std::find(instances.begin(), instances.end(), instance);
+			if (iterFind == instances.end())
+				instances.push_back(instance);
+		});
+	}
+
+	void PrefabInstanceIndex::unregisterInstance(const HSceneObject& sceneObject)
+	{
+		if (mIsDirty)
+			return;
+
+		forEachInstanceRoot(sceneObject, [this](const UUID& prefabUUID, const HSceneObject& instance)
+		{
+			auto iterFind = mInstances.find(prefabUUID);
+			if (iterFind == mInstances.end())
+				return;
+
+			Vector<HSceneObject>& instances = iterFind->second;
+			instances.erase(std::remove(instances.begin(), instances.end(), instance), instances.end());
+
+			if (instances.empty())
+				mInstances.erase(iterFind);
+		});
+	}
+
+	const Vector<HSceneObject>& PrefabInstanceIndex::getInstances(const UUID& prefabUUID)
+	{
+		rebuildIfDirty();
+
+		auto iterFind = mInstances.find(prefabUUID);
+		if (iterFind == mInstances.end())
+			return EMPTY_INSTANCES;
+
+		pruneInstances(prefabUUID, iterFind->second);
+		if (iterFind->second.empty())
+		{
+			mInstances.erase(iterFind);
+			return EMPTY_INSTANCES;
+		}
+
+		return iterFind->second;
+	}
+
+	Vector<UUID> PrefabInstanceIndex::getIndexedPrefabs()
+	{
+		rebuildIfDirty();
+
+		Vector<UUID> output;
+		output.reserve(mInstances.size());
+
+		for (auto& entry : mInstances)
+			output.push_back(entry.first);
+
+		return output;
+	}
+
+	void PrefabInstanceIndex::rebuild()
+	{
+		mInstances.clear();
+		mSceneRoot = gSceneManager().getMainScene()->getRoot();
+		mIsDirty = false;
+
+		forEachInstanceRoot(mSceneRoot, [this](const UUID& prefabUUID, const HSceneObject& instance)
+		{
+			mInstances[prefabUUID].push_back(instance);
+		});
+	}
+
+	void PrefabInstanceIndex::recordInstanceDiffs(const HPrefab& prefab, const HSceneObject& exclude)
+	{
+		if (!prefab.isLoaded())
+			return;
+
+		HSceneObject prefabRoot = prefab->_getRoot();
+		const Vector<HSceneObject>& instances = getInstances(prefab->getUUID());
+		for (auto& instance : instances)
+		{
+			if (instance == exclude)
+				continue;
+
+			instance->_setPrefabDiff(PrefabDiff::create(prefabRoot, instance));
+		}
+	}
+
+	void PrefabInstanceIndex::updateInstances(const HPrefab& prefab)
+	{
+		if (!prefab.isLoaded())
+			return;
+
+		// Copy since the update can modify the hierarchy, and therefore the index
+		Vector<HSceneObject> instances = getInstances(prefab->getUUID());
+		for (auto& instance : instances)
+		{
+			if (!instance.isDestroyed(true))
+				PrefabUtility::updateFromPrefab(instance);
+		}
+	}
+
+	void PrefabInstanceIndex::rebuildIfDirty()
+	{
+		if (!mIsDirty && mSceneRoot == gSceneManager().getMainScene()->getRoot())
+			return;
+
+		rebuild();
+	}
+
+	void PrefabInstanceIndex::pruneInstances(const UUID& prefabUUID, Vector<HSceneObject>& instances)
+	{
+		auto iterRemove = std::remove_if(instances.begin(), instances.end(),
+			[&prefabUUID](const HSceneObject& instance)
+		{
+			return instance.isDestroyed(true) || instance->_getPrefabLinkUUID() != prefabUUID;
+		});
+
+		instances.erase(iterRemove, instances.end());
+	}
+}
\ No newline at end of file
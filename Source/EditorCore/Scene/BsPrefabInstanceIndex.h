@@ -0,0 +1,94 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Utility/BsModule.h"
+
+namespace bs
+{
+	/** @addtogroup Scene-Editor
+	 *  @{
+	 */
+
+	/**
+	 * Keeps track of all prefab instance roots in the currently loaded scene, indexed by the UUID of the prefab they are
+	 * linked to. Allows operations that need to find instances of a particular prefab (e.g. applying prefab changes) to
+	 * touch only the relevant instances instead of walking the entire scene hierarchy.
+	 *
+	 * The index is kept in sync by the editor commands that instantiate, clone, break or destroy prefab instances, by the
+	 * prefab revert and update operations, and by SerializedSceneObject::restore(). Destroyed and unlinked instances are
+	 * lazily pruned on query, and the index is rebuilt from scratch whenever the main scene root changes (e.g. when a new
+	 * scene is loaded). Editor scripts should instantiate prefabs through the UndoRedo commands so the instances get
+	 * registered. Instances created by calling Prefab::instantiate() directly are not tracked until the
+	 * next rebuild, which can be forced with markDirty().
+	 */
+	class BS_ED_EXPORT PrefabInstanceIndex : public Module<PrefabInstanceIndex>
+	{
+	public:
+		/**
+		 * Registers a scene object hierarchy with the index. Any prefab instance roots in the hierarchy (including the
+		 * provided object and any nested instances) will be added to the index.
+		 */
+		void registerInstance(const HSceneObject& sceneObject);
+
+		/**
+		 * Removes a scene object hierarchy from the index. Any prefab instance roots in the hierarchy (including the
+		 * provided object and any nested instances) will be removed from the index.
+		 */
+		void unregisterInstance(const HSceneObject& sceneObject);
+
+		/**
+		 * Returns all live prefab instance roots linked to the prefab with the specified UUID. Instances that were
+		 * destroyed or had their link broken since they were registered are removed before returning.
+		 */
+		const Vector<HSceneObject>& getInstances(const UUID& prefabUUID);
+
+		/** Returns the UUIDs of all prefabs that currently have at least one instance registered in the index. */
+		Vector<UUID> getIndexedPrefabs();
+
+		/** Marks the index as out of date, causing it to be rebuilt from the scene hierarchy on next query. */
+		void markDirty() { mIsDirty = true; }
+
+		/** Rebuilds the index by walking the entire main scene hierarchy. */
+		void rebuild();
+
+		/**
+		 * Records the prefab diff for every indexed instance of the provided prefab, so their instance specific changes
+		 * can be restored after the prefab is modified. Should be called before the prefab is modified.
+		 *
+		 * @param[in]	prefab		Prefab whose instances to record the diffs for. Must be loaded.
+		 * @param[in]	exclude		Optional instance to skip. Normally the instance the prefab is being updated from,
+		 *							as it will match the prefab after the update.
+		 */
+		void recordInstanceDiffs(const HPrefab& prefab, const HSceneObject& exclude = HSceneObject());
+
+		/**
+		 * Updates every indexed instance of the provided prefab so it reflects the current contents of the prefab. Any
+		 * instance specific changes recorded in the instance's prefab diff are re-applied after the update.
+		 */
+		void updateInstances(const HPrefab& prefab);
+
+	private:
+		/** Rebuilds the index if it was marked dirty, or if the main scene root changed since the last rebuild. */
+		void rebuildIfDirty();
+
+		/**
+		 * Finds all prefab instance roots in the hierarchy of the provided object (including the object itself) and calls
+		 * the provided callback for each of them.
+		 */
+		template<class T>
+		void forEachInstanceRoot(const HSceneObject& sceneObject, T callback);
+
+		/** Removes instances that were destroyed or whose prefab link no longer matches the provided UUID. */
+		static void pruneInstances(const UUID& prefabUUID, Vector<HSceneObject>& instances);
+
+		UnorderedMap<UUID, Vector<HSceneObject>> mInstances;
+		HSceneObject mSceneRoot;
+		bool mIsDirty = true;
+
+		static const Vector<HSceneObject> EMPTY_INSTANCES;
+	};
+
+	/** @} */
+}
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include "Components/BsCCamera.h"
 #include "Math/BsRect3.h"
 #include "CoreThread/BsCoreThread.h"
+#include "Utility/BsEditorRenderPacket.h"
 #include "Settings/BsEditorSettings.h"
 #include "Renderer/BsRendererManager.h"
 #include "Renderer/BsRenderer.h"
@@ -93,9 +94,8 @@ namespace bs
 				break;
 			}
 
-			ct::SceneGridRenderer* renderer = mRenderer.get();
-			gCoreThread().queueCommand(
-				std::bind(&ct::SceneGridRenderer::updateData, renderer, mGridMesh->getCore(), mSpacing,
+			EditorRenderPacket::instance().queue(
+				std::bind(&ct::SceneGridRenderer::updateData, mRenderer, mGridMesh->getCore(), mSpacing,
 				mMode == GridMode::Perspective, gridPlaneNormal));
 
 			mCoreDirty = false;
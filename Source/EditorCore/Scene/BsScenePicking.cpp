@@ -25,13 +25,29 @@
 #include "Renderer/BsRenderer.h"
 #include "Scene/BsGizmoManager.h"
 #include "Renderer/BsRendererUtility.h"
+#include "Utility/BsEditorProfiler.h"
 
 using namespace std::placeholders;
 
 namespace bs
 {
 	ScenePicking::ScenePicking()
+		:mCore(nullptr)
+	{ }
+
+	ScenePicking::~ScenePicking()
+	{
+		if (mCore != nullptr)
+			gCoreThread().queueCommand(std::bind(&ct::ScenePicking::destroy, mCore));
+	}
+
+	ct::ScenePicking* ScenePicking::getCore()
 	{
+		if (mCore != nullptr)
+			return mCore;
+
+		BS_ED_PROFILE_SCOPE("ScenePicking::initialize");
+
 		mCore = bs_new<ct::ScenePicking>();
 
 		for (UINT32 i = 0; i < 3; i++)
@@ -43,12 +59,10 @@ namespace bs
 			mCore->mMaterials[3 + i] = matPickingAlpha->getCore();
 		}
 
+		// Queued before any picking commands, so the core thread always compiles the materials before first use
 		gCoreThread().queueCommand(std::bind(&ct::ScenePicking::initialize, mCore));
-	}
 
-	ScenePicking::~ScenePicking()
-	{
-		gCoreThread().queueCommand(std::bind(&ct::ScenePicking::destroy, mCore));
+		return mCore;
 	}
 
 	HSceneObject ScenePicking::pickClosestObject(const SPtr<Camera>& cam, const GizmoDrawSettings& gizmoDrawSettings,
@@ -70,6 +84,62 @@ namespace bs
 
 	Vector<HSceneObject> ScenePicking::pickObjects(const SPtr<Camera>& cam, const GizmoDrawSettings& gizmoDrawSettings,
 		const Vector2I& position, const Vector2I& area, Vector<HSceneObject>& ignoreRenderables, SnapData* data)
+	{
+		BS_ED_PROFILE_SCOPE("ScenePicking::pickObjects");
+
+		Map<UINT32, HSceneObject> idxToRenderable;
+		RenderableSet pickData = gatherRenderables(cam, ignoreRenderables, idxToRenderable);
+
+		UINT32 firstGizmoIdx = (UINT32)pickData.size();
+
+		ct::ScenePicking* core = getCore();
+		SPtr<ct::RenderTarget> target = cam->getViewport()->getTarget()->getCore();
+		gCoreThread().queueCommand(std::bind(&ct::ScenePicking::corePickingBegin, core, target,
+			cam->getViewport()->getArea(), std::cref(pickData), position, area));
+
+		GizmoManager::instance().renderForPicking(cam, gizmoDrawSettings, 
+			[&](UINT32 inputIdx) { return encodeIndex(firstGizmoIdx + inputIdx); });
+
+		AsyncOp op = gCoreThread().queueReturnCommand(std::bind(&ct::ScenePicking::corePickingEnd, core, target,
+			cam->getViewport()->getArea(), position, area, data != nullptr, _1));
+		gCoreThread().submit(true);
+
+		assert(op.hasCompleted());
+
+		PickResults pickResults = any_cast<PickResults>(op.getGenericReturnValue());
+		if (data != nullptr)
+		{
+			data->pickPosition = cam->screenToWorldPointDeviceDepth(position, pickResults.depth);
+			data->normal = pickResults.normal;
+		}
+
+		Vector<UINT32> selectedObjects = pickResults.objects;
+		Vector<HSceneObject> results;
+
+		for (auto& selectedObjectIdx : selectedObjects)
+		{
+			if (selectedObjectIdx < firstGizmoIdx)
+			{
+				auto iterFind = idxToRenderable.find(selectedObjectIdx);
+
+				if (iterFind != idxToRenderable.end())
+					results.push_back(iterFind->second);
+			}
+			else
+			{
+				UINT32 gizmoIdx = selectedObjectIdx - firstGizmoIdx;
+
+				HSceneObject so = GizmoManager::instance().getSceneObject(gizmoIdx);
+				if (so)
+					results.push_back(so);
+			}
+		}
+
+		return results;
+	}
+
+	ScenePicking::RenderableSet ScenePicking::gatherRenderables(const SPtr<Camera>& cam, 
+		const Vector<HSceneObject>& ignoreRenderables, Map<UINT32, HSceneObject>& idxToRenderable) const
 	{
 		auto comparePickElement = [&] (const ScenePicking::RenderablePickData& a, const ScenePicking::RenderablePickData& b)
 		{
@@ -89,7 +159,6 @@ namespace bs
 
 		Vector<HRenderable> renderables = gSceneManager().findComponents<CRenderable>(true);
 		RenderableSet pickData(comparePickElement);
-		Map<UINT32, HSceneObject> idxToRenderable;
 
 		for (auto& renderable : renderables)
 		{
@@ -160,51 +229,88 @@ namespace bs
 			}
 		}
 
-		UINT32 firstGizmoIdx = (UINT32)pickData.size();
+		return pickData;
+	}
 
-		SPtr<ct::RenderTarget> target = cam->getViewport()->getTarget()->getCore();
-		gCoreThread().queueCommand(std::bind(&ct::ScenePicking::corePickingBegin, mCore, target,
-			cam->getViewport()->getArea(), std::cref(pickData), position, area));
+	SPtr<SnapCache> ScenePicking::captureSnapCache(const SPtr<Camera>& cam, const Vector<HSceneObject>& ignoreRenderables)
+	{
+		BS_ED_PROFILE_SCOPE("ScenePicking::captureSnapCache");
 
-		GizmoManager::instance().renderForPicking(cam, gizmoDrawSettings, 
-			[&](UINT32 inputIdx) { return encodeIndex(firstGizmoIdx + inputIdx); });
+		SPtr<SnapCache> cache = bs_shared_ptr_new<SnapCache>();
+		cache->viewProjMatrix = cam->getProjectionMatrixRS() * cam->getViewMatrix();
 
-		AsyncOp op = gCoreThread().queueReturnCommand(std::bind(&ct::ScenePicking::corePickingEnd, mCore, target,
-			cam->getViewport()->getArea(), position, area, data != nullptr, _1));
+		RenderableSet pickData = gatherRenderables(cam, ignoreRenderables, cache->objects);
+
+		const SPtr<RenderTarget>& target = cam->getViewport()->getTarget();
+		const RenderTargetProperties& rtProps = target->getProperties();
+		Vector2I area((INT32)rtProps.width, (INT32)rtProps.height);
+
+		ct::ScenePicking* core = getCore();
+		gCoreThread().queueCommand(std::bind(&ct::ScenePicking::corePickingBegin, core, target->getCore(),
+			cam->getViewport()->getArea(), std::cref(pickData), Vector2I(0, 0), area));
+
+		AsyncOp op = gCoreThread().queueReturnCommand(std::bind(&ct::ScenePicking::coreReadPickBuffers, core,
+			target->getCore(), _1));
 		gCoreThread().submit(true);
 
 		assert(op.hasCompleted());
 
-		PickResults pickResults = any_cast<PickResults>(op.getGenericReturnValue());
-		if (data != nullptr)
+		cache->buffers = any_cast<PickBuffers>(op.getGenericReturnValue());
+		return cache;
+	}
+
+	bool ScenePicking::isSnapCacheValid(const SnapCache& cache, const SPtr<Camera>& cam) const
+	{
+		if (cache.buffers.objects == nullptr)
+			return false;
+
+		const RenderTargetProperties& rtProps = cam->getViewport()->getTarget()->getProperties();
+		if (rtProps.width != cache.buffers.objects->getWidth() || rtProps.height != cache.buffers.objects->getHeight())
+			return false;
+
+		return cache.viewProjMatrix == cam->getProjectionMatrixRS() * cam->getViewMatrix();
+	}
+
+	HSceneObject ScenePicking::snapCached(const SPtr<Camera>& cam, const SnapCache& cache, const Vector2I& position, 
+		SnapData& data) const
+	{
+		const PickBuffers& buffers = cache.buffers;
+		if (buffers.objects == nullptr)
+			return HSceneObject();
+
+		if (position.x < 0 || position.x >= (INT32)buffers.objects->getWidth() ||
+			position.y < 0 || position.y >= (INT32)buffers.objects->getHeight())
 		{
-			data->pickPosition = cam->screenToWorldPointDeviceDepth(position, pickResults.depth);
-			data->normal = pickResults.normal;
+			return HSceneObject();
 		}
 
-		Vector<UINT32> selectedObjects = pickResults.objects;
-		Vector<HSceneObject> results;
+		Vector2I samplePixel = position;
+		if (buffers.flipped)
+			samplePixel.y = buffers.objects->getHeight() - (position.y + 1);
 
-		for (auto& selectedObjectIdx : selectedObjects)
-		{
-			if (selectedObjectIdx < firstGizmoIdx)
-			{
-				auto iterFind = idxToRenderable.find(selectedObjectIdx);
+		float depth = buffers.depth->getDepthAt(samplePixel.x, samplePixel.y);
+		depth = depth * Math::abs(buffers.maxDepth - buffers.minDepth) + buffers.minDepth;
 
-				if (iterFind != idxToRenderable.end())
-					results.push_back(iterFind->second);
-			}
-			else
-			{
-				UINT32 gizmoIdx = selectedObjectIdx - firstGizmoIdx;
+		Color normal = buffers.normals->getColorAt(samplePixel.x, samplePixel.y);
 
-				HSceneObject so = GizmoManager::instance().getSceneObject(gizmoIdx);
-				if (so)
-					results.push_back(so);
-			}
-		}
+		data.pickPosition = cam->screenToWorldPointDeviceDepth(position, depth);
+		data.normal = Vector3((normal.r * 2) - 1, (normal.g * 2) - 1, (normal.b * 2) - 1);
 
-		return results;
+		UINT32 index = decodeIndex(buffers.objects->getColorAt(samplePixel.x, samplePixel.y));
+		if (index == 0x00FFFFFF) // Nothing selected
+			return HSceneObject();
+
+		auto iterFind = cache.objects.find(index);
+		if (iterFind == cache.objects.end() || iterFind->second.isDestroyed())
+			return HSceneObject();
+
+		HSceneObject so = iterFind->second;
+
+		Matrix3 rotation;
+		so->getTransform().getRotation().toRotationMatrix(rotation);
+		data.normal = rotation.inverse().transpose().multiply(data.normal);
+
+		return so;
 	}
 
 	Color ScenePicking::encodeIndex(UINT32 index)
@@ -481,5 +587,40 @@ namespace bs
 		result.objects = objects;
 		asyncOp._completeOperation(result);
 	}
+
+	void ScenePicking::coreReadPickBuffers(const SPtr<RenderTarget>& target, AsyncOp& asyncOp)
+	{
+		const RenderTargetProperties& rtProps = target->getProperties();
+		RenderAPI& rs = RenderAPI::instance();
+
+		rs.setRenderTarget(nullptr);
+		rs.submitCommandBuffer(nullptr);
+
+		if (rtProps.isWindow)
+		{
+			BS_EXCEPT(NotImplementedException, "Picking is not supported on render windows as framebuffer readback methods aren't implemented");
+		}
+
+		SPtr<Texture> outputTexture = mPickingTexture->getColorTexture(0);
+		SPtr<Texture> normalsTexture = mPickingTexture->getColorTexture(1);
+		SPtr<Texture> depthTexture = mPickingTexture->getDepthStencilTexture();
+
+		PickBuffers result;
+		result.objects = outputTexture->getProperties().allocBuffer(0, 0);
+		result.normals = normalsTexture->getProperties().allocBuffer(0, 0);
+		result.depth = depthTexture->getProperties().allocBuffer(0, 0);
+
+		outputTexture->readData(*result.objects);
+		normalsTexture->readData(*result.normals);
+		depthTexture->readData(*result.depth);
+
+		const RenderAPICapabilities& caps = gCaps();
+		result.flipped = rtProps.requiresTextureFlipping;
+		result.minDepth = caps.minDepth;
+		result.maxDepth = caps.maxDepth;
+
+		mPickingTexture = nullptr;
+		asyncOp._completeOperation(result);
+	}
 	}
 }
@@ -31,6 +31,29 @@ namespace bs
 		float depth;
 	};
 
+	/** Contents of the picking render targets over the entire viewport, read back to the CPU. */
+	struct PickBuffers
+	{
+		SPtr<PixelData> objects;
+		SPtr<PixelData> normals;
+		SPtr<PixelData> depth;
+		bool flipped = false;
+		float minDepth = 0.0f;
+		float maxDepth = 1.0f;
+	};
+
+	/**
+	 * Picking buffers of a camera's viewport captured at a specific point in time, along with the objects they reference.
+	 * Allows repeated snap queries (e.g. while dragging an object across the scene) to be answered by a simple lookup,
+	 * without rendering or waiting on the core thread. Created through ScenePicking::captureSnapCache().
+	 */
+	struct SnapCache
+	{
+		PickBuffers buffers;
+		Map<UINT32, HSceneObject> objects;
+		Matrix4 viewProjMatrix;
+	};
+
 	namespace ct { class ScenePicking; }
 
 	/**	Handles picking of scene objects with a pointer in scene view. */
@@ -84,11 +107,55 @@ namespace bs
 			const Vector2I& position, const Vector2I& area, Vector<HSceneObject>& ignoreRenderables, 
 			SnapData* data = nullptr);
 
+		/**
+		 * Renders the entire viewport of the provided camera for picking and reads back the results, so that later snap
+		 * queries can be answered using snapCached(). Gizmos are not included.
+		 *
+		 * @param[in]	cam					Camera to perform the picking from.
+		 * @param[in]	ignoreRenderables	A list of objects that should be ignored during scene picking, normally the
+		 *									objects being snapped.
+		 * @return							Captured picking buffers.
+		 */
+		SPtr<SnapCache> captureSnapCache(const SPtr<Camera>& cam, const Vector<HSceneObject>& ignoreRenderables);
+
+		/** Checks if the snap cache still represents the current view of the provided camera. */
+		bool isSnapCacheValid(const SnapCache& cache, const SPtr<Camera>& cam) const;
+
+		/**
+		 * Finds the scene object under the provided position using previously captured picking buffers. Equivalent to
+		 * calling pickClosestObject() with a (1, 1) area, at the time the cache was captured.
+		 *
+		 * @param[in]	cam			Camera the cache was captured from.
+		 * @param[in]	cache		Picking buffers captured by captureSnapCache().
+		 * @param[in]	position	Pointer position relative to the camera viewport, in pixels.
+		 * @param[out]	data		Picking data regarding position and normal.
+		 * @return					Scene object under the provided position, or an empty handle if no object is found.
+		 */
+		HSceneObject snapCached(const SPtr<Camera>& cam, const SnapCache& cache, const Vector2I& position, 
+			SnapData& data) const;
+
 	private:
 		friend class ct::ScenePicking;
 
 		typedef Set<RenderablePickData, std::function<bool(const RenderablePickData&, const RenderablePickData&)>> RenderableSet;
 
+		/**
+		 * Finds all renderables visible from the provided camera and prepares them for picking.
+		 *
+		 * @param[in]	cam					Camera to perform the picking from.
+		 * @param[in]	ignoreRenderables	A list of objects that should be ignored during scene picking.
+		 * @param[out]	idxToRenderable		Maps the pickable indices of the renderables to their scene objects.
+		 * @return							Pickable renderables, sorted for rendering.
+		 */
+		RenderableSet gatherRenderables(const SPtr<Camera>& cam, const Vector<HSceneObject>& ignoreRenderables,
+			Map<UINT32, HSceneObject>& idxToRenderable) const;
+
+		/**
+		 * Returns the core thread picking manager, creating it on first use. Picking materials are only created and
+		 * compiled once picking is actually performed, rather than during editor start-up.
+		 */
+		ct::ScenePicking* getCore();
+
 		/**	Encodes a pickable object identifier to a unique color. */
 		static Color encodeIndex(UINT32 index);
 
@@ -153,6 +220,16 @@ namespace bs
 		void corePickingEnd(const SPtr<RenderTarget>& target, const Rect2& viewportArea, const Vector2I& position,
 			const Vector2I& area, bool gatherSnapData, AsyncOp& asyncOp);
 
+		/**
+		 * Ends picking operation started by corePickingBegin() and reads back the entire contents of the picking render
+		 * targets.
+		 *
+		 * @param[in]	target			Render target we're rendering to.
+		 * @param[out]	asyncOp			Async operation handle that when complete will contain the read back buffers in the
+		 *								form of PickBuffers.
+		 */
+		void coreReadPickBuffers(const SPtr<RenderTarget>& target, AsyncOp& asyncOp);
+
 	private:
 		friend class bs::ScenePicking;
 
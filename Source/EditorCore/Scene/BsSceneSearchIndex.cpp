@@ -0,0 +1,244 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Scene/BsSceneSearchIndex.h"
+#include "Scene/BsSceneObject.h"
+#include "Scene/BsComponent.h"
+#include "Reflection/BsRTTIType.h"
+
+namespace bs
+{
+	void SceneSearchIndex::addObject(const HSceneObject& sceneObject)
+	{
+		if (sceneObject.isDestroyed())
+			return;
+
+		String name = sceneObject->getName();
+		StringUtil::toLowerCase(name);
+
+		// Components are searchable both by their type and by their name, as managed components share a single
+		// native type but are named after their managed type
+		Vector<String> types;
+		for (auto& component : sceneObject->getComponents())
+		{
+			String typeName = component->getRTTI()->getRTTIName();
+			String componentName = component->getName();
+
+			StringUtil::toLowerCase(typeName);
+			StringUtil::toLowerCase(componentName);
+
+			if (std::find(types.begin(), types.end(), typeName) == types.end())
+				types.push_back(typeName);
+
+			if (!componentName.empty() && std::find(types.begin(), types.end(), componentName) == types.end())
+				types.push_back(componentName);
+		}
+
+		const UINT64 instanceId = sceneObject.getInstanceId();
+		auto iterFind = mEntries.find(instanceId);
+		if (iterFind != mEntries.end())
+		{
+			Entry& entry = iterFind->second;
+			if (entry.name != name)
+			{
+				indexName(instanceId, entry.name, false);
+				indexName(instanceId, name, true);
+				entry.name = name;
+			}
+
+			if (entry.types != types)
+			{
+				indexTypes(instanceId, entry.types, false);
+				indexTypes(instanceId, types, true);
+				entry.types = types;
+			}
+
+			return;
+		}
+
+		indexName(instanceId, name, true);
+		indexTypes(instanceId, types, true);
+
+		Entry& entry = mEntries[instanceId];
+		entry.name = std::move(name);
+		entry.types = std::move(types);
+	}
+
+	void SceneSearchIndex::removeObject(UINT64 instanceId)
+	{
+		auto iterFind = mEntries.find(instanceId);
+		if (iterFind == mEntries.end())
+			return;
+
+		indexName(instanceId, iterFind->second.name, false);
+		indexTypes(instanceId, iterFind->second.types, false);
+
+		mEntries.erase(iterFind);
+	}
+
+	void SceneSearchIndex::clear()
+	{
+		mEntries.clear();
+		mTrigrams.clear();
+		mTypes.clear();
+	}
+
+	Vector<UINT64> SceneSearchIndex::find(const String& query) const
+	{
+		String lowerQuery = query;
+		StringUtil::toLowerCase(lowerQuery);
+
+		String namePattern;
+		Vector<String> typePatterns;
+		for (auto& token : StringUtil::split(lowerQuery, " \t"))
+		{
+			if (token.empty())
+				continue;
+
+			if (token.size() > 2 && token[0] == 't' && token[1] == ':')
+				typePatterns.push_back(token.substr(2));
+			else
+			{
+				if (!namePattern.empty())
+					namePattern += ' ';
+
+				namePattern += token;
+			}
+		}
+
+		Vector<UINT64> output;
+		if (namePattern.empty() && typePatterns.empty())
+			return output;
+
+		// Find objects with a component matching each of the type patterns. The number of distinct component types is
+		// small, so a substring search over all of them is cheap.
+		bool filterByType = !typePatterns.empty();
+		UnorderedSet<UINT64> typeMatches;
+		for (UINT32 i = 0; i < (UINT32)typePatterns.size(); i++)
+		{
+			UnorderedSet<UINT64> patternMatches;
+			for (auto& type : mTypes)
+			{
+				if (type.first.find(typePatterns[i]) == String::npos)
+					continue;
+
+				if (i == 0)
+					patternMatches.insert(type.second.begin(), type.second.end());
+				else
+				{
+					for (auto& instanceId : type.second)
+					{
+						if (typeMatches.find(instanceId) != typeMatches.end())
+							patternMatches.insert(instanceId);
+					}
+				}
+			}
+
+			typeMatches.swap(patternMatches);
+			if (typeMatches.empty())
+				return output;
+		}
+
+		auto matchesName = [&](UINT64 instanceId)
+		{
+			if (namePattern.empty())
+				return true;
+
+			auto iterFind = mEntries.find(instanceId);
+			return iterFind != mEntries.end() && iterFind->second.name.find(namePattern) != String::npos;
+		};
+
+		// Patterns too short to contain a trigram need to check every candidate
+		if (namePattern.size() < 3)
+		{
+			if (filterByType)
+			{
+				for (auto& instanceId : typeMatches)
+				{
+					if (matchesName(instanceId))
+						output.push_back(instanceId);
+				}
+			}
+			else
+			{
+				for (auto& entry : mEntries)
+				{
+					if (matchesName(entry.first))
+						output.push_back(entry.first);
+				}
+			}
+
+			return output;
+		}
+
+		// Only objects that contain every trigram of the pattern can match, so checking the objects containing the
+		// rarest trigram is enough
+		const UnorderedSet<UINT64>* candidates = nullptr;
+		for (UINT32 i = 0; i + 3 <= (UINT32)namePattern.size(); i++)
+		{
+			auto iterFind = mTrigrams.find(getTrigram(namePattern, i));
+			if (iterFind == mTrigrams.end())
+				return output;
+
+			if (candidates == nullptr || iterFind->second.size() < candidates->size())
+				candidates = &iterFind->second;
+		}
+
+		if (filterByType && typeMatches.size() < candidates->size())
+			candidates = &typeMatches;
+
+		for (auto& instanceId : *candidates)
+		{
+			if (filterByType && typeMatches.find(instanceId) == typeMatches.end())
+				continue;
+
+			if (matchesName(instanceId))
+				output.push_back(instanceId);
+		}
+
+		return output;
+	}
+
+	void SceneSearchIndex::indexName(UINT64 instanceId, const String& name, bool add)
+	{
+		for (UINT32 i = 0; i + 3 <= (UINT32)name.size(); i++)
+		{
+			const UINT32 trigram = getTrigram(name, i);
+			if (add)
+				mTrigrams[trigram].insert(instanceId);
+			else
+			{
+				auto iterFind = mTrigrams.find(trigram);
+				if (iterFind == mTrigrams.end())
+					continue;
+
+				iterFind->second.erase(instanceId);
+				if (iterFind->second.empty())
+					mTrigrams.erase(iterFind);
+			}
+		}
+	}
+
+	void SceneSearchIndex::indexTypes(UINT64 instanceId, const Vector<String>& types, bool add)
+	{
+		for (auto& type : types)
+		{
+			if (add)
+				mTypes[type].insert(instanceId);
+			else
+			{
+				auto iterFind = mTypes.find(type);
+				if (iterFind == mTypes.end())
+					continue;
+
+				iterFind->second.erase(instanceId);
+				if (iterFind->second.empty())
+					mTypes.erase(iterFind);
+			}
+		}
+	}
+
+	UINT32 SceneSearchIndex::getTrigram(const String& str, UINT32 idx)
+	{
+		return ((UINT32)(UINT8)str[idx] << 16) | ((UINT32)(UINT8)str[idx + 1] << 8) | (UINT32)(UINT8)str[idx + 2];
+	}
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup Scene-Editor
+	 *  @{
+	 */
+
+	/**
+	 * Index of scene objects by name and by the types of their components, allowing scene objects to be searched for
+	 * without walking the scene hierarchy.
+	 *
+	 * Names are indexed by their trigrams (every three consecutive characters), so a name substring query only needs to
+	 * check the objects that contain the rarest trigram of the query. Component types are indexed by name. All matching
+	 * is case insensitive. The index is not kept in sync automatically, the owner is expected to add, update and remove
+	 * objects as they change.
+	 */
+	class BS_ED_EXPORT SceneSearchIndex
+	{
+		/** Indexed information about a single scene object. */
+		struct Entry
+		{
+			String name;
+			Vector<String> types;
+		};
+
+	public:
+		/**
+		 * Adds a scene object to the index, or updates its entry if it is already indexed. Only the object itself is
+		 * indexed, not its children.
+		 */
+		void addObject(const HSceneObject& sceneObject);
+
+		/** Removes the scene object with the specified instance ID from the index. Does nothing if it isn't indexed. */
+		void removeObject(UINT64 instanceId);
+
+		/** Removes all entries from the index. */
+		void clear();
+
+		/**
+		 * Finds all scene objects matching the provided query. The query consists of an optional name substring, along
+		 * with any number of "t:Type" tokens. An object matches if its name contains the name substring, and it has a
+		 * component whose type name contains each of the provided type tokens.
+		 *
+		 * @param[in]	query	Query to match against.
+		 * @return				Instance IDs of all matching scene objects, in no particular order. Empty if the query is
+		 *						empty.
+		 */
+		Vector<UINT64> find(const String& query) const;
+
+		/** Returns the number of scene objects in the index. */
+		UINT32 getNumObjects() const { return (UINT32)mEntries.size(); }
+
+	private:
+		/** Adds or removes the trigrams of the provided lowercase name for the specified object. */
+		void indexName(UINT64 instanceId, const String& name, bool add);
+
+		/** Adds or removes the provided lowercase component type names for the specified object. */
+		void indexTypes(UINT64 instanceId, const Vector<String>& types, bool add);
+
+		/** Returns the trigram starting at the specified character of the provided string, packed into an integer. */
+		static UINT32 getTrigram(const String& str, UINT32 idx);
+
+		UnorderedMap<UINT64, Entry> mEntries;
+		UnorderedMap<UINT32, UnorderedSet<UINT64>> mTrigrams;
+		UnorderedMap<String, UnorderedSet<UINT64>> mTypes;
+	};
+
+	/** @} */
+}
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "RenderAPI/BsVertexDataDesc.h"
 #include "Components/BsCCamera.h"
 #include "CoreThread/BsCoreThread.h"
+#include "Utility/BsEditorRenderPacket.h"
 #include "Utility/BsBuiltinEditorResources.h"
 #include "Material/BsMaterial.h"
 #include "RenderAPI/BsGpuParams.h"
@@ -24,20 +25,26 @@ using namespace std::placeholders;
 namespace bs
 {
 	SelectionRenderer::SelectionRenderer()
-	{
-		HMaterial selectionMat = BuiltinEditorResources::instance().createSelectionMat();
-			
-		mRenderer = RendererExtension::create<ct::SelectionRendererCore>(selectionMat->getCore());
-	}
+	{ }
 
 	SelectionRenderer::~SelectionRenderer()
 	{ }
 
 	void SelectionRenderer::update(const SPtr<Camera>& camera)
 	{
-		Vector<SPtr<ct::Renderable>> objects;
-
 		const Vector<HSceneObject>& sceneObjects = Selection::instance().getSceneObjects();
+
+		// The renderer (and its material) is only created once there is something to render
+		if (mRenderer == nullptr)
+		{
+			if (sceneObjects.empty())
+				return;
+
+			HMaterial selectionMat = BuiltinEditorResources::instance().createSelectionMat();
+			mRenderer = RendererExtension::create<ct::SelectionRendererCore>(selectionMat->getCore());
+		}
+
+		Vector<SPtr<ct::Renderable>> objects;
 		Vector<HRenderable> renderables = gSceneManager().findComponents<CRenderable>(true);
 
 		for (auto& renderable : renderables)
@@ -53,8 +60,11 @@ namespace bs
 			}
 		}
 
-		ct::SelectionRendererCore* renderer = mRenderer.get();
-		gCoreThread().queueCommand(std::bind(&ct::SelectionRendererCore::updateData, renderer, camera->getCore(), objects));
+		EditorRenderPacket::instance().queue(
+			[renderer = mRenderer, coreCamera = camera->getCore(), objects = std::move(objects)]()
+		{
+			renderer->updateData(coreCamera, objects);
+		});
 	}
 
 	namespace ct
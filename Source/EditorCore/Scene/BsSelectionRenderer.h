@@ -23,7 +23,10 @@ namespace bs
 		SelectionRenderer();
 		~SelectionRenderer();
 
-		/** Called once per frame. Updates the overlay depending on current selection. */
+		/**
+		 * Called once per frame. Updates the overlay depending on current selection. Core thread resources needed for
+		 * rendering the overlay are created on the first call with a non-empty selection.
+		 */
 		void update(const SPtr<Camera>& camera);
 
 	private:
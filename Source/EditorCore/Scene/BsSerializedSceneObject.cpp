@@ -5,6 +5,7 @@
 #include "Utility/BsUtility.h"
 #include "Serialization/BsBinarySerializer.h"
 #include "FileSystem/BsDataStream.h"
+#include "Scene/BsPrefabInstanceIndex.h"
 
 namespace bs
 {
@@ -102,5 +103,8 @@ namespace bs
 		}
 
 		restored->_instantiate();
+
+		if (PrefabInstanceIndex::isStarted())
+			PrefabInstanceIndex::instance().registerInstance(restored->getHandle());
 	}
 }
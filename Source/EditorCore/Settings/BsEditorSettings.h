@@ -62,6 +62,19 @@ namespace bs
 		/** Retrieves the maximum number of frames per second the editor is allowed to execute. Zero means infinite. */
 		UINT32 getFPSLimit() const { return mFPSLimit; }
 
+		/**
+		 * Retrieves the maximum number of frames per second the editor is allowed to execute while idle (no user input,
+		 * log output, imports or continuous redraw requests) or while none of its windows have focus. Zero disables
+		 * idle throttling, in which case the editor always runs at the regular FPS limit.
+		 */
+		UINT32 getIdleFPSLimit() const { return mIdleFPSLimit; }
+
+		/**
+		 * Retrieves the maximum number of worker processes used for importing resources. Zero means resources are
+		 * imported in the editor process. See ImportWorkerPool.
+		 */
+		UINT32 getImportWorkerCount() const { return mImportWorkerCount; }
+
 		/** 
 		 * Retrieves a value that controls sensitivity of mouse movements. This doesn't apply to mouse cursor. 
 		 * Default value is 1.0f.
@@ -110,6 +123,18 @@ namespace bs
 		/** Sets the maximum number of frames per second the editor is allowed to execute. Zero means infinite. */
 		void setFPSLimit(UINT32 limit) { mFPSLimit = limit; markAsDirty(); }
 
+		/** 
+		 * Sets the maximum number of frames per second the editor is allowed to execute while idle or unfocused. Zero 
+		 * disables idle throttling.
+		 */
+		void setIdleFPSLimit(UINT32 limit) { mIdleFPSLimit = limit; markAsDirty(); }
+
+		/** 
+		 * Sets the maximum number of worker processes used for importing resources. Zero means resources are imported 
+		 * in the editor process.
+		 */
+		void setImportWorkerCount(UINT32 count) { mImportWorkerCount = count; markAsDirty(); }
+
 		/** 
 		 * Sets a value that controls sensitivity of mouse movements. This doesn't apply to mouse cursor. 
 		 * Default value is 1.0f.
@@ -132,6 +157,8 @@ namespace bs
 
 		float mHandleSize = 0.10f;
 		UINT32 mFPSLimit = 60;
+		UINT32 mIdleFPSLimit = 10;
+		UINT32 mImportWorkerCount = 0;
 		float mMouseSensitivity = 1.0f;
 
 		Path mLastOpenProject;
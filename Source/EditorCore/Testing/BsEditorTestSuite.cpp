@@ -3,7 +3,9 @@
 #include "Testing/BsEditorTestSuite.h"
 #include "Scene/BsSceneObject.h"
 #include "UndoRedo/BsCmdDeleteSO.h"
+#include "UndoRedo/BsCmdReparentSO.h"
 #include "UndoRedo/BsUndoRedo.h"
+#include "UndoRedo/BsEditorCommand.h"
 #include "Reflection/BsRTTIType.h"
 #include "Private/RTTI/BsGameObjectRTTI.h"
 #include "Serialization/BsBinarySerializer.h"
@@ -14,6 +16,7 @@
 #include "FileSystem/BsFileSystem.h"
 #include "Scene/BsSceneManager.h"
 #include "Scene/BsSerializedSceneObject.h"
+#include "Scene/BsSceneSearchIndex.h"
 
 namespace bs
 {
@@ -404,10 +407,42 @@ namespace bs
 		return TestComponentD::getRTTIStatic();
 	}
 
+	/** Command that changes an integer value, used for testing undo/redo merge groups. */
+	class TestValueCommand : public EditorCommand
+	{
+	public:
+		TestValueCommand(int* target, int oldValue, int newValue)
+			:EditorCommand("TestValue"), mTarget(target), mOldValue(oldValue), mNewValue(newValue)
+		{ }
+
+		void commit() override { *mTarget = mNewValue; }
+		void revert() override { *mTarget = mOldValue; }
+
+		bool merge(const SPtr<EditorCommand>& next) override
+		{
+			SPtr<TestValueCommand> nextCommand = std::static_pointer_cast<TestValueCommand>(next);
+			if (nextCommand->mTarget != mTarget)
+				return false;
+
+			mNewValue = nextCommand->mNewValue;
+			return true;
+		}
+
+	private:
+		int* mTarget;
+		int mOldValue;
+		int mNewValue;
+	};
+
 	EditorTestSuite::EditorTestSuite()
 	{
 		BS_ADD_TEST(EditorTestSuite::SceneObjectRecord_UndoRedo);
 		BS_ADD_TEST(EditorTestSuite::SceneObjectDelete_UndoRedo);
+		BS_ADD_TEST(EditorTestSuite::SceneObjectDelete_SerializedUndo);
+		BS_ADD_TEST(EditorTestSuite::SceneObjectDelete_LocalTransform);
+		BS_ADD_TEST(EditorTestSuite::SceneObjectReparent_UndoRedo);
+		BS_ADD_TEST(EditorTestSuite::UndoRedo_MergeGroups);
+		BS_ADD_TEST(EditorTestSuite::SceneSearchIndex_Find);
 		BS_ADD_TEST(EditorTestSuite::BinaryDiff);
 		BS_ADD_TEST(EditorTestSuite::TestPrefabComplex);
 		BS_ADD_TEST(EditorTestSuite::TestPrefabDiff);
@@ -505,6 +540,253 @@ namespace bs
 		soExternal->destroy();
 	}
 
+	void EditorTestSuite::SceneObjectDelete_SerializedUndo()
+	{
+		HSceneObject parent = SceneObject::create("parent");
+		HSceneObject child0 = SceneObject::create("child0");
+		HSceneObject child1 = SceneObject::create("child1");
+		HSceneObject child2 = SceneObject::create("child2");
+
+		child0->setParent(parent);
+		child1->setParent(parent);
+		child2->setParent(parent);
+
+		CmdDeleteSO::execute(child1);
+		UndoRedo::instance().serializeDeletedObjects();
+		UndoRedo::instance().undo();
+
+		BS_TEST_ASSERT(!child1.isDestroyed());
+		BS_TEST_ASSERT(!child1->hasFlag(SOF_Internal));
+		BS_TEST_ASSERT(!child1->hasFlag(SOF_DontSave));
+		BS_TEST_ASSERT(parent->getNumChildren() == 3);
+		BS_TEST_ASSERT(parent->getChild(0) == child0);
+		BS_TEST_ASSERT(parent->getChild(1) == child1);
+		BS_TEST_ASSERT(parent->getChild(2) == child2);
+
+		parent->destroy();
+	}
+
+	void EditorTestSuite::SceneObjectDelete_LocalTransform()
+	{
+		HSceneObject parent = SceneObject::create("parent");
+		parent->setRotation(Quaternion(Degree(30.0f), Degree(45.0f), Degree(10.0f)));
+		parent->setScale(Vector3(1.0f, 3.0f, 0.5f));
+
+		Vector<HSceneObject> children;
+		for (UINT32 i = 0; i < 3; i++)
+		{
+			HSceneObject child = SceneObject::create("child" + toString(i));
+			child->setParent(parent, false);
+			child->setPosition(Vector3(1.5f * i, -2.0f, 0.3f));
+			child->setRotation(Quaternion(Degree(10.0f * i), Degree(70.0f), Degree(-25.0f)));
+			child->setScale(Vector3(0.7f, 1.0f + i, 2.0f));
+
+			children.push_back(child);
+		}
+
+		Vector<Transform> localTransforms;
+		for (auto& child : children)
+			localTransforms.push_back(child->getLocalTransform());
+
+		auto checkUnchanged = [&children, &localTransforms]()
+		{
+			for (UINT32 i = 0; i < (UINT32)children.size(); i++)
+			{
+				const Transform& transform = children[i]->getLocalTransform();
+				if (transform.getPosition() != localTransforms[i].getPosition() ||
+					transform.getRotation() != localTransforms[i].getRotation() ||
+					transform.getScale() != localTransforms[i].getScale())
+					return false;
+			}
+
+			return true;
+		};
+
+		// Object held by the command
+		CmdDeleteSO::execute(children[0]);
+		UndoRedo::instance().undo();
+
+		BS_TEST_ASSERT(parent->getChild(0) == children[0]);
+		BS_TEST_ASSERT(checkUnchanged());
+
+		// Object serialized by the command
+		CmdDeleteSO::execute(children[0]);
+		UndoRedo::instance().serializeDeletedObjects();
+		UndoRedo::instance().undo();
+
+		BS_TEST_ASSERT(parent->getChild(0) == children[0]);
+		BS_TEST_ASSERT(checkUnchanged());
+
+		parent->destroy();
+	}
+
+	void EditorTestSuite::SceneObjectReparent_UndoRedo()
+	{
+		HSceneObject oldParent = SceneObject::create("oldParent");
+		oldParent->setRotation(Quaternion(Degree(15.0f), Degree(-40.0f), Degree(5.0f)));
+		oldParent->setScale(Vector3(2.0f, 0.5f, 1.0f));
+
+		HSceneObject newParent = SceneObject::create("newParent");
+		newParent->setPosition(Vector3(3.0f, 0.0f, -1.0f));
+
+		Vector<HSceneObject> children;
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			HSceneObject child = SceneObject::create("child" + toString(i));
+			child->setParent(oldParent, false);
+			child->setPosition(Vector3(1.0f, 0.5f * i, -2.0f));
+			child->setRotation(Quaternion(Degree(20.0f), Degree(5.0f * i), Degree(60.0f)));
+
+			children.push_back(child);
+		}
+
+		Vector<Transform> localTransforms;
+		for (auto& child : children)
+			localTransforms.push_back(child->getLocalTransform());
+
+		Vector<HSceneObject> moved = { children[1], children[2] };
+		CmdReparentSO::execute(moved, newParent);
+		BS_TEST_ASSERT(oldParent->getNumChildren() == 2);
+		BS_TEST_ASSERT(newParent->getNumChildren() == 2);
+
+		UndoRedo::instance().undo();
+
+		BS_TEST_ASSERT(newParent->getNumChildren() == 0);
+		BS_TEST_ASSERT(oldParent->getNumChildren() == 4);
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			BS_TEST_ASSERT(oldParent->getChild(i) == children[i]);
+
+			const Transform& transform = children[i]->getLocalTransform();
+			BS_TEST_ASSERT(transform.getPosition() == localTransforms[i].getPosition());
+			BS_TEST_ASSERT(transform.getRotation() == localTransforms[i].getRotation());
+			BS_TEST_ASSERT(transform.getScale() == localTransforms[i].getScale());
+		}
+
+		oldParent->destroy();
+		newParent->destroy();
+	}
+
+	void EditorTestSuite::UndoRedo_MergeGroups()
+	{
+		UndoRedo undoRedo;
+		int value = 0;
+
+		auto setValue = [&undoRedo, &value](int newValue)
+		{
+			SPtr<TestValueCommand> command = bs_shared_ptr_new<TestValueCommand>(&value, value, newValue);
+			command->commit();
+
+			undoRedo.registerCommand(command);
+		};
+
+		// Commands registered within a group are merged into a single entry
+		UINT32 group = undoRedo.beginMergeGroup();
+		setValue(1);
+		setValue(2);
+		setValue(3);
+		undoRedo.endMergeGroup(group);
+
+		undoRedo.undo();
+		BS_TEST_ASSERT(value == 0);
+
+		undoRedo.redo();
+		BS_TEST_ASSERT(value == 3);
+
+		// Outside of a group every command is a separate entry
+		setValue(4);
+		setValue(5);
+
+		undoRedo.undo();
+		BS_TEST_ASSERT(value == 4);
+
+		undoRedo.redo();
+		BS_TEST_ASSERT(value == 5);
+
+		// Ending a group that was already replaced by a newer one leaves the newer group active
+		UINT32 oldGroup = undoRedo.beginMergeGroup();
+		UINT32 newGroup = undoRedo.beginMergeGroup();
+		undoRedo.endMergeGroup(oldGroup);
+		BS_TEST_ASSERT(undoRedo.isMergeGroupActive());
+
+		setValue(6);
+		setValue(7);
+		undoRedo.endMergeGroup(newGroup);
+		BS_TEST_ASSERT(!undoRedo.isMergeGroupActive());
+
+		undoRedo.undo();
+		BS_TEST_ASSERT(value == 5);
+	}
+
+	void EditorTestSuite::SceneSearchIndex_Find()
+	{
+		HSceneObject playerCamera = SceneObject::create("PlayerCamera");
+		HSceneObject enemyCamera = SceneObject::create("EnemyCamera");
+		HSceneObject light = SceneObject::create("Light");
+		HSceneObject cam = SceneObject::create("Cam");
+
+		playerCamera->addComponent<TestComponentA>();
+		enemyCamera->addComponent<TestComponentA>();
+		enemyCamera->addComponent<TestComponentB>();
+		light->addComponent<TestComponentB>();
+
+		SceneSearchIndex index;
+		index.addObject(playerCamera);
+		index.addObject(enemyCamera);
+		index.addObject(light);
+		index.addObject(cam);
+
+		BS_TEST_ASSERT(index.getNumObjects() == 4);
+
+		auto matches = [&index](const String& query, const Vector<HSceneObject>& expected)
+		{
+			Vector<UINT64> found = index.find(query);
+			if (found.size() != expected.size())
+				return false;
+
+			for (auto& entry : expected)
+			{
+				if (std::find(found.begin(), found.end(), entry->getInstanceId()) == found.end())
+					return false;
+			}
+
+			return true;
+		};
+
+		// Name patterns long enough to use trigram candidates, matched case insensitively
+		BS_TEST_ASSERT(matches("camera", { playerCamera, enemyCamera }));
+		BS_TEST_ASSERT(matches("CAMERA", { playerCamera, enemyCamera }));
+		BS_TEST_ASSERT(matches("yercam", { playerCamera }));
+		BS_TEST_ASSERT(matches("camerax", {}));
+
+		// Name patterns shorter than a trigram
+		BS_TEST_ASSERT(matches("ca", { playerCamera, enemyCamera, cam }));
+		BS_TEST_ASSERT(matches("ca t:testcomponenta", { playerCamera, enemyCamera }));
+
+		// Multiple type tokens must all be matched by the same object
+		BS_TEST_ASSERT(matches("t:componentb", { enemyCamera, light }));
+		BS_TEST_ASSERT(matches("t:testcomponenta t:testcomponentb", { enemyCamera }));
+		BS_TEST_ASSERT(matches("camera t:componentb", { enemyCamera }));
+		BS_TEST_ASSERT(matches("light t:testcomponenta", {}));
+
+		BS_TEST_ASSERT(matches("", {}));
+
+		// Updated and removed objects
+		light->setName("CameraLight");
+		index.addObject(light);
+		BS_TEST_ASSERT(matches("camera", { playerCamera, enemyCamera, light }));
+
+		index.removeObject(enemyCamera->getInstanceId());
+		BS_TEST_ASSERT(index.getNumObjects() == 3);
+		BS_TEST_ASSERT(matches("camera", { playerCamera, light }));
+		BS_TEST_ASSERT(matches("t:testcomponenta t:testcomponentb", {}));
+
+		playerCamera->destroy();
+		enemyCamera->destroy();
+		light->destroy();
+		cam->destroy();
+	}
+
 	void EditorTestSuite::BinaryDiff()
 	{
 		SPtr<TestObjectA> orgObj = bs_shared_ptr_new<TestObjectA>();
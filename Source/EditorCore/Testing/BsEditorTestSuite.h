@@ -82,6 +82,21 @@ namespace bs
 		/**	Tests SceneObject delete undo/redo operation. */
 		void SceneObjectDelete_UndoRedo();
 
+		/** Tests that a deleted SceneObject serialized before a scene change is restored with its flags and sibling order. */
+		void SceneObjectDelete_SerializedUndo();
+
+		/** Tests that undoing a SceneObject delete leaves the local transforms of the object and its siblings unchanged. */
+		void SceneObjectDelete_LocalTransform();
+
+		/** Tests that undoing a SceneObject reparent restores the original parent, sibling order and local transforms. */
+		void SceneObjectReparent_UndoRedo();
+
+		/** Tests merging of commands registered within undo/redo merge groups. */
+		void UndoRedo_MergeGroups();
+
+		/** Tests name and component type queries against the scene search index. */
+		void SceneSearchIndex_Find();
+
 		/** Tests native diff by modifiying an object, generating a diff and re-applying the modifications. */
 		void BinaryDiff();
 
@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "UndoRedo/BsCmdBreakPrefab.h"
 #include "Scene/BsSceneObject.h"
+#include "Scene/BsPrefabInstanceIndex.h"
 
 namespace bs
 {
@@ -84,6 +85,7 @@ namespace bs
 			}
 		}
 
+		// Note: No need to unregister from the instance index, it prunes instances with broken links on its own
 		mSceneObject->breakPrefabLink();
 	}
 
@@ -124,6 +126,8 @@ namespace bs
 					todo.push(child);
 			}
 		}
+
+		PrefabInstanceIndex::instance().registerInstance(mPrefabRoot);
 	}
 
 	void CmdBreakPrefab::clear()
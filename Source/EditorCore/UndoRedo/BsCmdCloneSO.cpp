@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "UndoRedo/BsCmdCloneSO.h"
 #include "Scene/BsSceneObject.h"
+#include "Scene/BsPrefabInstanceIndex.h"
 
 namespace bs
 {
@@ -43,7 +44,12 @@ namespace bs
 		for (auto& original : mOriginals)
 		{
 			if (!original.isDestroyed())
-				mClones.push_back(original->clone());
+			{
+				HSceneObject clone = original->clone();
+				PrefabInstanceIndex::instance().registerInstance(clone);
+
+				mClones.push_back(clone);
+			}
 		}
 	}
 
@@ -52,7 +58,10 @@ namespace bs
 		for (auto& clone : mClones)
 		{
 			if (!clone.isDestroyed())
+			{
+				PrefabInstanceIndex::instance().unregisterInstance(clone);
 				clone->destroy(true);
+			}
 		}
 
 		mClones.clear();
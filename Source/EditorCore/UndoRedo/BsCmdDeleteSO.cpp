@@ -5,18 +5,28 @@
 #include "Scene/BsSceneObject.h"
 #include "Scene/BsSerializedSceneObject.h"
 #include "Scene/BsSelection.h"
+#include "Scene/BsPrefabInstanceIndex.h"
+#include "Scene/BsSceneManager.h"
 
 namespace bs
 {
+	const UINT32 CmdDeleteSO::MAX_DETACHED_COMMANDS = 16;
+
 	CmdDeleteSO::CmdDeleteSO(const String& description, const HSceneObject& sceneObject)
 		: EditorCommand(description), mSceneObject(sceneObject)
 	{ }
 
+	CmdDeleteSO::~CmdDeleteSO()
+	{
+		unregisterDetached();
+	}
+
 	void CmdDeleteSO::execute(const HSceneObject& sceneObject, const String& description)
 	{
 		// Register command and commit it
 		CmdDeleteSO* command = new (bs_alloc<CmdDeleteSO>()) CmdDeleteSO(description, sceneObject);
 		SPtr<CmdDeleteSO> commandPtr = bs_shared_ptr(command);
+		command->mUndoRedo = UndoRedo::instancePtr();
 
 		UndoRedo::instance().registerCommand(commandPtr);
 		commandPtr->commit();
@@ -27,15 +37,167 @@ namespace bs
 		if (mSceneObject == nullptr || mSceneObject.isDestroyed())
 			return;
 
-		mSerialized = bs_shared_ptr_new<SerializedSceneObject>(mSceneObject, true);
-		mSceneObject->destroy();
+		mOldParent = mSceneObject->getParent();
+		if (mOldParent != nullptr)
+		{
+			UINT32 numSiblings = mOldParent->getNumChildren();
+			for (UINT32 i = 0; i < numSiblings; i++)
+			{
+				if (mOldParent->getChild(i) == mSceneObject)
+				{
+					mOldIndex = i;
+					break;
+				}
+			}
+		}
+
+		mHadInternalFlag = mSceneObject->hasFlag(SOF_Internal);
+		mHadDontSaveFlag = mSceneObject->hasFlag(SOF_DontSave);
+
+		PrefabInstanceIndex::instance().unregisterInstance(mSceneObject);
+
+		// Held objects aren't destroyed, so they need to be explicitly removed from the selection
+		Vector<HSceneObject> selection = Selection::instance().getSceneObjects();
+		auto iterRemove = std::remove_if(selection.begin(), selection.end(), [this](const HSceneObject& selected)
+		{
+			for (HSceneObject current = selected; current != nullptr; current = current->getParent())
+			{
+				if (current == mSceneObject)
+					return true;
+			}
+
+			return false;
+		});
+
+		if (iterRemove != selection.end())
+		{
+			selection.erase(iterRemove, selection.end());
+			Selection::instance().setSceneObjects(selection);
+		}
+
+		mHoldingRoot = SceneObject::create("DeletedSceneObject", SOF_Internal | SOF_DontSave);
+		mHoldingRoot->setActive(false);
+		mSceneObject->setParent(mHoldingRoot, false);
+
+		Vector<CmdDeleteSO*>& detachedDeletes = mUndoRedo->mDetachedDeletes;
+		detachedDeletes.push_back(this);
+		mIsDetached = true;
+
+		if (detachedDeletes.size() > MAX_DETACHED_COMMANDS)
+			detachedDeletes.front()->serializeHeld();
 	}
 
 	void CmdDeleteSO::revert()
 	{
-		mSerialized->restore();
+		if (mSerialized != nullptr)
+		{
+			mSerialized->restore();
+			mSerialized = nullptr;
+		}
+
+		if (!mSceneObject.isDestroyed(true))
+		{
+			if (!mOldParent.isDestroyed())
+			{
+				mSceneObject->setParent(mOldParent, false);
+				restoreIndexInParent(mOldParent);
+			}
+			else
+				mSceneObject->setParent(gSceneManager().getMainScene()->getRoot(), false);
 
-		if(!mSceneObject.isDestroyed(true))
+			removeInheritedFlags();
+
+			PrefabInstanceIndex::instance().registerInstance(mSceneObject);
 			Selection::instance().setSceneObjects({ mSceneObject });
+		}
+
+		destroyHoldingRoot();
+		unregisterDetached();
+	}
+
+	void CmdDeleteSO::onCommandRemoved()
+	{
+		// If the command is still committed the held objects are no longer reachable, otherwise they're back in the scene
+		// and the holding root is already gone
+		destroyHoldingRoot();
+		unregisterDetached();
+
+		mSerialized = nullptr;
+	}
+
+	void CmdDeleteSO::serializeHeld()
+	{
+		unregisterDetached();
+
+		if (mHoldingRoot.isDestroyed())
+			return;
+
+		if (!mSceneObject.isDestroyed())
+		{
+			// Serialize the object as it was before deletion, rather than as a child of the holding root
+			removeInheritedFlags();
+			mSceneObject->setParent(HSceneObject(), false);
+
+			mSerialized = bs_shared_ptr_new<SerializedSceneObject>(mSceneObject, true);
+			mSceneObject->destroy(true);
+		}
+
+		destroyHoldingRoot();
+	}
+
+	void CmdDeleteSO::destroyHoldingRoot()
+	{
+		if (!mHoldingRoot.isDestroyed())
+			mHoldingRoot->destroy();
+
+		mHoldingRoot = HSceneObject();
+	}
+
+	void CmdDeleteSO::unregisterDetached()
+	{
+		if (!mIsDetached)
+			return;
+
+		Vector<CmdDeleteSO*>& detachedDeletes = mUndoRedo->mDetachedDeletes;
+		auto iterFind = std::find(detachedDeletes.begin(), detachedDeletes.end(), this);
+		if (iterFind != detachedDeletes.end())
+			detachedDeletes.erase(iterFind);
+
+		mIsDetached = false;
+	}
+
+	void CmdDeleteSO::removeInheritedFlags()
+	{
+		UINT32 flagsToRemove = 0;
+		if (!mHadInternalFlag)
+			flagsToRemove |= SOF_Internal;
+
+		if (!mHadDontSaveFlag)
+			flagsToRemove |= SOF_DontSave;
+
+		if (flagsToRemove != 0)
+			mSceneObject->_unsetFlags(flagsToRemove);
+	}
+
+	void CmdDeleteSO::restoreIndexInParent(const HSceneObject& parent)
+	{
+		UINT32 numChildren = parent->getNumChildren();
+		if (mOldIndex + 1 >= numChildren)
+			return;
+
+		Vector<HSceneObject> following;
+		for (UINT32 i = mOldIndex; i < numChildren - 1; i++)
+			following.push_back(parent->getChild(i));
+
+		// Attaching always appends to the end of the child list, so the siblings that originally followed the object
+		// are cycled through a temporary parent to move them behind it again
+		HSceneObject tempParent = SceneObject::create("ReorderSceneObject");
+		for (auto& sibling : following)
+		{
+			sibling->setParent(tempParent, false);
+			sibling->setParent(parent, false);
+		}
+
+		tempParent->destroy(true);
 	}
 }
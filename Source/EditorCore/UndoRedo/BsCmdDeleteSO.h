@@ -14,10 +14,21 @@ namespace bs
 	 *  @{
 	 */
 
-	/** A command used for undo/redo purposes. Deletes a scene object and restores it as an undo operation. */
+	/**
+	 * A command used for undo/redo purposes. Deletes a scene object and restores it as an undo operation.
+	 *
+	 * Instead of being destroyed the deleted object is moved under an inactive, hidden holding root owned by the
+	 * command, so undo only needs to re-attach it to its original parent. The held objects are destroyed once the command
+	 * leaves the undo/redo stack. To limit the amount of memory held by deleted objects, only the most recent
+	 * MAX_DETACHED_COMMANDS commands on an undo/redo stack keep their objects alive, and older commands serialize their
+	 * objects and destroy them instead. Held objects live in the main scene, so they also get serialized before the scene
+	 * is unloaded (see UndoRedo::serializeDeletedObjects()).
+	 */
 	class BS_ED_EXPORT CmdDeleteSO final : public EditorCommand
 	{
 	public:
+		~CmdDeleteSO();
+
 		/**
 		 * Creates and executes the command on the provided scene object. Automatically registers the command with 
 		 * undo/redo system.
@@ -33,13 +44,44 @@ namespace bs
 		/** @copydoc EditorCommand::revert */
 		void revert() override;
 
+		/** Maximum number of commands that keep their deleted objects alive, rather than serialized. */
+		static const UINT32 MAX_DETACHED_COMMANDS;
+
 	private:
 		friend class UndoRedo;
 
 		CmdDeleteSO(const String& description, const HSceneObject& sceneObject);
 
+		/** @copydoc EditorCommand::onCommandRemoved */
+		void onCommandRemoved() override;
+
+		/** Serializes the held scene object and destroys the holding root. */
+		void serializeHeld();
+
+		/** Destroys the holding root, along with any objects held by it. */
+		void destroyHoldingRoot();
+
+		/** Removes the command from the list of commands holding detached objects. */
+		void unregisterDetached();
+
+		/** Removes the flags the object inherited from the holding root, keeping the ones it had before deletion. */
+		void removeInheritedFlags();
+
+		/**
+		 * Moves the object from the end of the provided parent's child list back to the position it had before deletion.
+		 */
+		void restoreIndexInParent(const HSceneObject& parent);
+
 		HSceneObject mSceneObject;
+		HSceneObject mOldParent;
+		HSceneObject mHoldingRoot;
 		SPtr<SerializedSceneObject> mSerialized;
+		UndoRedo* mUndoRedo = nullptr;
+
+		UINT32 mOldIndex = 0;
+		bool mHadInternalFlag = false;
+		bool mHadDontSaveFlag = false;
+		bool mIsDetached = false;
 	};
 
 	/** @} */
@@ -3,6 +3,7 @@
 #include "UndoRedo/BsCmdInstantiateSO.h"
 #include "Scene/BsSceneObject.h"
 #include "Scene/BsPrefab.h"
+#include "Scene/BsPrefabInstanceIndex.h"
 
 namespace bs
 {
@@ -25,12 +26,16 @@ namespace bs
 	void CmdInstantiateSO::commit()
 	{
 		mSceneObject = mPrefab->instantiate();
+		PrefabInstanceIndex::instance().registerInstance(mSceneObject);
 	}
 
 	void CmdInstantiateSO::revert()
 	{
 		if (!mSceneObject.isDestroyed())
+		{
+			PrefabInstanceIndex::instance().unregisterInstance(mSceneObject);
 			mSceneObject->destroy(true);
+		}
 
 		mSceneObject = nullptr;
 	}
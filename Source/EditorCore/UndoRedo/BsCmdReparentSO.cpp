@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "UndoRedo/BsCmdReparentSO.h"
 #include "Scene/BsSceneObject.h"
+#include "Utility/BsEditorProfiler.h"
 
 namespace bs
 {
@@ -10,7 +11,25 @@ namespace bs
 	{
 		for(auto& sceneObject : mSceneObjects)
 		{
-			mOldParents.push_back(sceneObject->getParent());
+			HSceneObject parent = sceneObject->getParent();
+
+			UINT32 index = 0;
+			if(parent != nullptr)
+			{
+				UINT32 numSiblings = parent->getNumChildren();
+				for(UINT32 i = 0; i < numSiblings; i++)
+				{
+					if(parent->getChild(i) == sceneObject)
+					{
+						index = i;
+						break;
+					}
+				}
+			}
+
+			mOldParents.push_back(parent);
+			mOldIndices.push_back(index);
+			mOldLocalTransforms.push_back(sceneObject->getLocalTransform());
 		}
 	}
 
@@ -40,25 +59,146 @@ namespace bs
 		if(mNewParent.isDestroyed())
 			return;
 
-		UINT32 cnt = 0;
-		for(auto& sceneObject : mSceneObjects)
+		BS_ED_PROFILE_SCOPE("CmdReparentSO::commit");
+
+		Vector<HSceneObject> newParents(mSceneObjects.size(), mNewParent);
+		reparent(mSceneObjects, newParents, true);
+	}
+
+	void CmdReparentSO::revert()
+	{
+		BS_ED_PROFILE_SCOPE("CmdReparentSO::revert");
+
+		// Restore the exact local transforms, rather than re-deriving them from world space
+		reparent(mSceneObjects, mOldParents, false);
+
+		for(UINT32 i = 0; i < (UINT32)mSceneObjects.size(); i++)
 		{
-			if(!sceneObject.isDestroyed())
-				sceneObject->setParent(mNewParent);
+			const HSceneObject& sceneObject = mSceneObjects[i];
+			if(sceneObject.isDestroyed() || sceneObject->getParent() != mOldParents[i])
+				continue;
 
-			cnt++;
+			const Transform& transform = mOldLocalTransforms[i];
+			sceneObject->setPosition(transform.getPosition());
+			sceneObject->setRotation(transform.getRotation());
+			sceneObject->setScale(transform.getScale());
 		}
+
+		restoreSiblingOrder();
 	}
 
-	void CmdReparentSO::revert()
+	void CmdReparentSO::restoreSiblingOrder()
 	{
-		UINT32 cnt = 0;
-		for(auto& sceneObject : mSceneObjects)
+		// Objects to restore, grouped by parent, along with their original index
+		UnorderedMap<SceneObject*, Vector<std::pair<UINT32, HSceneObject>>> movedPerParent;
+		for(UINT32 i = 0; i < (UINT32)mSceneObjects.size(); i++)
+		{
+			const HSceneObject& sceneObject = mSceneObjects[i];
+			const HSceneObject& parent = mOldParents[i];
+
+			if(sceneObject.isDestroyed() || parent.isDestroyed() || sceneObject->getParent() != parent)
+				continue;
+
+			movedPerParent[parent.get()].push_back(std::make_pair(mOldIndices[i], sceneObject));
+		}
+
+		HSceneObject tempParent;
+		for(auto& entry : movedPerParent)
+		{
+			HSceneObject parent = entry.first->getHandle();
+			Vector<std::pair<UINT32, HSceneObject>>& moved = entry.second;
+
+			std::sort(moved.begin(), moved.end(),
+				[](const std::pair<UINT32, HSceneObject>& a, const std::pair<UINT32, HSceneObject>& b)
+			{
+				return a.first < b.first;
+			});
+
+			// Children that weren't moved kept their relative order, so inserting the moved objects at their original
+			// indices, in increasing order, yields the original child list
+			UINT32 numChildren = parent->getNumChildren();
+			Vector<HSceneObject> order;
+			for(UINT32 i = 0; i < numChildren; i++)
+			{
+				HSceneObject child = parent->getChild(i);
+
+				auto iterFind = std::find_if(moved.begin(), moved.end(),
+					[&child](const std::pair<UINT32, HSceneObject>& x) { return x.second == child; });
+
+				if(iterFind == moved.end())
+					order.push_back(child);
+			}
+
+			for(auto& movedEntry : moved)
+			{
+				UINT32 index = std::min(movedEntry.first, (UINT32)order.size());
+				order.insert(order.begin() + index, movedEntry.second);
+			}
+
+			UINT32 firstDifferent = 0;
+			while(firstDifferent < numChildren && parent->getChild(firstDifferent) == order[firstDifferent])
+				firstDifferent++;
+
+			if(firstDifferent == numChildren)
+				continue;
+
+			// Attaching always appends to the end of the child list, so every child from the first misplaced one onward
+			// is cycled through a temporary parent, in the original order
+			if(tempParent == nullptr)
+				tempParent = SceneObject::create("ReorderSceneObject");
+
+			for(UINT32 i = firstDifferent; i < numChildren; i++)
+			{
+				order[i]->setParent(tempParent, false);
+				order[i]->setParent(parent, false);
+			}
+		}
+
+		if(tempParent != nullptr)
+			tempParent->destroy(true);
+	}
+
+	void CmdReparentSO::reparent(const Vector<HSceneObject>& sceneObjects, const Vector<HSceneObject>& parents,
+		bool keepWorldTransform)
+	{
+		// Ancestor chains are cached per parent, as usually all the objects share one (or a few) parents
+		UnorderedMap<SceneObject*, UnorderedSet<SceneObject*>> ancestorsPerParent;
+
+		for(UINT32 i = 0; i < (UINT32)sceneObjects.size(); i++)
 		{
-			if(!sceneObject.isDestroyed() && !mOldParents[cnt].isDestroyed())
-				sceneObject->setParent(mOldParents[cnt]);
+			const HSceneObject& sceneObject = sceneObjects[i];
+			const HSceneObject& parent = parents[i];
+
+			if(sceneObject.isDestroyed() || parent.isDestroyed())
+				continue;
+
+			if(sceneObject->getParent() == parent)
+				continue;
+
+			auto iterFind = ancestorsPerParent.find(parent.get());
+			if(iterFind == ancestorsPerParent.end())
+			{
+				UnorderedSet<SceneObject*> ancestors;
+				for(HSceneObject ancestor = parent; ancestor != nullptr; ancestor = ancestor->getParent())
+					ancestors.insert(ancestor.get());
+
+				iterFind = ancestorsPerParent.insert(std::make_pair(parent.get(), std::move(ancestors))).first;
+			}
+
+			// Moving the object under itself or its own descendant would detach the subtree from the scene
+			if(iterFind->second.find(sceneObject.get()) != iterFind->second.end())
+				continue;
+
+			sceneObject->setParent(parent, keepWorldTransform);
 
-			cnt++;
+			// Ancestor chains going through the moved object are no longer valid
+			for(auto iter = ancestorsPerParent.begin(); iter != ancestorsPerParent.end();)
+			{
+				if(iter->second.find(sceneObject.get()) != iter->second.end())
+					iter = ancestorsPerParent.erase(iter);
+				else
+					++iter;
+			}
 		}
 	}
 }
\ No newline at end of file
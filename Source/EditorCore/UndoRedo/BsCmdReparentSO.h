@@ -5,6 +5,7 @@
 #include "BsEditorPrerequisites.h"
 #include "UndoRedo/BsEditorCommand.h"
 #include "UndoRedo/BsUndoRedo.h"
+#include "Scene/BsTransform.h"
 
 namespace bs
 {
@@ -15,6 +16,10 @@ namespace bs
 	/**
 	 * A command used for undo/redo purposes. It records a scene object parent change operations. It allows you to apply
 	 * the parent change or revert the object to its original parent as needed.
+	 *
+	 * All objects provided to a single command are registered as a single undo/redo operation. Each object is still
+	 * attached through SceneObject::setParent(), which updates its transform individually. Reverting restores the
+	 * original parent, sibling position and local transform of every object.
 	 */
 	class BS_ED_EXPORT CmdReparentSO final : public EditorCommand
 	{
@@ -52,8 +57,30 @@ namespace bs
 
 		CmdReparentSO(const String& description, const Vector<HSceneObject>& sceneObjects, const HSceneObject& newParent);
 
+		/**
+		 * Moves each of the provided objects under the parent at the same index in @p parents. Objects are attached in the
+		 * order provided, so objects moved under the same parent keep their relative order. Destroyed objects or parents,
+		 * objects that are already parented to their target, and moves that would parent an object to itself or to one of
+		 * its descendants are skipped.
+		 *
+		 * @param[in]	sceneObjects		Objects to move.
+		 * @param[in]	parents				New parent for each of the objects.
+		 * @param[in]	keepWorldTransform	If true the world transform of the objects is preserved, otherwise their local
+		 *									transform is.
+		 */
+		static void reparent(const Vector<HSceneObject>& sceneObjects, const Vector<HSceneObject>& parents,
+			bool keepWorldTransform);
+
+		/**
+		 * Moves the objects that are back under their original parent from the end of the parent's child list to the
+		 * positions they had when the command was created.
+		 */
+		void restoreSiblingOrder();
+
 		Vector<HSceneObject> mSceneObjects;
 		Vector<HSceneObject> mOldParents;
+		Vector<UINT32> mOldIndices;
+		Vector<Transform> mOldLocalTransforms;
 		HSceneObject mNewParent;
 	};
 
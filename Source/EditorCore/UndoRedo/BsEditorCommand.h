@@ -26,6 +26,17 @@ namespace bs
 		/** Reverts the command, reverting the change previously done with commit(). */
 		virtual void revert() { }
 
+		/**
+		 * Attempts to merge a command that was registered right after this one into this command. Only called for
+		 * commands registered within the same merge group (see UndoRedo::beginMergeGroup()). Commands should only accept
+		 * the merge if @p next acts on the same target and the same property as this command. When merged this command
+		 * should keep its own original state, and take over the latest state from @p next.
+		 *
+		 * @param[in]	next	Command registered after this one. Already committed.
+		 * @return				True if the command was merged, in which case @p next will not be registered.
+		 */
+		virtual bool merge(const SPtr<EditorCommand>& next) { return false; }
+
 	private:
 		friend class UndoRedo;
 
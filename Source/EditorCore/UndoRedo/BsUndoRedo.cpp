@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "UndoRedo/BsUndoRedo.h"
 #include "UndoRedo/BsEditorCommand.h"
+#include "UndoRedo/BsCmdDeleteSO.h"
 
 namespace bs
 {
@@ -9,7 +10,8 @@ namespace bs
 
 	UndoRedo::UndoRedo()
 		: mUndoStack(nullptr), mRedoStack(nullptr), mUndoStackPtr(0), mUndoNumElements(0), mRedoStackPtr(0)
-		, mRedoNumElements(0), mNextCommandId(0)
+		, mRedoNumElements(0), mNextCommandId(0), mActiveMergeGroup(0), mNextMergeGroupId(1)
+		, mHasMergeTarget(false), mMergeTargetId(0)
 	{
 		mUndoStack = bs_newN<SPtr<EditorCommand>>(MAX_STACK_ELEMENTS);
 		mRedoStack = bs_newN<SPtr<EditorCommand>>(MAX_STACK_ELEMENTS);
@@ -31,6 +33,8 @@ namespace bs
 		SPtr<EditorCommand> command = removeLastFromUndoStack();
 		if(!command)
 			return;
+
+		mHasMergeTarget = false;
 		
 		mRedoStackPtr = (mRedoStackPtr + 1) % MAX_STACK_ELEMENTS;
 		mRedoStack[mRedoStackPtr] = command;
@@ -48,6 +52,7 @@ namespace bs
 		mRedoStack[mRedoStackPtr] = SPtr<EditorCommand>();
 		mRedoStackPtr = (mRedoStackPtr - 1) % MAX_STACK_ELEMENTS;
 		mRedoNumElements--;
+		mHasMergeTarget = false;
 
 		addToUndoStack(command);
 
@@ -85,11 +90,23 @@ namespace bs
 		}
 
 		mGroups.pop_back();
+		mHasMergeTarget = false;
+
 		clearRedoStack();
 	}
 
 	void UndoRedo::registerCommand(const SPtr<EditorCommand>& command)
 	{
+		if(isMergeGroupActive() && mHasMergeTarget && mUndoNumElements > 0)
+		{
+			const SPtr<EditorCommand>& topCommand = mUndoStack[mUndoStackPtr];
+			if(topCommand != nullptr && topCommand->mId == mMergeTargetId && topCommand->merge(command))
+			{
+				clearRedoStack();
+				return;
+			}
+		}
+
 		command->mId = mNextCommandId++;
 		command->onCommandAdded();
 
@@ -97,9 +114,34 @@ namespace bs
 		if (existingCommand != nullptr)
 			existingCommand->onCommandRemoved();
 
+		if(isMergeGroupActive())
+		{
+			mHasMergeTarget = true;
+			mMergeTargetId = command->mId;
+		}
+
 		clearRedoStack();
 	}
 
+	UINT32 UndoRedo::beginMergeGroup()
+	{
+		mActiveMergeGroup = mNextMergeGroupId++;
+		if (mNextMergeGroupId == 0)
+			mNextMergeGroupId = 1;
+
+		mHasMergeTarget = false;
+		return mActiveMergeGroup;
+	}
+
+	void UndoRedo::endMergeGroup(UINT32 id)
+	{
+		if (id == 0 || id != mActiveMergeGroup)
+			return;
+
+		mActiveMergeGroup = 0;
+		mHasMergeTarget = false;
+	}
+
 	UINT32 UndoRedo::getTopCommandId() const
 	{
 		if (mUndoNumElements > 0)
@@ -167,6 +209,16 @@ namespace bs
 	{
 		clearUndoStack();
 		clearRedoStack();
+
+		mHasMergeTarget = false;
+	}
+
+	void UndoRedo::serializeDeletedObjects()
+	{
+		// Copy, as serializing removes the command from the list
+		Vector<CmdDeleteSO*> commands = mDetachedDeletes;
+		for (auto& command : commands)
+			command->serializeHeld();
 	}
 
 	SPtr<EditorCommand> UndoRedo::removeLastFromUndoStack()
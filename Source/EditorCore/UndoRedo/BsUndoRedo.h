@@ -7,6 +7,8 @@
 
 namespace bs
 {
+	class CmdDeleteSO;
+
 	/** @addtogroup UndoRedo
 	 *  @{
 	 */
@@ -52,9 +54,35 @@ namespace bs
 		 */
 		void popGroup(const String& name);
 
-		/**	Registers a new undo command. */
+		/**
+		 * Registers a new undo command. If a merge group is active and the command can be merged with the command
+		 * previously registered in the same group (see EditorCommand::merge()), the two are merged into a single entry
+		 * instead.
+		 */
 		void registerCommand(const SPtr<EditorCommand>& command);
 
+		/**
+		 * Starts a new merge group. Consecutive commands registered while the group is active that act on the same target
+		 * and property get merged into a single undo/redo entry. Use this for continuous interactions (e.g. dragging a
+		 * field or a handle) that register a command for every change. Calling this while a group is already active
+		 * replaces the previous group.
+		 *
+		 * @return	Identifier of the new group, to be passed to endMergeGroup().
+		 */
+		UINT32 beginMergeGroup();
+
+		/**
+		 * Ends the merge group started with beginMergeGroup(). Commands registered after this will not be merged. Does
+		 * nothing if the group was already replaced by a newer one, so the owner of an older group (e.g. a field losing
+		 * input focus after another one gained it) can't end a group it didn't start.
+		 *
+		 * @param[in]	id	Identifier returned by beginMergeGroup().
+		 */
+		void endMergeGroup(UINT32 id);
+
+		/** Checks is a merge group currently active. */
+		bool isMergeGroupActive() const { return mActiveMergeGroup != 0; }
+
 		/**	Returns the unique identifier for the command on top of the undo stack. */
 		UINT32 getTopCommandId() const;
 
@@ -68,7 +96,16 @@ namespace bs
 		/**	Resets the undo/redo stacks. */
 		void clear();
 
+		/**
+		 * Serializes and destroys the scene objects kept alive by delete commands on the undo stack (see CmdDeleteSO), so
+		 * they can still be restored after the scene they are held in is unloaded. Must be called before the main scene
+		 * is cleared or replaced, including when entering or exiting play mode.
+		 */
+		void serializeDeletedObjects();
+
 	private:
+		friend class CmdDeleteSO;
+
 		/**	Removes the last undo command from the undo stack, and returns it. */
 		SPtr<EditorCommand> removeLastFromUndoStack();
 
@@ -94,7 +131,13 @@ namespace bs
 
 		UINT32 mNextCommandId;
 
+		UINT32 mActiveMergeGroup;
+		UINT32 mNextMergeGroupId;
+		bool mHasMergeTarget;
+		UINT32 mMergeTargetId;
+
 		Vector<GroupData> mGroups;
+		Vector<CmdDeleteSO*> mDetachedDeletes;
 	};
 
 	/** @} */
@@ -7,6 +7,7 @@
 #include "Utility/BsModule.h"
 #include "GUI/BsGUIContent.h"
 #include "BsApplication.h"
+#include "Utility/BsTimer.h"
 
 namespace bs
 {
@@ -90,17 +91,23 @@ namespace bs
 	public:
 		BuiltinEditorResources();
 
-		/**	Returns the default editor GUI skin. */
+		/**	Returns the default editor GUI skin. Blocks until the skin is loaded. */
 		BS_SCRIPT_EXPORT(pr:getter,n:GUISkin)
-		BS_NORREF const HGUISkin& getSkin() const { return mSkin; }
+		BS_NORREF const HGUISkin& getSkin() const { waitUntilLoaded(mSkin); return mSkin; }
 
-		/** Returns the default font used by the editor. */
+		/** Returns the default font used by the editor. Blocks until the font is loaded. */
 		BS_SCRIPT_EXPORT(pr:getter,n:DefaultFont)
-		BS_NORREF const HFont& getDefaultFont() const { return mDefaultFont; }
+		BS_NORREF const HFont& getDefaultFont() const { waitUntilLoaded(mDefaultFont); return mDefaultFont; }
 
-		/** Returns the default antialiased font used by the editor. */
+		/** Returns the default antialiased font used by the editor. Blocks until the font is loaded. */
 		BS_SCRIPT_EXPORT(pr:getter,n:DefaultAAFont)
-		BS_NORREF const HFont& getDefaultAAFont() const { return mDefaultAAFont; }
+		BS_NORREF const HFont& getDefaultAAFont() const { waitUntilLoaded(mDefaultAAFont); return mDefaultAAFont; }
+
+		/** 
+		 * Logs how long it took to issue the asynchronous loads of the builtin resources, and how long the main thread
+		 * spent blocked waiting on them so far. Meant to be called once editor start-up completes.
+		 */
+		void logLoadTimings() const;
 
 		/**	Creates a material used for docking drop overlay used by the editor. */
 		HMaterial createDockDropOverlayMaterial() const;
@@ -228,9 +235,26 @@ namespace bs
 		/**	Loads an animated sprite with the specified filename. */
 		HSpriteTexture getAnimatedSprite(const String& name) const;
 
-		/**	Loads a shader with the specified filename */
+		/** 
+		 * Returns a sprite texture with the specified filename from the provided folder. The sprite is loaded on first
+		 * request and then cached in the provided cache, so subsequent requests don't need to build the path or query
+		 * the resource manager.
+		 */
+		HSpriteTexture getCachedSprite(UnorderedMap<String, HSpriteTexture>& cache, const Path& folder, 
+			const String& name) const;
+
+		/**	Starts an asynchronous load of a shader with the specified filename. */
 		HShader getShader(const String& name) const;
 
+		/** Blocks until the provided resource, and its dependencies, finish loading. */
+		void waitUntilLoaded(const HResource& resource) const;
+
+		/** 
+		 * Blocks until the provided shader finishes loading and returns it. In debug mode the shader is also verified on
+		 * first access.
+		 */
+		const HShader& waitUntilShaderLoaded(const HShader& shader) const;
+
 		HShader mShaderDockOverlay;
 		HShader mShaderSceneGrid;
 		HShader mShaderPicking[3];
@@ -253,6 +277,22 @@ namespace bs
 
 		SPtr<ResourceManifest> mResourceManifest;
 
+		Timer mLoadTimer;
+		UINT64 mLoadIssueTimeUs = 0;
+		mutable UINT64 mLoadBlockedTimeUs = 0;
+		mutable UnorderedSet<UUID> mVerifiedShaders;
+
+		static constexpr UINT32 NUM_PROJECT_LIBRARY_ICONS = (UINT32)ProjectLibraryIcon::VectorField + 1;
+		static constexpr UINT32 NUM_PROJECT_LIBRARY_ICON_SIZES = 4;
+		static constexpr UINT32 NUM_LOG_MESSAGE_ICONS = (UINT32)LogMessageIcon::Error + 1;
+		static constexpr UINT32 NUM_LOG_MESSAGE_ICON_VARIANTS = 3;
+
+		mutable UnorderedMap<String, HSpriteTexture> mGUIIconCache;
+		mutable UnorderedMap<String, HSpriteTexture> mGUIIcon3DCache;
+		mutable UnorderedMap<String, HSpriteTexture> mAnimatedSpriteCache;
+		mutable HSpriteTexture mProjectLibraryIcons[NUM_PROJECT_LIBRARY_ICONS][NUM_PROJECT_LIBRARY_ICON_SIZES];
+		mutable HSpriteTexture mLogMessageIcons[NUM_LOG_MESSAGE_ICONS][NUM_LOG_MESSAGE_ICON_VARIANTS];
+
 		static const char* ShaderFolder;
 		static const char* SkinFolder;
 		static const char* IconFolder;
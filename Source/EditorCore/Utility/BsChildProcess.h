@@ -0,0 +1,67 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup Utility-Editor
+	 *  @{
+	 */
+
+	/**
+	 * Launches and communicates with a child process. The child's standard input and output are redirected to pipes
+	 * owned by this object, allowing simple line based communication. Standard error is inherited from the parent.
+	 *
+	 * @note	All methods are thread safe as long as a single object isn't used from multiple threads at once.
+	 */
+	class BS_ED_EXPORT ChildProcess
+	{
+	public:
+		/**
+		 * Closes the child's standard input and waits until the child exits. Well behaved children should exit when
+		 * they detect their input was closed. Children that don't exit within EXIT_TIMEOUT_MS are killed.
+		 */
+		~ChildProcess();
+
+		/**
+		 * Launches a new process.
+		 *
+		 * @param[in]	executable	Path to the executable to launch.
+		 * @param[in]	arguments	List of arguments to pass to the executable.
+		 * @return					Object that can be used for communicating with the process, or null if the process
+		 *							failed to launch.
+		 */
+		static SPtr<ChildProcess> create(const Path& executable, const Vector<String>& arguments);
+
+		/** Writes a single line of text, followed by a newline, to the child's standard input. */
+		bool writeLine(const String& line);
+
+		/**
+		 * Reads a single line of text from the child's standard output, blocking until a full line is available. The
+		 * newline character is not included in the output.
+		 *
+		 * @return	False if the child closed its output (e.g. because it exited or crashed) before a full line was read.
+		 */
+		bool readLine(String& line);
+
+		/** Checks is the child process still running. */
+		bool isRunning() const;
+
+		/** Forcefully kills the child process, if it is still running. */
+		void terminate();
+
+	private:
+		struct Pimpl;
+
+		/** Maximum time to wait for the child to exit on its own when this object is destroyed, in milliseconds. */
+		static constexpr UINT32 EXIT_TIMEOUT_MS = 5000;
+
+		ChildProcess();
+
+		Pimpl* m;
+	};
+
+	/** @} */
+}
\ No newline at end of file
@@ -0,0 +1,296 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Utility/BsEditorProfiler.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Debug/BsDebug.h"
+#include <atomic>
+#include <chrono>
+
+namespace bs
+{
+	/** Per-thread ring buffer of recorded samples. Written only by the owning thread. */
+	struct EditorProfiler::ThreadBuffer
+	{
+		UINT32 index;
+		bool isMainThread;
+		Sample samples[SAMPLES_PER_THREAD];
+		std::atomic<UINT64> numWritten { 0 };
+	};
+
+	/** Buffer belonging to the calling thread, along with the profiler instance it was created by. */
+	struct ThreadBufferRef
+	{
+		UINT32 instanceId = 0;
+		void* buffer = nullptr;
+	};
+
+	static thread_local ThreadBufferRef sThreadBuffer;
+	static std::atomic<UINT32> sNextInstanceId { 1 };
+
+	/** Escapes a string so it can be written as a JSON string value. */
+	static String escapeJson(const char* value)
+	{
+		String output;
+		for (const char* iter = value; *iter != '\0'; ++iter)
+		{
+			if (*iter == '"' || *iter == '\\')
+				output += '\\';
+
+			output += *iter;
+		}
+
+		return output;
+	}
+
+	EditorProfiler::EditorProfiler()
+		:mInstanceId(sNextInstanceId++)
+	{
+		memset(mFrameStarts, 0, sizeof(mFrameStarts));
+
+		// Ensure the main thread always gets the first index
+		getThreadBuffer();
+	}
+
+	EditorProfiler::~EditorProfiler()
+	{
+		for (auto& buffer : mThreadBuffers)
+			bs_delete(buffer);
+	}
+
+	UINT64 EditorProfiler::getTime()
+	{
+		using namespace std::chrono;
+		return (UINT64)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+	}
+
+	EditorProfiler::ThreadBuffer* EditorProfiler::getThreadBuffer()
+	{
+		if (sThreadBuffer.instanceId == mInstanceId)
+			return (ThreadBuffer*)sThreadBuffer.buffer;
+
+		ThreadBuffer* buffer = bs_new<ThreadBuffer>();
+
+		{
+			Lock lock(mMutex);
+
+			buffer->index = (UINT32)mThreadBuffers.size();
+			buffer->isMainThread = mThreadBuffers.empty();
+			mThreadBuffers.push_back(buffer);
+		}
+
+		sThreadBuffer.instanceId = mInstanceId;
+		sThreadBuffer.buffer = buffer;
+
+		return buffer;
+	}
+
+	void EditorProfiler::beginFrame()
+	{
+		mFrameStarts[mFrameIdx % MAX_FRAMES] = getTime();
+		mFrameIdx++;
+	}
+
+	void EditorProfiler::record(const char* name, UINT64 start, UINT64 end)
+	{
+		ThreadBuffer* buffer = getThreadBuffer();
+
+		const UINT64 idx = buffer->numWritten.load(std::memory_order_relaxed);
+		buffer->samples[idx % SAMPLES_PER_THREAD] = { name, start, end };
+		buffer->numWritten.store(idx + 1, std::memory_order_release);
+	}
+
+	Vector<EditorProfiler::Sample> EditorProfiler::readSamples(const ThreadBuffer& buffer, UINT64 startTime)
+	{
+		const UINT64 numWritten = buffer.numWritten.load(std::memory_order_acquire);
+		const UINT64 first = numWritten > SAMPLES_PER_THREAD ? numWritten - SAMPLES_PER_THREAD : 0;
+
+		Vector<Sample> samples;
+		samples.reserve((size_t)(numWritten - first));
+
+		for (UINT64 i = first; i < numWritten; i++)
+			samples.push_back(buffer.samples[i % SAMPLES_PER_THREAD]);
+
+		// The owning thread keeps writing while we copy. Any sample it could have overwritten in the meantime is
+		// discarded, as it might be torn.
+		const UINT64 numWrittenAfter = buffer.numWritten.load(std::memory_order_acquire);
+		const UINT64 firstValid = numWrittenAfter >= SAMPLES_PER_THREAD ? numWrittenAfter - SAMPLES_PER_THREAD + 1 : 0;
+		if (firstValid > first)
+		{
+			const UINT64 numInvalid = std::min(firstValid - first, (UINT64)samples.size());
+			samples.erase(samples.begin(), samples.begin() + (size_t)numInvalid);
+		}
+
+		samples.erase(std::remove_if(samples.begin(), samples.end(),
+			[startTime](const Sample& sample) { return sample.start < startTime; }), samples.end());
+
+		return samples;
+	}
+
+	String EditorProfiler::dumpTrace(const Path& path, UINT32 numFrames)
+	{
+		// Only complete frames are exported, the last frame start marks the end of the range
+		const UINT64 numCompleteFrames = std::min(mFrameIdx > 0 ? mFrameIdx - 1 : 0, (UINT64)(MAX_FRAMES - 1));
+		numFrames = (UINT32)std::min((UINT64)numFrames, numCompleteFrames);
+		if (numFrames == 0)
+			return StringUtil::BLANK;
+
+		const UINT64 lastFrame = mFrameIdx - 1;
+		const UINT64 firstFrame = lastFrame - numFrames;
+		const UINT64 startTime = mFrameStarts[firstFrame % MAX_FRAMES];
+		const UINT64 endTime = mFrameStarts[lastFrame % MAX_FRAMES];
+
+		Vector<ThreadBuffer*> buffers;
+		{
+			Lock lock(mMutex);
+			buffers = mThreadBuffers;
+		}
+
+		Vector<Vector<Sample>> samples(buffers.size());
+		for (UINT32 i = 0; i < (UINT32)buffers.size(); i++)
+		{
+			samples[i] = readSamples(*buffers[i], startTime);
+
+			samples[i].erase(std::remove_if(samples[i].begin(), samples[i].end(),
+				[endTime](const Sample& sample) { return sample.start >= endTime; }), samples[i].end());
+		}
+
+		StringStream output;
+		output << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+		bool first = true;
+		auto writeSeparator = [&]()
+		{
+			if (!first)
+				output << ",";
+
+			output << "\n";
+			first = false;
+		};
+
+		for (auto& buffer : buffers)
+		{
+			const String threadName = buffer->isMainThread ? String("Main") : "Worker " + toString(buffer->index);
+
+			writeSeparator();
+			output << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->index <<
+				",\"args\":{\"name\":\"" << threadName << "\"}}";
+		}
+
+		for (UINT64 i = firstFrame; i < lastFrame; i++)
+		{
+			const UINT64 frameStart = mFrameStarts[i % MAX_FRAMES];
+			const UINT64 frameEnd = mFrameStarts[(i + 1) % MAX_FRAMES];
+
+			writeSeparator();
+			output << "{\"name\":\"Frame\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":" <<
+				(frameStart - startTime) << ",\"dur\":" << (frameEnd - frameStart) << "}";
+		}
+
+		for (UINT32 i = 0; i < (UINT32)buffers.size(); i++)
+		{
+			for (auto& sample : samples[i])
+			{
+				writeSeparator();
+				output << "{\"name\":\"" << escapeJson(sample.name) << "\",\"cat\":\"editor\",\"ph\":\"X\",\"pid\":0,"
+					"\"tid\":" << buffers[i]->index << ",\"ts\":" << (sample.start - startTime) << ",\"dur\":" <<
+					(sample.end - sample.start) << "}";
+			}
+		}
+
+		output << "\n]}\n";
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		if (stream == nullptr)
+		{
+			BS_LOG(Error, Editor, "Unable to write the profiler trace to: {0}", path.toString());
+			return StringUtil::BLANK;
+		}
+
+		stream->writeString(output.str());
+		stream->close();
+
+		return buildSummary(samples, firstFrame, lastFrame);
+	}
+
+	String EditorProfiler::buildSummary(const Vector<Vector<Sample>>& samples, UINT64 firstFrame, UINT64 lastFrame) const
+	{
+		struct ScopeStats
+		{
+			UINT64 total = 0;
+			UINT64 maxPerFrame = 0;
+			UINT64 numCalls = 0;
+		};
+
+		const UINT64 numFrames = lastFrame - firstFrame;
+		const UINT64 startTime = mFrameStarts[firstFrame % MAX_FRAMES];
+		const UINT64 frameTime = mFrameStarts[lastFrame % MAX_FRAMES] - startTime;
+
+		Vector<UINT64> frameStarts((size_t)numFrames);
+		for (UINT64 i = 0; i < numFrames; i++)
+			frameStarts[(size_t)i] = mFrameStarts[(firstFrame + i) % MAX_FRAMES];
+
+		// Per-scope time in each frame. Samples are attributed to the frame they started in. Note that samples are
+		// stored in the order they finished, so nested scopes come before their parents.
+		Map<String, Vector<UINT64>> perFrame;
+		Map<String, ScopeStats> stats;
+		for (auto& threadSamples : samples)
+		{
+			for (auto& sample : threadSamples)
+			{
+				auto iterFind = std::upper_bound(frameStarts.begin(), frameStarts.end(), sample.start);
+				if (iterFind == frameStarts.begin())
+					continue;
+
+				const size_t frame = (size_t)(iterFind - frameStarts.begin()) - 1;
+
+				Vector<UINT64>& frameTimes = perFrame[sample.name];
+				if (frameTimes.empty())
+					frameTimes.resize((size_t)numFrames, 0);
+
+				frameTimes[frame] += sample.end - sample.start;
+				stats[sample.name].numCalls++;
+			}
+		}
+
+		Vector<std::pair<String, ScopeStats>> sortedStats;
+		for (auto& entry : perFrame)
+		{
+			ScopeStats& scopeStats = stats[entry.first];
+			for (auto& time : entry.second)
+			{
+				scopeStats.total += time;
+				scopeStats.maxPerFrame = std::max(scopeStats.maxPerFrame, time);
+			}
+
+			sortedStats.push_back(std::make_pair(entry.first, scopeStats));
+		}
+
+		std::sort(sortedStats.begin(), sortedStats.end(),
+			[](const std::pair<String, ScopeStats>& a, const std::pair<String, ScopeStats>& b)
+		{
+			return a.second.total > b.second.total;
+		});
+
+		auto toMs = [](double us) { return toString((float)(us / 1000.0), 3, 0, ' ', std::ios::fixed); };
+
+		const double avgFrameTime = (double)frameTime / numFrames;
+
+		StringStream output;
+		output << "Editor frame budget over " << numFrames << " frames (average frame: " << toMs(avgFrameTime) <<
+			" ms)\n";
+		output << "Scope (inclusive of nested scopes): average ms/frame, max ms/frame, % of frame, calls/frame\n";
+
+		for (auto& entry : sortedStats)
+		{
+			const double avgTime = (double)entry.second.total / numFrames;
+			const double percent = avgFrameTime > 0.0 ? avgTime / avgFrameTime * 100.0 : 0.0;
+
+			output << entry.first << ": " << toMs(avgTime) << ", " << toMs((double)entry.second.maxPerFrame) << ", " <<
+				toString((float)percent, 1, 0, ' ', std::ios::fixed) << "%, " <<
+				toString((float)entry.second.numCalls / numFrames, 1, 0, ' ', std::ios::fixed) << "\n";
+		}
+
+		return output.str();
+	}
+}
\ No newline at end of file
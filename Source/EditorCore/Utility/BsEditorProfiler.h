@@ -0,0 +1,125 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Utility/BsModule.h"
+
+/** Set to 0 to compile out all editor profiling scopes. Normally controlled through the EDITOR_PROFILING CMake option. */
+#ifndef BS_ED_PROFILING
+#define BS_ED_PROFILING 1
+#endif
+
+#define BS_ED_PROFILE_CONCAT_INNER(a, b) a##b
+#define BS_ED_PROFILE_CONCAT(a, b) BS_ED_PROFILE_CONCAT_INNER(a, b)
+
+#if BS_ED_PROFILING
+/**
+ * Records the time spent in the current scope to the EditorProfiler, under the provided name. The name must be a string
+ * literal.
+ */
+#define BS_ED_PROFILE_SCOPE(name) ::bs::EditorProfilerScope BS_ED_PROFILE_CONCAT(_edProfileScope, __LINE__)(name)
+#else
+#define BS_ED_PROFILE_SCOPE(name)
+#endif
+
+namespace bs
+{
+	/** @addtogroup Utility-Editor
+	 *  @{
+	 */
+
+	/**
+	 * Records CPU timings of editor code marked with BS_ED_PROFILE_SCOPE. Each thread records into its own fixed-size ring
+	 * buffer without taking any locks, and only the most recent samples are retained. Samples recorded during the last
+	 * few frames can be exported in the Chrome trace event format (viewable in chrome://tracing or Perfetto), along with
+	 * a summary of the frame time spent in each scope.
+	 */
+	class BS_ED_EXPORT EditorProfiler : public Module<EditorProfiler>
+	{
+		struct ThreadBuffer;
+
+	public:
+		/** Single recorded scope. Times are in microseconds, as returned by getTime(). */
+		struct Sample
+		{
+			const char* name;
+			UINT64 start;
+			UINT64 end;
+		};
+
+		EditorProfiler();
+		~EditorProfiler();
+
+		/** Marks the start of a new frame. Must be called once per frame, from the main thread. */
+		void beginFrame();
+
+		/**
+		 * Records a sample on the calling thread's buffer. @p name must remain valid for the lifetime of the profiler
+		 * (e.g. a string literal).
+		 */
+		void record(const char* name, UINT64 start, UINT64 end);
+
+		/**
+		 * Writes all samples recorded during the last @p numFrames frames to a file in Chrome trace event JSON format.
+		 * Must be called from the main thread.
+		 *
+		 * @param[in]	path		Absolute path to the file to write.
+		 * @param[in]	numFrames	Number of most recent frames to export. Limited by the number of frames recorded so far.
+		 * @return					Human readable summary of the average and maximum time spent per frame in each of the
+		 *							profiled scopes. Empty if there were no complete frames to export.
+		 */
+		String dumpTrace(const Path& path, UINT32 numFrames);
+
+		/** Returns the current time in microseconds, on the same timeline as recorded samples. */
+		static UINT64 getTime();
+
+		/** Maximum number of samples retained per thread. */
+		static constexpr UINT32 SAMPLES_PER_THREAD = 16384;
+
+		/** Maximum number of frames that can be exported. */
+		static constexpr UINT32 MAX_FRAMES = 600;
+
+	private:
+		/** Returns the sample buffer of the calling thread, creating it if needed. */
+		ThreadBuffer* getThreadBuffer();
+
+		/** Returns a copy of all the samples in the provided buffer that start at or after the provided time. */
+		static Vector<Sample> readSamples(const ThreadBuffer& buffer, UINT64 startTime);
+
+		/** Builds a summary of time spent in each scope, for the provided samples and frame range. */
+		String buildSummary(const Vector<Vector<Sample>>& samples, UINT64 firstFrame, UINT64 lastFrame) const;
+
+		UINT32 mInstanceId;
+		Mutex mMutex;
+		Vector<ThreadBuffer*> mThreadBuffers;
+
+		UINT64 mFrameStarts[MAX_FRAMES];
+		UINT64 mFrameIdx = 0;
+	};
+
+	/** Records the time between its construction and destruction to the EditorProfiler. Use BS_ED_PROFILE_SCOPE. */
+	class EditorProfilerScope
+	{
+	public:
+		EditorProfilerScope(const char* name)
+			:mName(name), mActive(EditorProfiler::isStarted())
+		{
+			if (mActive)
+				mStart = EditorProfiler::getTime();
+		}
+
+		~EditorProfilerScope()
+		{
+			if (mActive && EditorProfiler::isStarted())
+				EditorProfiler::instance().record(mName, mStart, EditorProfiler::getTime());
+		}
+
+	private:
+		const char* mName;
+		UINT64 mStart = 0;
+		bool mActive;
+	};
+
+	/** @} */
+}
\ No newline at end of file
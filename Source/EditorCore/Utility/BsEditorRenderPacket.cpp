@@ -0,0 +1,32 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Utility/BsEditorRenderPacket.h"
+#include "CoreThread/BsCoreThread.h"
+#include "Utility/BsEditorProfiler.h"
+
+namespace bs
+{
+	void EditorRenderPacket::queue(std::function<void()> command)
+	{
+		mCommands.push_back(std::move(command));
+	}
+
+	void EditorRenderPacket::submit()
+	{
+		if (mCommands.empty())
+			return;
+
+		BS_ED_PROFILE_SCOPE("EditorRenderPacket::submit");
+
+		// Most systems queue the same number of commands every frame, so start the next packet at the same size
+		Vector<std::function<void()>> commands;
+		commands.reserve(mCommands.size());
+		commands.swap(mCommands);
+
+		gCoreThread().queueCommand([commands = std::move(commands)]()
+		{
+			for (auto& command : commands)
+				command();
+		});
+	}
+}
\ No newline at end of file
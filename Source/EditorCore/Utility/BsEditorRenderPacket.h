@@ -0,0 +1,43 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Utility/BsModule.h"
+
+namespace bs
+{
+	/** @addtogroup Utility-Editor
+	 *  @{
+	 */
+
+	/**
+	 * Collects the per-frame updates editor systems (gizmos, handles, selection overlay, grid, dock overlay) send to their
+	 * core thread renderers, and sends them to the core thread as a single command at the end of the frame. This keeps
+	 * the number of core thread commands constant regardless of the number of editor systems and scene views.
+	 *
+	 * Commands are executed on the core thread in the order they were queued. Any data they need should be moved into
+	 * the command, and the core thread object they operate on should be captured by shared pointer, so it remains alive
+	 * if its owner is destroyed before the packet is submitted.
+	 */
+	class BS_ED_EXPORT EditorRenderPacket : public Module<EditorRenderPacket>
+	{
+	public:
+		/** Queues a command to be executed on the core thread when the packet is next submitted. */
+		void queue(std::function<void()> command);
+
+		/**
+		 * Sends all queued commands to the core thread as a single command. Called once per frame by the editor, after
+		 * all editor systems were updated and before the frame is rendered.
+		 */
+		void submit();
+
+		/** Returns the number of commands queued since the last submit. */
+		UINT32 getNumQueued() const { return (UINT32)mCommands.size(); }
+
+	private:
+		Vector<std::function<void()>> mCommands;
+	};
+
+	/** @} */
+}
\ No newline at end of file
@@ -26,6 +26,18 @@ namespace bs.Editor
             set { Internal_SetState(mCachedPtr, value);}
         }
 
+        /// <summary>
+        /// Query used for filtering the displayed scene objects. When set, only scene objects whose name contains the
+        /// query text are displayed, along with their parents. The query can also contain "t:Type" tokens, limiting the
+        /// results to objects with a component whose type name contains the provided text. Matching is case insensitive.
+        /// Set to an empty string to display all scene objects.
+        /// </summary>
+        public string Filter
+        {
+            get { return Internal_GetFilter(mCachedPtr); }
+            set { Internal_SetFilter(mCachedPtr, value); }
+        }
+
         /// <summary>
         /// Creates a new scene tree view element.
         /// </summary>
@@ -198,6 +210,12 @@ namespace bs.Editor
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_SetState(IntPtr thisPtr, SceneTreeViewState state);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern string Internal_GetFilter(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetFilter(IntPtr thisPtr, string filter);
     }
 
     /** @} */
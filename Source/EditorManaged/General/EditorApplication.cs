@@ -53,6 +53,11 @@ namespace bs.Editor
         internal const string DeleteBinding = "Delete";
         internal const string PasteBinding = "Paste";
 
+        /// <summary>
+        /// Default number of frames saved by <see cref="SaveProfilerTrace(string, int)"/>.
+        /// </summary>
+        public const int DefaultProfilerTraceFrames = 300;
+
         internal const string EditorSceneDataPrefix = "__EditorSceneData";
 
         /// <summary>
@@ -272,6 +277,9 @@ namespace bs.Editor
 
             codeManager = new ScriptCodeManager();
 
+            // Continuous update requests don't survive assembly refresh
+            Internal_SetContinuousUpdate(false);
+
             Scene.OnSceneLoad += OnSceneLoad;
             Scene.OnSceneUnload += OnSceneUnload;
 
@@ -512,7 +520,11 @@ namespace bs.Editor
         /// Opens a dialog to allows the user to select a location where to save the current scene. If scene was previously
         /// saved it is instead automatically saved at the last location.
         /// </summary>
-        public static void SaveScene(Action onSuccess = null, Action onFailure = null)
+        /// <param name="onSuccess">Optional callback to trigger when the save succeeds.</param>
+        /// <param name="onFailure">Optional callback to trigger when the save fails.</param>
+        /// <param name="async">If true, and the scene was previously saved, the scene file will be written in the 
+        ///                     background. See <see cref="SaveScene(string, bool)"/>.</param>
+        public static void SaveScene(Action onSuccess = null, Action onFailure = null, bool async = false)
         {
             if (!Scene.ActiveSceneUUID.IsEmpty())
             {
@@ -525,7 +537,7 @@ namespace bs.Editor
                     }
                     else
                     {
-                        SaveScene(scenePath);
+                        SaveScene(scenePath, async);
 
                         if (onSuccess != null)
                             onSuccess();
@@ -584,6 +596,12 @@ namespace bs.Editor
             Action<string> continueLoad =
                 (scenePath) =>
                 {
+                    // Scene being loaded could be the one being saved in the background
+                    Internal_WaitForSceneSave();
+
+                    // Objects deleted from the current scene must be serialized to remain undoable after it unloads
+                    UndoRedo.Global.SerializeDeletedObjects();
+
                     if (string.IsNullOrEmpty(path))
                     {
                         Scene.Clear();
@@ -624,9 +642,13 @@ namespace bs.Editor
         /// </summary>
         /// <param name="path">Path relative to the resource folder. This can be the path to the existing scene
         ///                    prefab if it just needs updating. </param>
-        internal static void SaveScene(string path)
+        /// <param name="async">If true, and the scene prefab already exists, only a snapshot of the scene will be taken
+        ///                     on the calling thread, while the file will be written in the background. Further scene
+        ///                     edits can be made while the save is in progress and will not affect the saved file.
+        ///                     </param>
+        internal static void SaveScene(string path, bool async = false)
         {
-            Prefab scene = Internal_SaveScene(path);
+            Prefab scene = Internal_SaveScene(path, async);
             Scene.SetActive(scene);
 
             ProjectLibrary.Refresh(true);
@@ -711,7 +733,7 @@ namespace bs.Editor
         [ToolbarItem("Save Scene", ToolbarIcon.SaveScene, "Save scene (Ctrl + S)", 1998)]
         private static void SaveSceneMenu()
         {
-            SaveScene();
+            SaveScene(null, null, true);
         }
 
         /// <summary>
@@ -879,6 +901,8 @@ namespace bs.Editor
 
             GameWindow gameWindow = EditorWindow.GetWindow<GameWindow>();
             gameWindow?.NotifyNeedsRedraw();
+
+            Internal_Invalidate();
         }
 
         /// <summary>
@@ -904,6 +928,9 @@ namespace bs.Editor
 
             GameWindow gameWindow = EditorWindow.GetWindow<GameWindow>();
             gameWindow?.ToggleOnDemandDrawing(isEnabled);
+
+            // Anything that needs the viewports to redraw every frame also needs the editor to run at full frame rate
+            Internal_SetContinuousUpdate(!isEnabled);
         }
 
         /// <summary>
@@ -916,6 +943,53 @@ namespace bs.Editor
             return onDemandDrawingDisablers.Count == 0;
         }
 
+        /// <summary>
+        /// Returns the number of frames skipped since the editor was started, due to the editor running at the reduced
+        /// frame rate while idle or unfocused. See <see cref="EditorSettings.IdleFPSLimit"/>.
+        /// </summary>
+        /// <returns>Number of skipped frames, relative to the regular FPS limit.</returns>
+        public static ulong GetSkippedFrameCount()
+        {
+            return Internal_GetSkippedFrameCount();
+        }
+
+        /// <summary>
+        /// Saves CPU timings of editor subsystems recorded during the most recent frames, in the Chrome trace event
+        /// format. The saved file can be viewed in chrome://tracing or Perfetto.
+        /// </summary>
+        /// <param name="path">Absolute path to the file to save the trace to.</param>
+        /// <param name="numFrames">Number of most recent frames to save.</param>
+        /// <returns>Summary of the frame time spent in each of the profiled subsystems, or an empty string if no frames
+        ///          were recorded.</returns>
+        public static string SaveProfilerTrace(string path, int numFrames = DefaultProfilerTraceFrames)
+        {
+            return Internal_SaveProfilerTrace(path, (uint)Math.Max(numFrames, 0));
+        }
+
+        /// <summary>
+        /// Opens a dialog that allows the user to select a location where to save CPU timings of editor subsystems
+        /// recorded during the most recent frames. A summary of the frame time spent in each subsystem is output to
+        /// the log.
+        /// </summary>
+        [MenuItem("Tools/Save Profiler Trace", 9200)]
+        private static void SaveProfilerTrace()
+        {
+            string defaultFolder = IsProjectLoaded ? ProjectPath : "";
+
+            string tracePath;
+            if (!BrowseDialog.SaveFile(defaultFolder, "*.json", out tracePath))
+                return;
+
+            if (string.IsNullOrEmpty(Path.GetExtension(tracePath)))
+                tracePath += ".json";
+
+            string summary = SaveProfilerTrace(tracePath);
+            if (string.IsNullOrEmpty(summary))
+                Debug.LogWarning("No editor profiling data was recorded.");
+            else
+                Debug.Log(summary);
+        }
+
         /// <summary>
         /// Checks does the path represent a native resource.
         /// </summary>
@@ -1206,7 +1280,10 @@ namespace bs.Editor
         private static extern string Internal_GetScriptEditorAssemblyName();
 
         [MethodImpl(MethodImplOptions.InternalCall)]
-        private static extern Prefab Internal_SaveScene(string path);
+        private static extern Prefab Internal_SaveScene(string path, bool async);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_WaitForSceneSave();
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern bool Internal_IsValidProject(string path);
@@ -1243,6 +1320,18 @@ namespace bs.Editor
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern bool Internal_HasFocus();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_Invalidate();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetContinuousUpdate(bool enabled);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern ulong Internal_GetSkippedFrameCount();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern string Internal_SaveProfilerTrace(string path, uint numFrames);
     }
 
     /** @} */
@@ -53,6 +53,11 @@ namespace bs.Editor
                         lastSelectedSceneObjects.Add(entry.UUID);
                 }
 
+                // Starting or stopping play mode replaces the scene, deleted objects held by undo commands must be
+                // serialized to survive it
+                if (State == PlayInEditorState.Stopped || value == PlayInEditorState.Stopped)
+                    UndoRedo.Global.SerializeDeletedObjects();
+
                 Internal_setState(value);
             }
         }
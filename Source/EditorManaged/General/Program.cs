@@ -119,15 +119,9 @@ namespace bs.Editor
             else
                 ProjectWindow.Open();
 
+            // Code editors are still being detected in the background, so only record the choice rather than waiting
             CodeEditorType activeCodeEditor = (CodeEditorType)EditorSettings.GetInt(SettingsWindow.ActiveCodeEditorKey, (int) CodeEditorType.None);
-            CodeEditorType[] availableEditors = CodeEditor.AvailableEditors;
-            if (Array.Exists(availableEditors, x => x == activeCodeEditor))
-                CodeEditor.ActiveEditor = activeCodeEditor;
-            else
-            {
-                if (availableEditors.Length > 0)
-                    CodeEditor.ActiveEditor = availableEditors[0];
-            }
+            CodeEditor.SetPreferredEditor(activeCodeEditor);
         }
 
         /// <summary>
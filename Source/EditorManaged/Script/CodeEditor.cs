@@ -99,6 +99,17 @@ namespace bs.Editor
             isSolutionDirty = false;
         }
 
+        /// <summary>
+        /// Sets the code editor to activate once detection of installed code editors finishes. If the editor isn't
+        /// available the first available editor is used instead. Unlike setting <see cref="ActiveEditor"/> this doesn't
+        /// wait for detection to finish.
+        /// </summary>
+        /// <param name="type">Code editor to activate.</param>
+        internal static void SetPreferredEditor(CodeEditorType type)
+        {
+            Internal_SetPreferredEditor(type);
+        }
+
         /// <summary>
         /// Notifies the code editor that code file structure has changed and the solution needs to be rebuilt.
         /// </summary>
@@ -110,6 +121,9 @@ namespace bs.Editor
         [MethodImpl(MethodImplOptions.InternalCall)]
         internal static extern void Internal_SetActiveEditor(CodeEditorType type);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SetPreferredEditor(CodeEditorType type);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         internal static extern CodeEditorType Internal_GetActiveEditor();
 
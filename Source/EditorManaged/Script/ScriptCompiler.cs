@@ -108,17 +108,29 @@ namespace bs.Editor
             Array.Copy(frameworkAssemblies, assemblies, frameworkAssemblies.Length);
 
             string defines = BuildManager.GetDefines(platform);
-            return new CompilerInstance(scriptFiles.ToArray(), defines, assemblyFolders, assemblies, debug, outputFile);
+            string[] options = CompilerInstance.GetOptions(defines, assemblyFolders, assemblies, debug, "library", 
+                outputFile);
+
+            ScriptCompilerServer.Prepare();
+            return new CompilerInstance(scriptFiles.ToArray(), options, outputFile);
         }
     }
 
     /// <summary>
-    /// Represents a started compiler process used for compiling a set of script files into an assembly.
+    /// Represents a compilation of a set of script files into an assembly. Compilation is performed by the persistent
+    /// compiler server if available, or by a newly started compiler process otherwise.
     /// </summary>
     public class CompilerInstance
     {
         private Process process;
-        private Thread readErrorsThread;
+        private ProcessStartInfo processStartInfo;
+        private Thread compileThread;
+        private bool succeeded;
+        private bool disposed;
+
+        private string[] files;
+        private string[] options;
+        private string outputFile;
 
         private List<CompilerMessage> errors = new List<CompilerMessage>();
         private List<CompilerMessage> warnings = new List<CompilerMessage>();
@@ -127,68 +139,98 @@ namespace bs.Editor
         private Regex compilerErrorRegex = new Regex(@"\s*error[^:]*:\s*(?<message>.*)");
 
         /// <summary>
-        /// Creates a new compiler process and starts compilation of the provided files.
+        /// Starts compilation of the provided files.
         /// </summary>
         /// <param name="files">Absolute paths to all the C# script files to compile.</param>
+        /// <param name="options">Compiler options, as returned by <see cref="GetOptions"/>.</param>
+        /// <param name="outputFile">Absolute path to the assembly file to generate.</param>
+        internal CompilerInstance(string[] files, string[] options, string outputFile)
+        {
+            this.files = files;
+            this.options = options;
+            this.outputFile = outputFile;
+
+            // Prepared here as it requires access to the editor, in case the compiler server cannot be used
+            processStartInfo = GetProcessStartInfo(options, files);
+
+            if (File.Exists(outputFile))
+                File.Delete(outputFile);
+
+            string outputDir = Path.GetDirectoryName(outputFile);
+            if (!Directory.Exists(outputDir))
+                Directory.CreateDirectory(outputDir);
+
+            compileThread = new Thread(Compile);
+            compileThread.Start();
+        }
+
+        /// <summary>
+        /// Builds a list of compiler options (excluding the files to compile).
+        /// </summary>
         /// <param name="defines">A set of semi-colon separated defines to provide to the compiler.</param>
         /// <param name="assemblyFolders">A set of folders containing the assemblies referenced by the script files.</param>
         /// <param name="assemblies">Names of the assemblies containing code referenced by the script files.</param>
         /// <param name="debugBuild">Determines should the assembly be compiled with additional debug information.</param>
+        /// <param name="target">Type of the output to generate (e.g. library or exe).</param>
         /// <param name="outputFile">Absolute path to the assembly file to generate.</param>
-        internal CompilerInstance(string[] files, string defines, string[] assemblyFolders, string[] assemblies,
-            bool debugBuild, string outputFile)
+        /// <returns>List of options, one option per entry.</returns>
+        internal static string[] GetOptions(string defines, string[] assemblyFolders, string[] assemblies, 
+            bool debugBuild, string target, string outputFile)
         {
-            ProcessStartInfo procStartInfo = new ProcessStartInfo();
-            StringBuilder argumentsBuilder = new StringBuilder();
-
-            argumentsBuilder.Append("\"" + EditorApplication.CompilerPath + "\"");
-
-            string monoDir = Path.GetDirectoryName(EditorApplication.CompilerPath);
-            monoDir = Path.Combine(monoDir, "../");
-
-            argumentsBuilder.Append(" \"" + monoDir + "\"");
-            argumentsBuilder.Append(" -noconfig");
+            List<string> options = new List<string>();
+            options.Add("-noconfig");
 
             if (!string.IsNullOrEmpty(defines))
-                argumentsBuilder.Append(" -d:" + defines);
+                options.Add("-d:" + defines);
 
             if (assemblyFolders != null && assemblyFolders.Length > 0)
-            {
-                argumentsBuilder.Append(" -lib:\"");
+                options.Add("-lib:" + string.Join(",", assemblyFolders));
 
-                for (int i = 0; i < assemblyFolders.Length - 1; i++)
-                    argumentsBuilder.Append(assemblyFolders[i] + ",");
+            if (assemblies != null && assemblies.Length > 0)
+                options.Add("-r:" + string.Join(",", assemblies));
 
-                argumentsBuilder.Append(assemblyFolders[assemblyFolders.Length - 1] + "\"");
+            if (debugBuild)
+            {
+                options.Add("-debug+");
+                options.Add("-o-");
             }
-
-            if (assemblies != null && assemblies.Length > 0)
+            else
             {
-                argumentsBuilder.Append(" -r:");
+                options.Add("-debug-");
+                options.Add("-o+");
+            }
 
-                for (int i = 0; i < assemblies.Length - 1; i++)
-                    argumentsBuilder.Append(assemblies[i] + ",");
+            options.Add("-target:" + target);
+            options.Add("-out:" + outputFile);
 
-                argumentsBuilder.Append(assemblies[assemblies.Length - 1]);
-            }
+            return options.ToArray();
+        }
 
-            if (debugBuild)
-                argumentsBuilder.Append(" -debug+ -o-");
-            else
-                argumentsBuilder.Append(" -debug- -o+");
+        /// <summary>
+        /// Returns information required for starting a process that runs the compiler once, with the provided options
+        /// and files.
+        /// </summary>
+        /// <param name="options">Compiler options, as returned by <see cref="GetOptions"/>.</param>
+        /// <param name="files">Absolute paths to all the C# script files to compile.</param>
+        /// <returns>Start information for the compiler process.</returns>
+        internal static ProcessStartInfo GetProcessStartInfo(string[] options, string[] files)
+        {
+            StringBuilder argumentsBuilder = new StringBuilder();
 
-            argumentsBuilder.Append(" -target:library -out:" + "\"" + outputFile + "\"");
+            argumentsBuilder.Append("\"" + EditorApplication.CompilerPath + "\"");
 
-            for (int i = 0; i < files.Length; i++)
-                argumentsBuilder.Append(" \"" + files[i] + "\"");
+            string monoDir = Path.GetDirectoryName(EditorApplication.CompilerPath);
+            monoDir = Path.Combine(monoDir, "../");
 
-            if (File.Exists(outputFile))
-                File.Delete(outputFile);
+            argumentsBuilder.Append(" \"" + monoDir + "\"");
 
-            string outputDir = Path.GetDirectoryName(outputFile);
-            if (!Directory.Exists(outputDir))
-                Directory.CreateDirectory(outputDir);
+            for (int i = 0; i < options.Length; i++)
+                argumentsBuilder.Append(" \"" + options[i] + "\"");
+
+            for (int i = 0; i < files.Length; i++)
+                argumentsBuilder.Append(" \"" + files[i] + "\"");
 
+            ProcessStartInfo procStartInfo = new ProcessStartInfo();
             procStartInfo.Arguments = argumentsBuilder.ToString();
             procStartInfo.CreateNoWindow = true;
             procStartInfo.FileName = EditorApplication.MonoExecPath;
@@ -197,43 +239,87 @@ namespace bs.Editor
             procStartInfo.UseShellExecute = false;
             procStartInfo.WorkingDirectory = EditorApplication.ProjectPath;
 
-            process = new Process();
-            process.StartInfo = procStartInfo;
-            process.Start();
-
-            readErrorsThread = new Thread(ReadErrorStream);
-            readErrorsThread.Start();
+            return procStartInfo;
         }
 
         /// <summary>
-        /// Worker thread method that continually checks for compiler error messages and warnings.
+        /// Worker thread method that performs the compilation, either through the compiler server or by starting a
+        /// compiler process, and collects compiler error messages and warnings.
         /// </summary>
-        private void ReadErrorStream()
+        private void Compile()
         {
-            while (true)
+            List<string> messages = new List<string>();
+            if (ScriptCompilerServer.TryCompile(files, options, messages, out succeeded))
             {
-                if (process == null || process.HasExited)
+                foreach (var entry in messages)
+                    AddMessage(entry);
+
+                return;
+            }
+
+            Process compilerProcess;
+            lock (this)
+            {
+                if (disposed)
                     return;
 
-                string line = process.StandardError.ReadLine();
-                if (string.IsNullOrEmpty(line))
-                    continue;
+                process = new Process();
+                process.StartInfo = processStartInfo;
+                process.Start();
+
+                compilerProcess = process;
+            }
 
-                CompilerMessage message;
-                if (TryParseCompilerMessage(line, out message))
+            try
+            {
+                while (true)
                 {
-                    if (message.type == CompilerMessageType.Warning)
-                    {
-                        lock (warnings)
-                            warnings.Add(message);
-                    }
-                    else if (message.type == CompilerMessageType.Error)
-                    {
-                        lock (errors)
-                            errors.Add(message);
-                    }
+                    string line = compilerProcess.StandardError.ReadLine();
+                    if (line == null)
+                        break;
+
+                    if (string.IsNullOrEmpty(line))
+                        continue;
+
+                    AddMessage(line);
                 }
             }
+            catch (Exception)
+            {
+                // Process was killed and disposed of while we were reading its output
+                return;
+            }
+
+            lock (this)
+            {
+                if (disposed)
+                    return;
+
+                compilerProcess.WaitForExit();
+                succeeded = compilerProcess.ExitCode == 0;
+            }
+        }
+
+        /// <summary>
+        /// Parses a line of compiler output and registers it as an error or a warning, if it is one.
+        /// </summary>
+        /// <param name="line">Line output by the compiler.</param>
+        private void AddMessage(string line)
+        {
+            CompilerMessage message;
+            if (!TryParseCompilerMessage(line, out message))
+                return;
+
+            if (message.type == CompilerMessageType.Warning)
+            {
+                lock (warnings)
+                    warnings.Add(message);
+            }
+            else if (message.type == CompilerMessageType.Error)
+            {
+                lock (errors)
+                    errors.Add(message);
+            }
         }
 
         /// <summary>
@@ -280,7 +366,7 @@ namespace bs.Editor
         /// </summary>
         public bool IsDone
         {
-            get { return process.HasExited && readErrorsThread.ThreadState == System.Threading.ThreadState.Stopped; }
+            get { return compileThread.ThreadState == System.Threading.ThreadState.Stopped; }
         }
 
         /// <summary>
@@ -288,7 +374,7 @@ namespace bs.Editor
         /// </summary>
         public bool HasErrors
         {
-            get { return IsDone && process.ExitCode != 0; }
+            get { return IsDone && !succeeded; }
         }
 
         /// <summary>
@@ -320,20 +406,27 @@ namespace bs.Editor
         }
 
         /// <summary>
-        /// Disposes of the compiler process. Should be called when done when this object instance.
+        /// Disposes of the compiler process, if one was started. Should be called when done when this object instance.
+        /// Compilations running on the compiler server are left to finish in the background, and their results are 
+        /// discarded.
         /// </summary>
         public void Dispose()
         {
-            if (process == null)
-                return;
-
-            if (!process.HasExited)
+            lock (this)
             {
-                process.Kill();
-                process.WaitForExit();
-            }
+                disposed = true;
+                if (process == null)
+                    return;
+
+                if (!process.HasExited)
+                {
+                    process.Kill();
+                    process.WaitForExit();
+                }
 
-            process.Dispose();
+                process.Dispose();
+                process = null;
+            }
         }
     }
 
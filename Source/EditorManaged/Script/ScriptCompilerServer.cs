@@ -0,0 +1,484 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.IO.Pipes;
+using System.Reflection;
+using System.Text;
+using System.Threading;
+
+namespace bs.Editor
+{
+    /** @addtogroup Script
+     *  @{
+     */
+
+    /// <summary>
+    /// Communicates with a long-lived compiler process that is started once per editor session and survives assembly
+    /// reloads, avoiding the cost of starting a new runtime and compiler process on every script change. Each request
+    /// carries the full list of files to compile, so the server holds no state between requests. Every compilation runs in
+    /// its own application domain that is unloaded once it finishes, so referenced assemblies (e.g. the game assembly
+    /// referenced by the editor assembly) are loaded as they currently are on disk, and aren't kept locked.
+    /// </summary>
+    internal static class ScriptCompilerServer
+    {
+        /// <summary>Time to wait for a connection to an already running server, in milliseconds.</summary>
+        private const int ConnectTimeout = 250;
+
+        /// <summary>Time to wait for a newly started server to accept connections, in milliseconds.</summary>
+        private const int StartupTimeout = 10000;
+
+        /// <summary>Maximum time to wait for the server bootstrap executable to compile, in milliseconds.</summary>
+        private const int BootstrapTimeout = 60000;
+
+        private const string ServerFolder = "Internal/CompilerServer";
+        private const string ServerExecutable = "CompilerServer.exe";
+        private const string BootstrapSource =
+            "static class Program { static int Main(string[] args) { return bs.Editor.CompilerServerHost.Run(args); } }";
+
+        private static object lockObj = new object();
+        private static bool isDisabled;
+
+        private static string serverFolder;
+        private static ProcessStartInfo bootstrapStartInfo;
+        private static ProcessStartInfo serverStartInfo;
+
+        /// <summary>
+        /// Name of the pipe used for communicating with the server. Unique per editor process, so the server can be
+        /// reused after an assembly reload.
+        /// </summary>
+        private static string PipeName
+        {
+            get { return "bsCompilerServer-" + Process.GetCurrentProcess().Id; }
+        }
+
+        /// <summary>
+        /// Retrieves information from the editor required for starting the server. Must be called from the main thread
+        /// before <see cref="TryCompile"/>.
+        /// </summary>
+        internal static void Prepare()
+        {
+            lock (lockObj)
+            {
+                if (serverStartInfo != null)
+                    return;
+
+                string compilerPath = EditorApplication.CompilerPath;
+                serverFolder = Path.Combine(EditorApplication.ProjectPath, ServerFolder);
+
+                string editorAssembly = typeof(CompilerServerHost).Assembly.Location;
+                string serverPath = Path.Combine(serverFolder, ServerExecutable);
+
+                string[] bootstrapOptions = CompilerInstance.GetOptions(null,
+                    new string[] { Path.GetDirectoryName(editorAssembly) },
+                    new string[] { EditorApplication.EngineAssemblyName, Path.GetFileName(editorAssembly) },
+                    false, "exe", serverPath);
+
+                string bootstrapSourcePath = Path.Combine(serverFolder, "Program.cs");
+                bootstrapStartInfo = CompilerInstance.GetProcessStartInfo(bootstrapOptions,
+                    new string[] { bootstrapSourcePath });
+
+                string monoDir = Path.GetDirectoryName(compilerPath);
+                monoDir = Path.Combine(monoDir, "../");
+
+                serverStartInfo = new ProcessStartInfo();
+                serverStartInfo.Arguments = "\"" + serverPath + "\" \"" + monoDir + "\" \"" + PipeName + "\" " +
+                    Process.GetCurrentProcess().Id + " \"" + compilerPath + "\"";
+                serverStartInfo.CreateNoWindow = true;
+                serverStartInfo.FileName = EditorApplication.MonoExecPath;
+                serverStartInfo.UseShellExecute = false;
+                serverStartInfo.WorkingDirectory = EditorApplication.ProjectPath;
+            }
+        }
+
+        /// <summary>
+        /// Compiles the provided files using the compiler server, starting the server if not already running. Blocks
+        /// until compilation is done.
+        /// </summary>
+        /// <param name="files">Absolute paths to all the C# script files to compile.</param>
+        /// <param name="options">Compiler options, as returned by <see cref="CompilerInstance.GetOptions"/>.</param>
+        /// <param name="messages">List to which to append output lines reported by the compiler.</param>
+        /// <param name="succeeded">True if the compilation completed without errors.</param>
+        /// <returns>True if the compilation was performed by the server. If false the caller should compile the files
+        ///          using a separate compiler process instead.</returns>
+        internal static bool TryCompile(string[] files, string[] options, List<string> messages, out bool succeeded)
+        {
+            succeeded = false;
+
+            lock (lockObj)
+            {
+                if (isDisabled || serverStartInfo == null)
+                    return false;
+
+                NamedPipeClientStream pipe = Connect();
+                if (pipe == null)
+                {
+                    Debug.LogWarning("Unable to start the script compiler server. Falling back to a separate " +
+                        "compiler process for each compilation.");
+
+                    isDisabled = true;
+                    return false;
+                }
+
+                using (pipe)
+                {
+                    try
+                    {
+                        succeeded = SendRequest(pipe, files, options, messages);
+                        return true;
+                    }
+                    catch (IOException)
+                    {
+                        messages.Clear();
+                        return false;
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Sends a single compilation request over the provided connection, and waits for the result.
+        /// </summary>
+        /// <param name="pipe">Connection to the server.</param>
+        /// <param name="files">Absolute paths to all the C# script files to compile.</param>
+        /// <param name="options">Compiler options.</param>
+        /// <param name="messages">List to which to append output lines reported by the compiler.</param>
+        /// <returns>True if the server reported the compilation completed without errors.</returns>
+        private static bool SendRequest(NamedPipeClientStream pipe, string[] files, string[] options,
+            List<string> messages)
+        {
+            StreamWriter writer = new StreamWriter(pipe, new UTF8Encoding(false));
+            StreamReader reader = new StreamReader(pipe, new UTF8Encoding(false));
+
+            // Sorted so the compiler sees the files in the same order regardless of how the project was enumerated
+            List<string> sortedFiles = new List<string>(files);
+            sortedFiles.Sort(StringComparer.Ordinal);
+
+            writer.WriteLine("compile");
+            foreach (var option in options)
+                writer.WriteLine("option " + option);
+
+            foreach (var file in sortedFiles)
+                writer.WriteLine("file " + file);
+
+            writer.WriteLine("end");
+            writer.Flush();
+
+            while (true)
+            {
+                string line = reader.ReadLine();
+                if (line == null)
+                    throw new IOException("Compiler server closed the connection.");
+
+                if (line.StartsWith("message "))
+                    messages.Add(line.Substring(8));
+                else if (line.StartsWith("done "))
+                    return line == "done 1";
+            }
+        }
+
+        /// <summary>
+        /// Connects to the compiler server, starting it if it is not running.
+        /// </summary>
+        /// <returns>Open connection to the server, or null if the server could not be started.</returns>
+        private static NamedPipeClientStream Connect()
+        {
+            NamedPipeClientStream pipe = TryConnect(ConnectTimeout);
+            if (pipe != null)
+                return pipe;
+
+            if (!StartServer())
+                return null;
+
+            return TryConnect(StartupTimeout);
+        }
+
+        /// <summary>
+        /// Attempts to connect to the compiler server.
+        /// </summary>
+        /// <param name="timeout">Maximum time to wait for the connection, in milliseconds.</param>
+        /// <returns>Open connection to the server, or null if the connection could not be established.</returns>
+        private static NamedPipeClientStream TryConnect(int timeout)
+        {
+            NamedPipeClientStream pipe = new NamedPipeClientStream(".", PipeName, PipeDirection.InOut);
+
+            try
+            {
+                pipe.Connect(timeout);
+                return pipe;
+            }
+            catch (Exception)
+            {
+                pipe.Dispose();
+                return null;
+            }
+        }
+
+        /// <summary>
+        /// Compiles the server executable if needed, and starts the server process.
+        /// </summary>
+        /// <returns>True if the server process was started.</returns>
+        private static bool StartServer()
+        {
+            try
+            {
+                string editorAssembly = typeof(CompilerServerHost).Assembly.Location;
+                string serverPath = Path.Combine(serverFolder, ServerExecutable);
+                string localEditorAssembly = Path.Combine(serverFolder, Path.GetFileName(editorAssembly));
+
+                // The server executable only forwards to the code in the editor assembly, so it needs to be rebuilt
+                // only if the editor assembly changes
+                if (!File.Exists(serverPath) || !File.Exists(localEditorAssembly) ||
+                    File.GetLastWriteTimeUtc(localEditorAssembly) != File.GetLastWriteTimeUtc(editorAssembly))
+                {
+                    if (!Directory.Exists(serverFolder))
+                        Directory.CreateDirectory(serverFolder);
+
+                    File.WriteAllText(Path.Combine(serverFolder, "Program.cs"), BootstrapSource);
+
+                    using (Process bootstrap = Process.Start(bootstrapStartInfo))
+                    {
+                        // Drain the redirected output in the background so a full pipe can't stall the compiler, while
+                        // still allowing the wait below to time out
+                        bootstrap.ErrorDataReceived += (sender, args) => { };
+                        bootstrap.BeginErrorReadLine();
+
+                        if (!bootstrap.WaitForExit(BootstrapTimeout))
+                        {
+                            bootstrap.Kill();
+                            return false;
+                        }
+
+                        if (bootstrap.ExitCode != 0)
+                            return false;
+                    }
+
+                    // Copy the editor assembly next to the executable, so the runtime can find it
+                    File.Copy(editorAssembly, localEditorAssembly, true);
+                    File.SetLastWriteTimeUtc(localEditorAssembly, File.GetLastWriteTimeUtc(editorAssembly));
+                }
+
+                using (Process.Start(serverStartInfo)) { }
+                return true;
+            }
+            catch (Exception)
+            {
+                return false;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Implementation of the compiler server process. Runs outside of the editor, and must not use any engine or editor
+    /// functionality. Only meant to be used by the compiler server bootstrap executable.
+    /// </summary>
+    public static class CompilerServerHost
+    {
+        /// <summary>
+        /// Runs the server, accepting compilation requests until the editor process exits.
+        /// </summary>
+        /// <param name="args">Name of the pipe to listen on, identifier of the editor process and path to the compiler
+        ///                    assembly.</param>
+        /// <returns>Exit code of the server process.</returns>
+        public static int Run(string[] args)
+        {
+            if (args.Length < 3)
+                return 1;
+
+            string pipeName = args[0];
+            int editorProcessId;
+            if (!int.TryParse(args[1], out editorProcessId))
+                return 1;
+
+            string compilerPath = args[2];
+            if (!File.Exists(compilerPath))
+                return 2;
+
+            Thread watchThread = new Thread(() => WatchEditorProcess(editorProcessId));
+            watchThread.IsBackground = true;
+            watchThread.Start();
+
+            while (true)
+            {
+                NamedPipeServerStream pipe;
+                try
+                {
+                    pipe = new NamedPipeServerStream(pipeName, PipeDirection.InOut, 1);
+                }
+                catch (IOException)
+                {
+                    // Another server instance is already serving this editor
+                    return 0;
+                }
+
+                using (pipe)
+                {
+                    try
+                    {
+                        pipe.WaitForConnection();
+                        HandleRequest(pipe, compilerPath);
+                    }
+                    catch (IOException)
+                    {
+                        // Editor disconnected mid-request (e.g. during an assembly reload), wait for the next one
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Reads a single compilation request from the connection, compiles the assembly and reports the results.
+        /// </summary>
+        /// <param name="pipe">Connection to the editor.</param>
+        /// <param name="compilerPath">Absolute path to the compiler assembly.</param>
+        private static void HandleRequest(NamedPipeServerStream pipe, string compilerPath)
+        {
+            StreamReader reader = new StreamReader(pipe, new UTF8Encoding(false));
+            StreamWriter writer = new StreamWriter(pipe, new UTF8Encoding(false));
+
+            string header = reader.ReadLine();
+            if (header != "compile")
+                return;
+
+            List<string> options = new List<string>();
+            List<string> files = new List<string>();
+
+            string line;
+            while ((line = reader.ReadLine()) != null && line != "end")
+            {
+                if (line.StartsWith("option "))
+                    options.Add(line.Substring(7));
+                else if (line.StartsWith("file "))
+                    files.Add(line.Substring(5));
+            }
+
+            // Incomplete request, ignore it
+            if (line == null)
+                return;
+
+            List<string> arguments = new List<string>(options);
+            arguments.AddRange(files);
+
+            // The compiler loads every referenced assembly into the domain it runs in, and loaded assemblies can't be
+            // unloaded individually, so a fresh domain is used for each compilation
+            AppDomainSetup domainSetup = new AppDomainSetup();
+            domainSetup.ApplicationBase = AppDomain.CurrentDomain.BaseDirectory;
+
+            AppDomain domain = AppDomain.CreateDomain("ScriptCompilation", null, domainSetup);
+
+            string output;
+            bool succeeded;
+            try
+            {
+                Type workerType = typeof(CompileWorker);
+                CompileWorker worker = (CompileWorker)domain.CreateInstanceAndUnwrap(workerType.Assembly.FullName,
+                    workerType.FullName);
+
+                succeeded = worker.Compile(compilerPath, arguments.ToArray(), out output);
+            }
+            finally
+            {
+                AppDomain.Unload(domain);
+            }
+
+            using (StringReader outputReader = new StringReader(output))
+            {
+                string outputLine;
+                while ((outputLine = outputReader.ReadLine()) != null)
+                    writer.WriteLine("message " + outputLine);
+            }
+
+            writer.WriteLine(succeeded ? "done 1" : "done 0");
+            writer.Flush();
+
+            WaitForDisconnect(reader);
+        }
+
+        /// <summary>
+        /// Runs the compiler within the application domain it was created in.
+        /// </summary>
+        public class CompileWorker : MarshalByRefObject
+        {
+            /// <summary>
+            /// Loads the compiler and compiles an assembly.
+            /// </summary>
+            /// <param name="compilerPath">Absolute path to the compiler assembly.</param>
+            /// <param name="arguments">Compiler options, followed by the files to compile.</param>
+            /// <param name="output">Output lines reported by the compiler.</param>
+            /// <returns>True if the compilation completed without errors.</returns>
+            public bool Compile(string compilerPath, string[] arguments, out string output)
+            {
+                StringWriter writer = new StringWriter();
+                bool succeeded = false;
+
+                try
+                {
+                    Assembly compiler = Assembly.LoadFrom(compilerPath);
+                    Type entryPoint = compiler.GetType("Mono.CSharp.CompilerCallableEntryPoint");
+                    MethodInfo invokeCompiler = null;
+                    if (entryPoint != null)
+                    {
+                        invokeCompiler = entryPoint.GetMethod("InvokeCompiler", BindingFlags.Public | BindingFlags.Static,
+                            null, new Type[] { typeof(string[]), typeof(TextWriter) }, null);
+                    }
+
+                    if (invokeCompiler == null)
+                        writer.WriteLine("error: Unable to find the compiler entry point in " + compilerPath);
+                    else
+                        succeeded = (bool)invokeCompiler.Invoke(null, new object[] { arguments, writer });
+                }
+                catch (TargetInvocationException e)
+                {
+                    writer.WriteLine("error: Internal compiler error: " + e.InnerException.Message);
+                }
+                catch (Exception e)
+                {
+                    writer.WriteLine("error: Unable to run the compiler: " + e.Message);
+                }
+
+                output = writer.ToString();
+                return succeeded;
+            }
+        }
+
+        /// <summary>
+        /// Waits until the editor closes the connection. Closing the connection from the server side while the editor
+        /// is still reading can discard unread data on some platforms.
+        /// </summary>
+        /// <param name="reader">Reader for the connection.</param>
+        private static void WaitForDisconnect(StreamReader reader)
+        {
+            while (reader.ReadLine() != null)
+            { }
+        }
+
+        /// <summary>
+        /// Periodically checks if the editor process is still alive, and exits the server if it isn't.
+        /// </summary>
+        /// <param name="editorProcessId">Identifier of the editor process.</param>
+        private static void WatchEditorProcess(int editorProcessId)
+        {
+            while (true)
+            {
+                try
+                {
+                    using (Process editorProcess = Process.GetProcessById(editorProcessId))
+                    {
+                        if (editorProcess.HasExited)
+                            Environment.Exit(0);
+                    }
+                }
+                catch (ArgumentException)
+                {
+                    Environment.Exit(0);
+                }
+
+                Thread.Sleep(1000);
+            }
+        }
+    }
+
+    /** @} */
+}
@@ -19,6 +19,7 @@ namespace bs.Editor
 
         private KeyFrame[] keyFrames;
         private TangentMode[] tangentModes;
+        private int version;
 
         /// <summary>
         /// Returns tangent modes for each keyframe. Array is guaranteed to be the same size as <see cref="KeyFrames"/>.
@@ -46,6 +47,15 @@ namespace bs.Editor
             get { return native; }
         }
 
+        /// <summary>
+        /// Incremented every time changes are applied to the curve through <see cref="Apply"/>. Allows users of the curve
+        /// to cheaply detect if it changed.
+        /// </summary>
+        internal int Version
+        {
+            get { return version; }
+        }
+
         /// <summary>
         /// Creates a new animation curve with zero keyframes.
         /// </summary>
@@ -310,6 +320,7 @@ namespace bs.Editor
             UpdateTangents();
 
             native = new AnimationCurve(keyFrames);
+            version++;
         }
 
         /// <summary>
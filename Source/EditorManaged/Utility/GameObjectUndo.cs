@@ -60,7 +60,13 @@ namespace bs.Editor
                     return;
 
                 SerializedDiff newToOld = SerializedDiff.Create(newState, orgState);
-                UndoRedo.Global.RegisterCommand(new RecordComponentUndo(obj, path, oldToNew, newToOld));
+                RecordComponentUndo command = new RecordComponentUndo(obj, path, oldToNew, newToOld);
+
+                // Changes made later during the same interaction are merged into this command, and require both states
+                if (UndoRedo.Global.IsMergeGroupActive)
+                    command.SetMergeStates(orgState, newState);
+
+                UndoRedo.Global.RegisterCommand(command);
             }
         }
 
@@ -410,6 +416,36 @@ namespace bs.Editor
             return diff;
         }
 
+        /// <summary>
+        /// Combines two diffs into a single diff that has the same effect as applying <paramref name="first"/> followed by
+        /// <paramref name="second"/>.
+        /// </summary>
+        /// <param name="first">Diff applied first.</param>
+        /// <param name="second">Diff applied after <paramref name="first"/>.</param>
+        /// <returns>Combined diff.</returns>
+        internal static SceneObjectDiff Combine(SceneObjectDiff first, SceneObjectDiff second)
+        {
+            SceneObjectDiff diff = first;
+            diff.flags |= second.flags;
+
+            if (second.flags.HasFlag(SceneObjectDiffFlags.Name))
+                diff.state.name = second.state.name;
+
+            if (second.flags.HasFlag(SceneObjectDiffFlags.Position))
+                diff.state.position = second.state.position;
+
+            if (second.flags.HasFlag(SceneObjectDiffFlags.Rotation))
+                diff.state.rotation = second.state.rotation;
+
+            if (second.flags.HasFlag(SceneObjectDiffFlags.Scale))
+                diff.state.scale = second.state.scale;
+
+            if (second.flags.HasFlag(SceneObjectDiffFlags.Active))
+                diff.state.active = second.state.active;
+
+            return diff;
+        }
+
         /// <summary>
         /// Applies the diff to an actual scene object.
         /// </summary>
@@ -525,6 +561,36 @@ namespace bs.Editor
             RefreshInspector();
         }
 
+        /// <inheritdoc/>
+        protected override bool Merge(UndoableCommand next)
+        {
+            RecordSceneObjectHeaderUndo other = next as RecordSceneObjectHeaderUndo;
+            if (other == null || headers == null || other.headers == null || other.fieldPath != fieldPath)
+                return false;
+
+            int[] indices = new int[other.headers.Count];
+            for (int i = 0; i < other.headers.Count; i++)
+            {
+                indices[i] = headers.FindIndex(x => x.obj == other.headers[i].obj);
+                if (indices[i] == -1)
+                    return false;
+            }
+
+            // Diffs are combined so the "before" state of this command and the "after" state of the next one are kept
+            for (int i = 0; i < other.headers.Count; i++)
+            {
+                SceneObjectHeaderUndo header = headers[indices[i]];
+                SceneObjectHeaderUndo otherHeader = other.headers[i];
+
+                header.oldToNew = SceneObjectDiff.Combine(header.oldToNew, otherHeader.oldToNew);
+                header.newToOld = SceneObjectDiff.Combine(otherHeader.newToOld, header.newToOld);
+
+                headers[indices[i]] = header;
+            }
+
+            return true;
+        }
+
         /// <summary>
         /// Selects the component's scene object and focuses on the specific field in the inspector, if the inspector
         /// window is open.
@@ -714,6 +780,9 @@ namespace bs.Editor
         private SerializedDiff newToOld;
         private SerializedDiff oldToNew;
 
+        private SerializedObject orgState;
+        private SerializedObject newState;
+
         private RecordComponentUndo() { }
 
         /// <summary>
@@ -738,6 +807,35 @@ namespace bs.Editor
             this.newToOld = newToOld;
         }
 
+        /// <summary>
+        /// Provides the complete states the diffs of this command were generated from. Required if the command is to be
+        /// merged with commands registered after it. See <see cref="UndoRedo.BeginMergeGroup"/>.
+        /// </summary>
+        /// <param name="orgState">State of the component before the change.</param>
+        /// <param name="newState">State of the component after the change.</param>
+        internal void SetMergeStates(SerializedObject orgState, SerializedObject newState)
+        {
+            this.orgState = orgState;
+            this.newState = newState;
+        }
+
+        /// <inheritdoc/>
+        protected override bool Merge(UndoableCommand next)
+        {
+            RecordComponentUndo other = next as RecordComponentUndo;
+            if (other == null || orgState == null || other.newState == null)
+                return false;
+
+            if (other.obj != obj || other.fieldPath != fieldPath)
+                return false;
+
+            oldToNew = SerializedDiff.Create(orgState, other.newState);
+            newToOld = SerializedDiff.Create(other.newState, orgState);
+            newState = other.newState;
+
+            return true;
+        }
+
         /// <inheritdoc/>
         protected override void Commit()
         {
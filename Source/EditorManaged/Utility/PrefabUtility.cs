@@ -45,31 +45,25 @@ namespace bs.Editor
             if (prefabInstanceRoot == null)
                 return;
 
-            if (refreshScene)
-            {
-                SceneObject root = Scene.Root;
-                if (root != null)
-                    Internal_RecordPrefabDiff(root.GetCachedPtr());
-            }
-
             UUID prefabUUID = GetPrefabUUID(prefabInstanceRoot);
             string prefabPath = ProjectLibrary.GetPath(prefabUUID);
             Prefab prefab = ProjectLibrary.Load<Prefab>(prefabPath);
-            if (prefab != null)
-            {
-                IntPtr soPtr = prefabInstanceRoot.GetCachedPtr();
-                IntPtr prefabPtr = prefab.GetCachedPtr();
+            if (prefab == null)
+                return;
+
+            IntPtr soPtr = prefabInstanceRoot.GetCachedPtr();
+            IntPtr prefabPtr = prefab.GetCachedPtr();
+
+            // Only instances of the modified prefab need to be refreshed, which are looked up through the native
+            // prefab instance index instead of walking the entire scene
+            if (refreshScene)
+                Internal_RecordPrefabInstanceDiffs(prefabPtr, soPtr);
 
-                Internal_ApplyPrefab(soPtr, prefabPtr);
-                ProjectLibrary.Save(prefab);
-            }
+            Internal_ApplyPrefab(soPtr, prefabPtr);
+            ProjectLibrary.Save(prefab);
 
             if (refreshScene)
-            {
-                SceneObject root = Scene.Root;
-                if (root != null)
-                    Internal_UpdateFromPrefab(root.GetCachedPtr());
-            }
+                Internal_UpdatePrefabInstances(prefabPtr);
         }
 
         /// <summary>
@@ -156,6 +150,12 @@ namespace bs.Editor
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_RecordPrefabDiff(IntPtr soPtr);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_RecordPrefabInstanceDiffs(IntPtr prefabPtr, IntPtr excludePtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_UpdatePrefabInstances(IntPtr prefabPtr);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_RevertPrefab(IntPtr soPtr);
 
@@ -109,6 +109,38 @@ namespace bs.Editor
             Internal_PopCommand(mCachedPtr, id);
         }
 
+        /// <summary>
+        /// Checks is a merge group currently active. See <see cref="BeginMergeGroup"/>.
+        /// </summary>
+        public bool IsMergeGroupActive
+        {
+            get { return Internal_IsMergeGroupActive(mCachedPtr); }
+        }
+
+        /// <summary>
+        /// Starts a new merge group. Consecutive commands registered while the group is active that act on the same target
+        /// and field get merged into a single undo/redo entry, keeping the state before the first command and the state
+        /// after the last one. Use this for continuous interactions (e.g. dragging a field or a handle) that register a
+        /// command for every change. Calling this while a group is already active replaces the previous group. See
+        /// <see cref="UndoableCommand.Merge"/>.
+        /// </summary>
+        /// <returns>Identifier of the new group, to be passed to <see cref="EndMergeGroup"/>.</returns>
+        public int BeginMergeGroup()
+        {
+            return Internal_BeginMergeGroup(mCachedPtr);
+        }
+
+        /// <summary>
+        /// Ends the merge group started with <see cref="BeginMergeGroup"/>. Does nothing if the group was already replaced
+        /// by a newer one, so the owner of an older group (e.g. a field losing input focus after another one gained it)
+        /// can't end a group it didn't start.
+        /// </summary>
+        /// <param name="id">Identifier returned by <see cref="BeginMergeGroup"/>.</param>
+        public void EndMergeGroup(int id)
+        {
+            Internal_EndMergeGroup(mCachedPtr, id);
+        }
+
         /// <summary>
         /// Clears all undo/redo commands from the stack.
         /// </summary>
@@ -117,6 +149,15 @@ namespace bs.Editor
             Internal_Clear(mCachedPtr);
         }
 
+        /// <summary>
+        /// Serializes the scene objects held by delete commands on the stack, so they can still be restored after the
+        /// scene is unloaded. Must be called before the scene is cleared or replaced.
+        /// </summary>
+        public void SerializeDeletedObjects()
+        {
+            Internal_SerializeDeletedObjects(mCachedPtr);
+        }
+
         /// <summary>
         /// Creates new scene object(s) by cloning existing objects. Undo operation recorded in global undo/redo stack.
         /// </summary>
@@ -292,12 +333,24 @@ namespace bs.Editor
         [MethodImpl(MethodImplOptions.InternalCall)]
         internal static extern void Internal_Clear(IntPtr thisPtr);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_SerializeDeletedObjects(IntPtr thisPtr);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         internal static extern void Internal_PopCommand(IntPtr thisPtr, int id);
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         internal static extern int Internal_GetTopCommandId(IntPtr thisPtr);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern int Internal_BeginMergeGroup(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern void Internal_EndMergeGroup(IntPtr thisPtr, int id);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal static extern bool Internal_IsMergeGroupActive(IntPtr thisPtr);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         internal static extern SceneObject Internal_CloneSO(IntPtr soPtr, string description);
 
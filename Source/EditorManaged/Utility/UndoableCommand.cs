@@ -26,6 +26,20 @@ namespace bs.Editor
         /// </summary>
         protected abstract void Revert();
 
+        /// <summary>
+        /// Attempts to merge a command that was registered right after this one into this command. Only called for
+        /// commands registered within the same merge group (see <see cref="UndoRedo.BeginMergeGroup"/>). Commands should
+        /// only accept the merge if <paramref name="next"/> acts on the same target and field as this command. When merged
+        /// this command should keep its own original state, and take over the latest state from
+        /// <paramref name="next"/>.
+        /// </summary>
+        /// <param name="next">Command registered after this one. Already committed.</param>
+        /// <returns>True if the command was merged, in which case <paramref name="next"/> will not be registered.</returns>
+        protected virtual bool Merge(UndoableCommand next)
+        {
+            return false;
+        }
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_CreateInstance(UndoableCommand instance);
     }
@@ -82,6 +82,55 @@ namespace bs.Editor
         public EditorAnimClipTangents tangents;
     }
 
+    /// <summary>
+    /// Type of animation clip curves generated from the curves of a single animated field.
+    /// </summary>
+    internal enum AppliedFieldType
+    {
+        Position, Rotation, Scale, Generic
+    }
+
+    /// <summary>
+    /// Animation clip curves generated from the editor curves of a single animated field. Cached by 
+    /// <see cref="EditorAnimClipInfo"/> so that unchanged fields don't need to be converted every time the clip is 
+    /// updated.
+    /// </summary>
+    internal class AppliedFieldCurves
+    {
+        public AppliedFieldType type;
+
+        public EdAnimationCurve[] sources;
+        public int[] versions;
+
+        public NamedVector3Curve vector3Curve;
+        public NamedQuaternionCurve quaternionCurve;
+        public EditorNamedVector3Curve eulerCurve;
+        public EditorVector3CurveTangents vector3Tangents;
+
+        public NamedFloatCurve[] floatCurves;
+        public EditorFloatCurveTangents[] floatTangents;
+
+        /// <summary>
+        /// Checks if the curves were generated from the current state of the provided editor curves.
+        /// </summary>
+        /// <param name="fieldCurves">Editor curves of the field.</param>
+        /// <returns>True if the editor curves haven't changed since the curves were generated.</returns>
+        public bool IsUpToDate(FieldAnimCurves fieldCurves)
+        {
+            if (fieldCurves.curveInfos.Length != sources.Length)
+                return false;
+
+            for (int i = 0; i < sources.Length; i++)
+            {
+                EdAnimationCurve curve = fieldCurves.curveInfos[i].curve;
+                if (curve != sources[i] || curve.Version != versions[i])
+                    return false;
+            }
+
+            return true;
+        }
+    }
+
     /// <summary>
     /// Stores animation clip data for clips that are currently being edited.
     /// </summary>
@@ -93,6 +142,9 @@ namespace bs.Editor
         public Dictionary<string, FieldAnimCurves> curves = new Dictionary<string, FieldAnimCurves>();
         public AnimationEvent[] events = new AnimationEvent[0];
 
+        private AnimationClip appliedClip;
+        private Dictionary<string, AppliedFieldCurves> appliedFields;
+
         /// <summary>
         /// Loads curve and event information from the provided clip, and creates a new instance of this object containing
         /// the required data for editing the source clip in the animation editor.
@@ -421,152 +473,222 @@ namespace bs.Editor
             List<EditorFloatCurveTangents> floatTangents = new List<EditorFloatCurveTangents>();
             List<EditorNamedVector3Curve> eulerRotationCurves = new List<EditorNamedVector3Curve>();
 
+            // Only rebuild native curves for fields whose editor curves changed since the last apply
+            bool curvesChanged = appliedClip != clip || appliedFields == null || appliedFields.Count != curves.Count;
+
+            Dictionary<string, AppliedFieldCurves> newAppliedFields = new Dictionary<string, AppliedFieldCurves>();
             foreach (var kvp in curves)
             {
-                string[] pathEntries = kvp.Key.Split('/');
-                if (pathEntries.Length == 0)
+                AppliedFieldCurves field;
+                if (appliedFields == null || !appliedFields.TryGetValue(kvp.Key, out field) || 
+                    !field.IsUpToDate(kvp.Value))
+                {
+                    field = BuildFieldCurves(kvp.Key, kvp.Value);
+                    curvesChanged = true;
+                }
+
+                if (field == null)
                     continue;
 
-                string lastEntry = pathEntries[pathEntries.Length - 1];
+                newAppliedFields[kvp.Key] = field;
 
-                if (lastEntry == "Position" || lastEntry == "Rotation" || lastEntry == "Scale")
+                switch (field.type)
                 {
-                    StringBuilder sb = new StringBuilder();
-                    for (int i = 0; i < pathEntries.Length - 2; i++)
-                        sb.Append(pathEntries[i] + "/");
+                    case AppliedFieldType.Position:
+                        positionCurves.Add(field.vector3Curve);
+                        positionTangents.Add(field.vector3Tangents);
+                        break;
+                    case AppliedFieldType.Rotation:
+                        rotationCurves.Add(field.quaternionCurve);
+                        eulerRotationCurves.Add(field.eulerCurve);
+                        rotationTangents.Add(field.vector3Tangents);
+                        break;
+                    case AppliedFieldType.Scale:
+                        scaleCurves.Add(field.vector3Curve);
+                        scaleTangents.Add(field.vector3Tangents);
+                        break;
+                    case AppliedFieldType.Generic:
+                        floatCurves.AddRange(field.floatCurves);
+                        floatTangents.AddRange(field.floatTangents);
+                        break;
+                }
+            }
 
-                    if (pathEntries.Length > 1)
-                        sb.Append(pathEntries[pathEntries.Length - 2]);
+            appliedFields = newAppliedFields;
+            appliedClip = clip;
 
-                    string curvePath = sb.ToString();
+            if (curvesChanged)
+            {
+                AnimationCurves newClipCurves = new AnimationCurves();
+                newClipCurves.Position = positionCurves.ToArray();
+                newClipCurves.Rotation = rotationCurves.ToArray();
+                newClipCurves.Scale = scaleCurves.ToArray();
+                newClipCurves.Generic = floatCurves.ToArray();
 
-                    NamedVector3Curve curve = new NamedVector3Curve();
-                    curve.name = curvePath;
-                    curve.curve = AnimationUtility.CombineCurve3D(new[]
-                    {
-                        new AnimationCurve(kvp.Value.curveInfos[0].curve.KeyFrames),
-                        new AnimationCurve(kvp.Value.curveInfos[1].curve.KeyFrames),
-                        new AnimationCurve(kvp.Value.curveInfos[2].curve.KeyFrames)
-                    });
-
-                    EditorVector3CurveTangents curveTangents = new EditorVector3CurveTangents();
-                    curveTangents.name = curvePath;
-                    curveTangents.tangentsX = kvp.Value.curveInfos[0].curve.TangentModes;
-                    curveTangents.tangentsY = kvp.Value.curveInfos[1].curve.TangentModes;
-                    curveTangents.tangentsZ = kvp.Value.curveInfos[2].curve.TangentModes;
-
-                    if (lastEntry == "Position")
-                    {
-                        positionCurves.Add(curve);
-                        positionTangents.Add(curveTangents);
-                    }
-                    else if (lastEntry == "Rotation")
-                    {
-                        NamedQuaternionCurve quatCurve = new NamedQuaternionCurve();
-                        quatCurve.name = curve.name;
-                        quatCurve.curve = AnimationUtility.EulerToQuaternionCurve(curve.curve);
+                clip.Curves = newClipCurves;
+            }
 
-                        EditorNamedVector3Curve edEulerCurve = new EditorNamedVector3Curve();
-                        edEulerCurve.name = curve.name;
-                        edEulerCurve.keyFrames = curve.curve.KeyFrames;
+            clip.Events = events;
+            clip.SampleRate = sampleRate;
 
-                        rotationCurves.Add(quatCurve);
-                        eulerRotationCurves.Add(edEulerCurve);
-                        rotationTangents.Add(curveTangents);
-                    }
-                    else if (lastEntry == "Scale")
-                    {
-                        scaleCurves.Add(curve);
-                        scaleTangents.Add(curveTangents);
-                    }
+            editorData = new EditorAnimClipData();
+            editorData.tangents = new EditorAnimClipTangents();
+            editorData.tangents.positionCurves = positionTangents.ToArray();
+            editorData.tangents.rotationCurves = rotationTangents.ToArray();
+            editorData.tangents.scaleCurves = scaleTangents.ToArray();
+            editorData.tangents.floatCurves = floatTangents.ToArray();
+            editorData.eulerCurves = eulerRotationCurves.ToArray();
+        }
+
+        /// <summary>
+        /// Converts the editor curves of a single field into curves that can be assigned to an animation clip.
+        /// </summary>
+        /// <param name="fieldPath">Path to the field the curves belong to.</param>
+        /// <param name="fieldCurves">Editor curves for the field.</param>
+        /// <returns>Converted curves, or null if the field path is not valid.</returns>
+        private static AppliedFieldCurves BuildFieldCurves(string fieldPath, FieldAnimCurves fieldCurves)
+        {
+            string[] pathEntries = fieldPath.Split('/');
+            if (pathEntries.Length == 0)
+                return null;
+
+            AppliedFieldCurves output = new AppliedFieldCurves();
+            output.sources = new EdAnimationCurve[fieldCurves.curveInfos.Length];
+            output.versions = new int[fieldCurves.curveInfos.Length];
+
+            for (int i = 0; i < fieldCurves.curveInfos.Length; i++)
+            {
+                output.sources[i] = fieldCurves.curveInfos[i].curve;
+                output.versions[i] = fieldCurves.curveInfos[i].curve.Version;
+            }
+
+            string lastEntry = pathEntries[pathEntries.Length - 1];
+
+            if (lastEntry == "Position" || lastEntry == "Rotation" || lastEntry == "Scale")
+            {
+                StringBuilder sb = new StringBuilder();
+                for (int i = 0; i < pathEntries.Length - 2; i++)
+                    sb.Append(pathEntries[i] + "/");
+
+                if (pathEntries.Length > 1)
+                    sb.Append(pathEntries[pathEntries.Length - 2]);
+
+                string curvePath = sb.ToString();
+
+                NamedVector3Curve curve = new NamedVector3Curve();
+                curve.name = curvePath;
+                curve.curve = AnimationUtility.CombineCurve3D(new[]
+                {
+                    fieldCurves.curveInfos[0].curve.Normal,
+                    fieldCurves.curveInfos[1].curve.Normal,
+                    fieldCurves.curveInfos[2].curve.Normal
+                });
+
+                EditorVector3CurveTangents curveTangents = new EditorVector3CurveTangents();
+                curveTangents.name = curvePath;
+                curveTangents.tangentsX = fieldCurves.curveInfos[0].curve.TangentModes;
+                curveTangents.tangentsY = fieldCurves.curveInfos[1].curve.TangentModes;
+                curveTangents.tangentsZ = fieldCurves.curveInfos[2].curve.TangentModes;
+
+                output.vector3Curve = curve;
+                output.vector3Tangents = curveTangents;
+
+                if (lastEntry == "Position")
+                    output.type = AppliedFieldType.Position;
+                else if (lastEntry == "Rotation")
+                {
+                    NamedQuaternionCurve quatCurve = new NamedQuaternionCurve();
+                    quatCurve.name = curve.name;
+                    quatCurve.curve = AnimationUtility.EulerToQuaternionCurve(curve.curve);
+
+                    EditorNamedVector3Curve edEulerCurve = new EditorNamedVector3Curve();
+                    edEulerCurve.name = curve.name;
+                    edEulerCurve.keyFrames = curve.curve.KeyFrames;
+
+                    output.type = AppliedFieldType.Rotation;
+                    output.quaternionCurve = quatCurve;
+                    output.eulerCurve = edEulerCurve;
                 }
                 else
-                {
-                    Action<int, string, string, AnimationCurveFlags> addCurve = (idx, path, subPath, flags) =>
-                    {
-                        string fullPath = path + subPath;
+                    output.type = AppliedFieldType.Scale;
 
-                        NamedFloatCurve curve = new NamedFloatCurve(fullPath,
-                            new AnimationCurve(kvp.Value.curveInfos[idx].curve.KeyFrames));
-                        curve.flags = flags;
+                return output;
+            }
 
-                        EditorFloatCurveTangents curveTangents = new EditorFloatCurveTangents();
-                        curveTangents.name = fullPath;
-                        curveTangents.tangents = kvp.Value.curveInfos[idx].curve.TangentModes;
+            List<NamedFloatCurve> floatCurves = new List<NamedFloatCurve>();
+            List<EditorFloatCurveTangents> floatTangents = new List<EditorFloatCurveTangents>();
 
-                        floatCurves.Add(curve);
-                        floatTangents.Add(curveTangents);
-                    };
+            Action<int, string, string, AnimationCurveFlags> addCurve = (idx, path, subPath, flags) =>
+            {
+                string fullPath = path + subPath;
 
-                    switch (kvp.Value.type)
-                    {
-                        case SerializableProperty.FieldType.Vector2:
-                            addCurve(0, kvp.Key, ".x", 0);
-                            addCurve(1, kvp.Key, ".y", 0);
-                            break;
-                        case SerializableProperty.FieldType.Vector3:
-                            addCurve(0, kvp.Key, ".x", 0);
-                            addCurve(1, kvp.Key, ".y", 0);
-                            addCurve(2, kvp.Key, ".z", 0);
-                            break;
-                        case SerializableProperty.FieldType.Vector4:
-                            addCurve(0, kvp.Key, ".x", 0);
-                            addCurve(1, kvp.Key, ".y", 0);
-                            addCurve(2, kvp.Key, ".z", 0);
-                            addCurve(3, kvp.Key, ".w", 0);
-                            break;
-                        case SerializableProperty.FieldType.Color:
-                            addCurve(0, kvp.Key, ".r", 0);
-                            addCurve(1, kvp.Key, ".g", 0);
-                            addCurve(2, kvp.Key, ".b", 0);
-                            addCurve(3, kvp.Key, ".a", 0);
-                            break;
-                        case SerializableProperty.FieldType.Bool:
-                        case SerializableProperty.FieldType.Int:
-                        case SerializableProperty.FieldType.Float:
-                        {
-                            AnimationCurveFlags flags = 0;
-                            string path = kvp.Key;
+                // Editor curve keeps an up to date native curve, no need to create a new one
+                NamedFloatCurve curve = new NamedFloatCurve(fullPath, fieldCurves.curveInfos[idx].curve.Normal);
+                curve.flags = flags;
 
-                            if (IsMorphShapeCurve(kvp.Key))
-                            {
-                                string trimmedPath = path.Trim('/');
-                                string[] entries = trimmedPath.Split('/');
+                EditorFloatCurveTangents curveTangents = new EditorFloatCurveTangents();
+                curveTangents.name = fullPath;
+                curveTangents.tangents = fieldCurves.curveInfos[idx].curve.TangentModes;
 
-                                bool isWeight = entries[entries.Length - 2] == "Weight";
+                floatCurves.Add(curve);
+                floatTangents.Add(curveTangents);
+            };
 
-                                if (isWeight)
-                                    flags = AnimationCurveFlags.MorphWeight;
-                                else
-                                    flags = AnimationCurveFlags.MorphFrame;
+            switch (fieldCurves.type)
+            {
+                case SerializableProperty.FieldType.Vector2:
+                    addCurve(0, fieldPath, ".x", 0);
+                    addCurve(1, fieldPath, ".y", 0);
+                    break;
+                case SerializableProperty.FieldType.Vector3:
+                    addCurve(0, fieldPath, ".x", 0);
+                    addCurve(1, fieldPath, ".y", 0);
+                    addCurve(2, fieldPath, ".z", 0);
+                    break;
+                case SerializableProperty.FieldType.Vector4:
+                    addCurve(0, fieldPath, ".x", 0);
+                    addCurve(1, fieldPath, ".y", 0);
+                    addCurve(2, fieldPath, ".z", 0);
+                    addCurve(3, fieldPath, ".w", 0);
+                    break;
+                case SerializableProperty.FieldType.Color:
+                    addCurve(0, fieldPath, ".r", 0);
+                    addCurve(1, fieldPath, ".g", 0);
+                    addCurve(2, fieldPath, ".b", 0);
+                    addCurve(3, fieldPath, ".a", 0);
+                    break;
+                case SerializableProperty.FieldType.Bool:
+                case SerializableProperty.FieldType.Int:
+                case SerializableProperty.FieldType.Float:
+                {
+                    AnimationCurveFlags flags = 0;
+                    string path = fieldPath;
 
-                                path = entries[entries.Length - 1];
-                            }
+                    if (IsMorphShapeCurve(fieldPath))
+                    {
+                        string trimmedPath = path.Trim('/');
+                        string[] entries = trimmedPath.Split('/');
 
-                            addCurve(0, path, "", flags);
-                        }
-                            break;
+                        bool isWeight = entries[entries.Length - 2] == "Weight";
+
+                        if (isWeight)
+                            flags = AnimationCurveFlags.MorphWeight;
+                        else
+                            flags = AnimationCurveFlags.MorphFrame;
+
+                        path = entries[entries.Length - 1];
                     }
+
+                    addCurve(0, path, "", flags);
                 }
+                    break;
             }
 
-            AnimationCurves newClipCurves = new AnimationCurves();
-            newClipCurves.Position = positionCurves.ToArray();
-            newClipCurves.Rotation = rotationCurves.ToArray();
-            newClipCurves.Scale = scaleCurves.ToArray();
-            newClipCurves.Generic = floatCurves.ToArray();
-
-            clip.Curves = newClipCurves;
-            clip.Events = events;
-            clip.SampleRate = sampleRate;
+            output.type = AppliedFieldType.Generic;
+            output.floatCurves = floatCurves.ToArray();
+            output.floatTangents = floatTangents.ToArray();
 
-            editorData = new EditorAnimClipData();
-            editorData.tangents = new EditorAnimClipTangents();
-            editorData.tangents.positionCurves = positionTangents.ToArray();
-            editorData.tangents.rotationCurves = rotationTangents.ToArray();
-            editorData.tangents.scaleCurves = scaleTangents.ToArray();
-            editorData.tangents.floatCurves = floatTangents.ToArray();
-            editorData.eulerCurves = eulerRotationCurves.ToArray();
+            return output;
         }
 
         /// <summary>
@@ -552,6 +552,7 @@ namespace bs.Editor
 
                 selectedSO = so;
                 selectedFields.Clear();
+                ClearPropertyBindings();
                 clipInfo = null;
                 UndoRedo.Clear();
 
@@ -741,6 +742,8 @@ namespace bs.Editor
 
         private State state = State.Empty;
         private bool delayRecord = false;
+        private Dictionary<string, SerializableProperty> propertyBindings = new Dictionary<string, SerializableProperty>();
+        private int propertyBindingsCommandId;
 
         /// <summary>
         /// Transitions the window into a different state. Caller must validate state transitions.
@@ -748,6 +751,9 @@ namespace bs.Editor
         /// <param name="state">New state to transition to.</param>
         private void SwitchState(State state)
         {
+            // Components could have been added or removed while not recording
+            ClearPropertyBindings();
+
             switch (this.state)
             {
                 case State.Normal:
@@ -909,9 +915,7 @@ namespace bs.Editor
                 if (!clipInfo.curves.TryGetValue(KVP.Key, out curves))
                     continue;
 
-                string suffix;
-                SerializableProperty property = Animation.FindProperty(selectedSO, KVP.Key, out suffix);
-
+                SerializableProperty property = GetPropertyBinding(KVP.Key);
                 if (property == null)
                     continue;
 
@@ -956,9 +960,7 @@ namespace bs.Editor
             if (!clipInfo.curves.TryGetValue(path, out curves))
                 return false;
 
-            string suffix;
-            SerializableProperty property = Animation.FindProperty(selectedSO, path, out suffix);
-
+            SerializableProperty property = GetPropertyBinding(path);
             if (property == null)
                 return false;
 
@@ -982,6 +984,47 @@ namespace bs.Editor
             return changesMade;
         }
 
+        /// <summary>
+        /// Returns the property of the selected scene object that is animated by the curves at the provided path. Paths
+        /// are resolved once and the resulting properties are cached until <see cref="ClearPropertyBindings"/> is 
+        /// called, as resolving a path for every recorded or previewed frame is expensive. The cache is also dropped
+        /// whenever the scene is modified through the global undo/redo stack (e.g. a component is removed or replaced,
+        /// or an array field is reassigned), as the cached properties could be pointing to objects no longer in use.
+        /// </summary>
+        /// <param name="path">Path to the animated property.</param>
+        /// <returns>Property at the provided path, or null if the property cannot be found.</returns>
+        private SerializableProperty GetPropertyBinding(string path)
+        {
+            int topCommandId = UndoRedo.Global.TopCommandId;
+            if (topCommandId != propertyBindingsCommandId)
+            {
+                propertyBindings.Clear();
+                propertyBindingsCommandId = topCommandId;
+            }
+
+            SerializableProperty property;
+            if (propertyBindings.TryGetValue(path, out property))
+                return property;
+
+            string suffix;
+            property = Animation.FindProperty(selectedSO, path, out suffix);
+
+            // Failed lookups aren't cached, as the property might become available later (e.g. component added)
+            if (property != null)
+                propertyBindings[path] = property;
+
+            return property;
+        }
+
+        /// <summary>
+        /// Clears all properties cached by <see cref="GetPropertyBinding"/>. Must be called whenever the selected scene
+        /// object or its animated properties might have changed.
+        /// </summary>
+        private void ClearPropertyBindings()
+        {
+            propertyBindings.Clear();
+        }
+
         #endregion
 
         #region Curve display
@@ -282,11 +282,9 @@ namespace bs.Editor
             string srcRoot = GetBuildFolder(BuildFolder.SourceRoot, activePlatform);
             string destRoot = GetBuildFolder(BuildFolder.DestinationRoot, activePlatform);
 
-            // Prepare clean destination folder
-            if(Directory.Exists(destRoot))
-                Directory.Delete(destRoot, true);
-
-            Directory.CreateDirectory(destRoot);
+            // Outputs of the previous build in the destination folder are kept, and only files whose inputs changed are
+            // written again. Outputs no longer used by the build are removed when the build ends.
+            Internal_BeginBuild(destRoot);
 
             // Compile game assembly
             string bansheeAssemblyFolder;
@@ -306,7 +304,7 @@ namespace bs.Editor
                 string srcFile = Path.Combine(srcBansheeAssemblyFolder, EditorApplication.EngineAssemblyName);
                 string destFile = Path.Combine(destBansheeAssemblyFolder, EditorApplication.EngineAssemblyName);
 
-                File.Copy(srcFile, destFile);
+                CopyToBuild(srcFile, destFile);
             }
 
             // Copy builtin data
@@ -314,7 +312,7 @@ namespace bs.Editor
             string srcData = Path.Combine(srcRoot, dataFolder);
             string destData = Path.Combine(destRoot, dataFolder);
 
-            DirectoryEx.Copy(srcData, destData);
+            CopyFolderToBuild(srcData, destData);
 
             // Copy native binaries
             string binaryFolder = GetBuildFolder(BuildFolder.NativeBinaries, activePlatform);
@@ -327,7 +325,7 @@ namespace bs.Editor
                 string srcFile = Path.Combine(srcBin, entry);
                 string destFile = Path.Combine(destBin, entry);
 
-                File.Copy(srcFile, destFile);
+                CopyToBuild(srcFile, destFile);
             }
 
             // Copy .NET framework assemblies
@@ -343,7 +341,7 @@ namespace bs.Editor
                 string srcFile = Path.Combine(srcFrameworkAssemblyFolder, entry + ".dll");
                 string destFile = Path.Combine(destFrameworkAssemblyFolder, entry + ".dll");
 
-                File.Copy(srcFile, destFile);
+                CopyToBuild(srcFile, destFile);
             }
 
             // Copy Mono
@@ -351,12 +349,13 @@ namespace bs.Editor
             string srcMonoFolder = Path.Combine(srcRoot, monoFolder);
             string destMonoFolder = Path.Combine(destRoot, monoFolder);
 
-            DirectoryEx.Copy(srcMonoFolder, destMonoFolder);
+            CopyFolderToBuild(srcMonoFolder, destMonoFolder);
 
+            // Executable always gets copied since icons are injected into it after copy
             string srcExecFile = GetMainExecutable(activePlatform);
             string destExecFile = Path.Combine(destBin, Path.GetFileName(srcExecFile));
 
-            File.Copy(srcExecFile, destExecFile);
+            File.Copy(srcExecFile, destExecFile, true);
 
             InjectIcons(destExecFile, platformInfo);
             PackageResources(destRoot, platformInfo);
@@ -367,6 +366,38 @@ namespace bs.Editor
                 Thread.Sleep(200);
 
             ci.Dispose();
+
+            Internal_EndBuild();
+        }
+
+        /// <summary>
+        /// Copies a file into the build output. The copy is skipped if the destination file is still up to date with the
+        /// source file since the last build.
+        /// </summary>
+        /// <param name="srcFile">Absolute path to the file to copy.</param>
+        /// <param name="destFile">Absolute path to the destination within the build folder.</param>
+        private static void CopyToBuild(string srcFile, string destFile)
+        {
+            Internal_CopyToBuild(srcFile, destFile);
+        }
+
+        /// <summary>
+        /// Recursively copies all files in a folder into the build output. Files that are still up to date since the last
+        /// build are skipped.
+        /// </summary>
+        /// <param name="srcFolder">Absolute path to the folder to copy.</param>
+        /// <param name="destFolder">Absolute path to the destination folder within the build folder.</param>
+        private static void CopyFolderToBuild(string srcFolder, string destFolder)
+        {
+            if (!Directory.Exists(srcFolder))
+                return;
+
+            string[] files = Directory.GetFiles(srcFolder, "*", SearchOption.AllDirectories);
+            foreach (var srcFile in files)
+            {
+                string relativePath = srcFile.Substring(srcFolder.Length).TrimStart('/', '\\');
+                CopyToBuild(srcFile, Path.Combine(destFolder, relativePath));
+            }
         }
 
         /// <summary>
@@ -515,6 +546,15 @@ namespace bs.Editor
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_CreateStartupSettings(string buildFolder, IntPtr info);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_BeginBuild(string destinationRoot);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_CopyToBuild(string source, string destination);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_EndBuild();
     }
 
     /** @} */
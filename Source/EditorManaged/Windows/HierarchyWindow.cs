@@ -15,6 +15,8 @@ namespace bs.Editor
     /// </summary>
     public class HierarchyWindow : EditorWindow, IGlobalShortcuts
     {
+        private GUILayoutY contentLayout;
+        private GUITextField searchField;
         private GUIScrollArea treeScrollArea;
         private GUISceneTreeView treeView;
 
@@ -78,8 +80,23 @@ namespace bs.Editor
 
         private void OnInitialize()
         {
+            contentLayout = GUI.AddLayoutY();
+
+            GUILayoutX searchBarLayout = contentLayout.AddLayoutX();
+            searchField = new GUITextField();
+            searchField.OnChanged += OnSearchChanged;
+
+            GUIContent clearIcon = new GUIContent(EditorBuiltin.GetLibraryWindowIcon(LibraryWindowIcon.Clear), 
+                new LocEdString("Clear"));
+            GUIButton clearSearchBtn = new GUIButton(clearIcon);
+            clearSearchBtn.OnClick += OnClearClicked;
+            clearSearchBtn.SetWidth(40);
+
+            searchBarLayout.AddElement(searchField);
+            searchBarLayout.AddElement(clearSearchBtn);
+
             treeScrollArea = new GUIScrollArea();
-            GUI.AddElement(treeScrollArea);
+            contentLayout.AddElement(treeScrollArea);
 
             treeView = new GUISceneTreeView(GUIOption.FlexibleHeight(20), GUIOption.FlexibleWidth(20));
             treeScrollArea.Layout.AddElement(treeView);
@@ -174,14 +191,14 @@ namespace bs.Editor
             if (needsProgress && !loadingProgressShown)
             {
                 progressLayout.Active = true;
-                treeScrollArea.Active = false;
+                contentLayout.Active = false;
 
                 loadingProgressShown = true;
             }
             else if(!needsProgress && loadingProgressShown)
             {
                 progressLayout.Active = false;
-                treeScrollArea.Active = true;
+                contentLayout.Active = true;
 
                 loadingProgressShown = false;
             }
@@ -190,6 +207,25 @@ namespace bs.Editor
                 loadProgressBar.Percent = EditorApplication.SceneLoadProgress;
         }
 
+        /// <summary>
+        /// Triggered when the user inputs new values into the search input box. Filters the tree view so it only displays
+        /// scene objects matching the search text.
+        /// </summary>
+        /// <param name="newValue">Search box text.</param>
+        private void OnSearchChanged(string newValue)
+        {
+            treeView.Filter = newValue;
+        }
+
+        /// <summary>
+        /// Clears the search bar and displays the entire scene hierarchy.
+        /// </summary>
+        private void OnClearClicked()
+        {
+            searchField.Value = "";
+            treeView.Filter = "";
+        }
+
         /// <summary>
         /// Triggered when the user presses a virtual button.
         /// </summary>
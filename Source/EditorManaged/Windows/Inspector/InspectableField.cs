@@ -29,6 +29,8 @@ namespace bs.Editor
         protected bool active = true;
         protected SerializableProperty.FieldType type;
 
+        private int mergeGroupId;
+
         /// <summary>
         /// Property this field is displaying contents of.
         /// </summary>
@@ -268,6 +270,30 @@ namespace bs.Editor
             }
         }
 
+        /// <summary>
+        /// Starts a continuous edit of the field, normally when the field gains input focus. Starts recording an undo
+        /// command, and opens a merge group so all the commands recorded until <see cref="EndEdit"/> (e.g. a value
+        /// confirmed multiple times while the field has focus) end up in a single undo entry.
+        /// </summary>
+        protected void StartEdit()
+        {
+            if (context.Component != null)
+                mergeGroupId = UndoRedo.Global.BeginMergeGroup();
+
+            StartUndo();
+        }
+
+        /// <summary>
+        /// Finishes a continuous edit started with <see cref="StartEdit"/>, normally when the field loses input focus.
+        /// Pending changes must be recorded with <see cref="EndUndo"/> before calling this. If another field already
+        /// started its own edit the merge group belongs to that field, and is left open.
+        /// </summary>
+        protected void EndEdit()
+        {
+            UndoRedo.Global.EndMergeGroup(mergeGroupId);
+            mergeGroupId = 0;
+        }
+
         /// <summary>
         /// Finishes recording an undo command started via <see cref="StartUndo(string)"/>. If any changes are detected on
         /// the field an undo command is recorded onto the undo-redo stack, otherwise nothing is done.
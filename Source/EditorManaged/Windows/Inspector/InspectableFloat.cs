@@ -55,7 +55,8 @@ namespace bs.Editor
                     StartUndo();
                 };
                 guiFloatField.OnFocusLost += OnFieldValueConfirm;
-                guiFloatField.OnFocusGained += StartUndo;
+                guiFloatField.OnFocusLost += EndEdit;
+                guiFloatField.OnFocusGained += StartEdit;
 
                 layout.AddElement(layoutIndex, guiFloatField);
             }
@@ -55,7 +55,8 @@ namespace bs.Editor
                     StartUndo();
                 };
                 guiIntField.OnFocusLost += OnFieldValueConfirm;
-                guiIntField.OnFocusGained += StartUndo;
+                guiIntField.OnFocusLost += EndEdit;
+                guiIntField.OnFocusGained += StartEdit;
 
                 layout.AddElement(layoutIndex, guiIntField);
             }
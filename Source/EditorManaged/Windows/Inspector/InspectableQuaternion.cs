@@ -42,7 +42,8 @@ namespace bs.Editor
                 guiField.OnValueChanged += OnFieldValueChanged;
                 guiField.OnConfirm += x => OnFieldValueConfirm();
                 guiField.OnFocusLost += OnFieldValueConfirm;
-                guiField.OnFocusGained += StartUndo;
+                guiField.OnFocusLost += EndEdit;
+                guiField.OnFocusGained += StartEdit;
 
                 layout.AddElement(layoutIndex, guiField);
             }
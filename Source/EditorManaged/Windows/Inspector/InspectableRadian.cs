@@ -52,7 +52,8 @@ namespace bs.Editor
 
                     guiSliderField.OnChanged += OnFieldValueChanged;
                     guiSliderField.OnFocusLost += OnFieldValueConfirm;
-                    guiSliderField.OnFocusGained += StartUndo;
+                    guiSliderField.OnFocusLost += EndEdit;
+                    guiSliderField.OnFocusGained += StartEdit;
 
                     layout.AddElement(layoutIndex, guiSliderField);
                 }
@@ -74,7 +75,8 @@ namespace bs.Editor
                         StartUndo();
                     };
                     guiFloatField.OnFocusLost += OnFieldValueConfirm;
-                    guiFloatField.OnFocusGained += StartUndo;
+                    guiFloatField.OnFocusLost += EndEdit;
+                    guiFloatField.OnFocusGained += StartEdit;
 
                     layout.AddElement(layoutIndex, guiFloatField);
                 }
@@ -44,7 +44,8 @@ namespace bs.Editor
                     guiFloatField.Step = style.StepStyle.Step;
                 guiFloatField.OnChanged += OnFieldValueChanged;
                 guiFloatField.OnFocusLost += OnFieldValueConfirm;
-                guiFloatField.OnFocusGained += StartUndo;
+                guiFloatField.OnFocusLost += EndEdit;
+                guiFloatField.OnFocusGained += StartEdit;
 
                 layout.AddElement(layoutIndex, guiFloatField);
             }
@@ -44,7 +44,8 @@ namespace bs.Editor
                     guiIntField.Step = style.StepStyle.Step;
                 guiIntField.OnChanged += OnFieldValueChanged;
                 guiIntField.OnFocusLost += OnFieldValueConfirm;
-                guiIntField.OnFocusGained += StartUndo;
+                guiIntField.OnFocusLost += EndEdit;
+                guiIntField.OnFocusGained += StartEdit;
 
                 layout.AddElement(layoutIndex, guiIntField);
             }
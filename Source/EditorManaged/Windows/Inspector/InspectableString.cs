@@ -46,7 +46,8 @@ namespace bs.Editor
                     StartUndo();
                 };
                 guiField.OnFocusLost += OnFieldValueConfirm;
-                guiField.OnFocusGained += StartUndo;
+                guiField.OnFocusLost += EndEdit;
+                guiField.OnFocusGained += StartEdit;
 
                 layout.AddElement(layoutIndex, guiField);
             }
@@ -77,6 +77,7 @@ namespace bs.Editor
         private GUIVector3Field soScale;
 
         private Quaternion lastRotation;
+        private int mergeGroupId;
 
         private Rect2I[] dropAreas = new Rect2I[0];
 
@@ -261,8 +262,8 @@ namespace bs.Editor
                 OnModifyConfirm();
                 StartUndo("name");
             };
-            soNameInput.OnFocusGained += () => StartUndo("name");
-            soNameInput.OnFocusLost += OnModifyConfirm;
+            soNameInput.OnFocusGained += () => StartEdit("name");
+            soNameInput.OnFocusLost += EndEdit;
 
             nameLayout.AddElement(soActiveToggle);
             nameLayout.AddSpace(3);
@@ -292,9 +293,9 @@ namespace bs.Editor
             soPos.OnComponentFocusChanged += (focus, comp) =>
             {
                 if (focus)
-                    StartUndo("position." + comp.ToString());
+                    StartEdit("position." + comp.ToString());
                 else
-                    OnModifyConfirm();
+                    EndEdit();
             };
 
             soRot = new GUIVector3Field(new LocEdString("Rotation"), 50);
@@ -309,9 +310,9 @@ namespace bs.Editor
             soRot.OnComponentFocusChanged += (focus, comp) =>
             {
                 if (focus)
-                    StartUndo("rotation." + comp.ToString());
+                    StartEdit("rotation." + comp.ToString());
                 else
-                    OnModifyConfirm();
+                    EndEdit();
             };
 
             soScale = new GUIVector3Field(new LocEdString("Scale"), 50);
@@ -326,9 +327,9 @@ namespace bs.Editor
             soScale.OnComponentFocusChanged += (focus, comp) =>
             {
                 if (focus)
-                    StartUndo("scale." + comp.ToString());
+                    StartEdit("scale." + comp.ToString());
                 else
-                    OnModifyConfirm();
+                    EndEdit();
             };
 
             sceneObjectLayout.AddFlexibleSpace();
@@ -836,6 +837,28 @@ namespace bs.Editor
             EndUndo();
         }
 
+        /// <summary>
+        /// Triggered when one of the scene object fields gains input focus. Starts recording an undo command for the
+        /// field, and starts a merge group so all changes made while the field has focus end up in a single undo entry.
+        /// </summary>
+        /// <param name="name">Name of the field being changed.</param>
+        private void StartEdit(string name)
+        {
+            mergeGroupId = UndoRedo.Global.BeginMergeGroup();
+            StartUndo(name);
+        }
+
+        /// <summary>
+        /// Triggered when one of the scene object fields loses input focus. Finishes recording the undo command for the
+        /// field, and ends the merge group started by <see cref="StartEdit"/>.
+        /// </summary>
+        private void EndEdit()
+        {
+            OnModifyConfirm();
+            UndoRedo.Global.EndMergeGroup(mergeGroupId);
+            mergeGroupId = 0;
+        }
+
         /// <summary>
         /// Triggered when the position value in the currently active <see cref="SceneObject"/> changes. Updates the 
         /// necessary GUI elements.
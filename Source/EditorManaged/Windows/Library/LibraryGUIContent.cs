@@ -20,9 +20,12 @@ namespace bs.Editor
     {
         internal const int TOP_MARGIN = 8;
         internal const int LIST_ENTRY_SPACING = 6;
+        private const int VISIBLE_ROW_MARGIN = 2;
+        private const int QUERY_PAGE_SIZE = 512;
 
         private GUIPanel mainPanel;
         private GUILayout main;
+        private GUIPanel contentPanel;
         private GUIPanel overlay;
         private GUIPanel underlay;
         private GUIPanel deepUnderlay;
@@ -36,9 +39,13 @@ namespace bs.Editor
         private int elementsPerRow;
         private int paddingLeft;
         private int paddingRight;
+        private int rowHeight;
 
         private List<LibraryGUIEntry> entries = new List<LibraryGUIEntry>();
         private Dictionary<string, LibraryGUIEntry> entryLookup = new Dictionary<string, LibraryGUIEntry>();
+        private int visibleStart;
+        private int visibleEnd;
+        private LibraryIconCache iconCache = new LibraryIconCache();
 
         /// <summary>
         /// Area of the content area relative to the parent window.
@@ -104,6 +111,22 @@ namespace bs.Editor
             get { return window; }
         }
 
+        /// <summary>
+        /// Returns the GUI panel the resource tiles are displayed in.
+        /// </summary>
+        public GUIPanel ContentPanel
+        {
+            get { return contentPanel; }
+        }
+
+        /// <summary>
+        /// Returns the cache of the icons displayed on resource tiles.
+        /// </summary>
+        public LibraryIconCache IconCache
+        {
+            get { return iconCache; }
+        }
+
         /// <summary>
         /// Returns a GUI panel that can be used for displaying elements underneath the resource tiles.
         /// </summary>
@@ -150,22 +173,27 @@ namespace bs.Editor
         }
 
         /// <summary>
-        /// Refreshes the contents of the content area. Must be called at least once after construction.
+        /// Refreshes the contents of the content area. Must be called at least once after construction. Only the entries
+        /// in or near the visible part of the content area have their GUI elements created, the rest are created as they
+        /// are scrolled into view.
         /// </summary>
         /// <param name="viewType">Determines how to display the resource tiles.</param>
-        /// <param name="entriesToDisplay">Project library entries to display.</param>
+        /// <param name="entriesToDisplay">Query containing the project library entries to display. Can be null.</param>
         /// <param name="bounds">Bounds within which to lay out the content entries.</param>
-        public void Refresh(ProjectViewType viewType, LibraryEntry[] entriesToDisplay, Rect2I bounds)
+        public void Refresh(ProjectViewType viewType, LibraryQuery entriesToDisplay, Rect2I bounds)
         {
             if (mainPanel != null)
                 mainPanel.Destroy();
 
             entries.Clear();
             entryLookup.Clear();
+            iconCache.ClearRequests();
+            visibleStart = 0;
+            visibleEnd = 0;
 
             mainPanel = parent.Layout.AddPanel();
 
-            GUIPanel contentPanel = mainPanel.AddPanel(1);
+            contentPanel = mainPanel.AddPanel(1);
             overlay = mainPanel.AddPanel(0);
             underlay = mainPanel.AddPanel(2);
             deepUnderlay = mainPanel.AddPanel(3);
@@ -174,33 +202,45 @@ namespace bs.Editor
             main = contentPanel.AddLayoutY();
 
             List<ResourceToDisplay> resourcesToDisplay = new List<ResourceToDisplay>();
-            foreach (var entry in entriesToDisplay)
+
+            int numEntries = entriesToDisplay != null ? entriesToDisplay.Count : 0;
+            LibraryQueryPage page = null;
+            for (int pageStart = 0; pageStart < numEntries; pageStart += QUERY_PAGE_SIZE)
             {
-                if (entry.Type == LibraryEntryType.Directory)
-                    resourcesToDisplay.Add(new ResourceToDisplay(entry.Path, LibraryGUIEntryType.Single));
-                else
+                page = entriesToDisplay.ReadPage(pageStart, QUERY_PAGE_SIZE, page);
+                for (int i = 0; i < page.Count; i++)
                 {
-                    FileEntry fileEntry = (FileEntry)entry;
+                    if (page.GetEntryType(i) == LibraryEntryType.Directory)
+                    {
+                        resourcesToDisplay.Add(new ResourceToDisplay(page.GetPath(i), LibraryGUIEntryType.Single));
+                        continue;
+                    }
+
+                    int numResources = page.GetResourceCount(i);
+                    if (numResources == 0)
+                        continue;
+
+                    string entryPath = page.GetPath(i);
+                    if (numResources == 1)
+                    {
+                        resourcesToDisplay.Add(new ResourceToDisplay(entryPath, LibraryGUIEntryType.Single));
+                        continue;
+                    }
+
+                    // Sub-resource names are only needed for multi-resource files, so only those require the full entry
+                    FileEntry fileEntry = (FileEntry)page.GetEntry(i);
                     ResourceMeta[] metas = fileEntry.ResourceMetas;
 
-                    if (metas.Length > 0)
+                    resourcesToDisplay.Add(new ResourceToDisplay(entryPath, LibraryGUIEntryType.MultiFirst));
+
+                    for (int j = 1; j < metas.Length - 1; j++)
                     {
-                        if (metas.Length == 1)
-                            resourcesToDisplay.Add(new ResourceToDisplay(entry.Path, LibraryGUIEntryType.Single));
-                        else
-                        {
-                            resourcesToDisplay.Add(new ResourceToDisplay(entry.Path, LibraryGUIEntryType.MultiFirst));
-
-                            for (int i = 1; i < metas.Length - 1; i++)
-                            {
-                                string path = Path.Combine(entry.Path, metas[i].SubresourceName);
-                                resourcesToDisplay.Add(new ResourceToDisplay(path, LibraryGUIEntryType.MultiElement));
-                            }
-
-                            string lastPath = Path.Combine(entry.Path, metas[metas.Length - 1].SubresourceName);
-                            resourcesToDisplay.Add(new ResourceToDisplay(lastPath, LibraryGUIEntryType.MultiLast));
-                        }
+                        string path = Path.Combine(entryPath, metas[j].SubresourceName);
+                        resourcesToDisplay.Add(new ResourceToDisplay(path, LibraryGUIEntryType.MultiElement));
                     }
+
+                    string lastPath = Path.Combine(entryPath, metas[metas.Length - 1].SubresourceName);
+                    resourcesToDisplay.Add(new ResourceToDisplay(lastPath, LibraryGUIEntryType.MultiLast));
                 }
             }
 
@@ -213,22 +253,23 @@ namespace bs.Editor
                 minHorzElemSpacing = 0;
                 int elemWidth = bounds.width;
                 int elemHeight = tileSize;
-
-                main.AddSpace(TOP_MARGIN);
+                rowHeight = elemHeight + LIST_ENTRY_SPACING;
 
                 for (int i = 0; i < resourcesToDisplay.Count; i++)
                 {
                     ResourceToDisplay entry = resourcesToDisplay[i];
 
-                    LibraryGUIEntry guiEntry = new LibraryGUIEntry(this, main, entry.path, i, elemWidth, elemHeight, 0,
-                        entry.type);
+                    Rect2I area = new Rect2I(0, TOP_MARGIN + i * rowHeight, elemWidth, elemHeight);
+                    LibraryGUIEntry guiEntry = new LibraryGUIEntry(this, entry.path, i, area, 0, entry.type);
                     entries.Add(guiEntry);
                     entryLookup[guiEntry.path] = guiEntry;
-
-                    if (i != resourcesToDisplay.Count - 1)
-                        main.AddSpace(LIST_ENTRY_SPACING);
                 }
 
+                int contentHeight = TOP_MARGIN;
+                if (resourcesToDisplay.Count > 0)
+                    contentHeight += resourcesToDisplay.Count * rowHeight - LIST_ENTRY_SPACING;
+
+                main.AddSpace(contentHeight);
                 main.AddFlexibleSpace();
             }
             else
@@ -298,57 +339,49 @@ namespace bs.Editor
                     horzSpacing = extraRowSpace / (float)(elementsPerRow - 1);
 
                 elementsPerRow = Math.Max(elementsPerRow, 1);
+                rowHeight = elemHeight + vertElemSpacing;
 
-                main.AddSpace(TOP_MARGIN);
-                GUILayoutX rowLayout = main.AddLayoutX();
-                rowLayout.AddSpace(paddingLeft);
+                // Spacing is distributed the same way in every row, so column positions only need to be calculated once
+                int[] columnX = new int[elementsPerRow];
+                int[] columnSpacing = new int[elementsPerRow];
 
                 float spacingCounter = 0.0f;
-                int elemsInRow = 0;
-                for (int i = 0; i < resourcesToDisplay.Count; i++)
+                int x = paddingLeft;
+                for (int i = 0; i < elementsPerRow; i++)
                 {
-                    if (elemsInRow == elementsPerRow && elemsInRow > 0)
-                    {
-                        main.AddSpace(vertElemSpacing);
-                        rowLayout = main.AddLayoutX();
-                        rowLayout.AddSpace(paddingLeft);
-
-                        elemsInRow = 0;
-                        spacingCounter = 0.0f;
-                    }
-
-                    ResourceToDisplay entry = resourcesToDisplay[i];
-                    elemsInRow++;
-
-                    if (elemsInRow != elementsPerRow)
+                    if (i != elementsPerRow - 1)
                         spacingCounter += horzSpacing;
 
                     int spacing = (int)spacingCounter;
                     spacingCounter -= spacing;
 
-                    LibraryGUIEntry guiEntry = new LibraryGUIEntry(this, rowLayout, entry.path, i, elemWidth, elemHeight,
-                        spacing, entry.type);
-                    entries.Add(guiEntry);
-                    entryLookup[guiEntry.path] = guiEntry;
-
-                    if (elemsInRow == elementsPerRow)
-                        rowLayout.AddSpace(paddingRight);
+                    columnX[i] = x;
+                    columnSpacing[i] = spacing;
 
-                    rowLayout.AddSpace(spacing);
+                    x += elemWidth + spacing;
                 }
 
-                int extraElements = elementsPerRow - elemsInRow;
-                int extraSpacing = 0;
-
-                if (extraElements > 1)
+                for (int i = 0; i < resourcesToDisplay.Count; i++)
                 {
-                    spacingCounter += (extraElements - 1) * horzSpacing;
-                    extraSpacing += (int)spacingCounter;
+                    ResourceToDisplay entry = resourcesToDisplay[i];
+
+                    int row = i / elementsPerRow;
+                    int column = i % elementsPerRow;
+
+                    Rect2I area = new Rect2I(columnX[column], TOP_MARGIN + row * rowHeight, elemWidth, elemHeight);
+                    LibraryGUIEntry guiEntry = new LibraryGUIEntry(this, entry.path, i, area, columnSpacing[column],
+                        entry.type);
+                    entries.Add(guiEntry);
+                    entryLookup[guiEntry.path] = guiEntry;
                 }
 
-                if (extraElements > 0)
-                    rowLayout.AddSpace(elemWidth * extraElements + extraSpacing + paddingRight);
+                numRows = MathEx.CeilToInt(resourcesToDisplay.Count / (float)elementsPerRow);
+
+                int contentHeight = TOP_MARGIN;
+                if (numRows > 0)
+                    contentHeight += numRows * rowHeight - vertElemSpacing;
 
+                main.AddSpace(contentHeight);
                 main.AddFlexibleSpace();
             }
 
@@ -358,11 +391,7 @@ namespace bs.Editor
             deepUnderlay.Bounds = main.Bounds;
             renameOverlay.Bounds = main.Bounds;
 
-            for (int i = 0; i < entries.Count; i++)
-            {
-                LibraryGUIEntry guiEntry = entries[i];
-                guiEntry.Initialize();
-            }
+            UpdateVisibleEntries();
         }
 
         /// <summary>
@@ -370,10 +399,24 @@ namespace bs.Editor
         /// </summary>
         public void Update()
         {
-            for (int i = 0; i < entries.Count; i++)
+            UpdateVisibleEntries();
+            iconCache.Update(tileSize);
+
+            for (int i = visibleStart; i < visibleEnd; i++)
                 entries[i].Update();
         }
 
+        /// <summary>
+        /// Removes cached icons of the specified entry, so they are reloaded the next time they are displayed. Should be
+        /// called whenever the entry is modified.
+        /// </summary>
+        /// <param name="path">Project library path of the modified entry.</param>
+        public void InvalidateIcon(string path)
+        {
+            if (!string.IsNullOrEmpty(path))
+                iconCache.Invalidate(path);
+        }
+
         /// <summary>
         /// Changes the visual representation of an element at the specified path as being hovered over.
         /// </summary>
@@ -441,10 +484,13 @@ namespace bs.Editor
         /// <returns>True if found an entry, false otherwise.</returns>
         public LibraryGUIEntry FindElementAt(Vector2I scrollPos)
         {
-            foreach (var element in entries)
+            int start, end;
+            GetEntriesInRange(scrollPos.y, scrollPos.y, 1, out start, out end);
+
+            for (int i = start; i < end; i++)
             {
-                if (element.bounds.Contains(scrollPos))
-                    return element;
+                if (entries[i].bounds.Contains(scrollPos))
+                    return entries[i];
             }
 
             return null;
@@ -458,11 +504,14 @@ namespace bs.Editor
         /// <returns>A list of found entries.</returns>
         public LibraryGUIEntry[] FindElementsOverlapping(Rect2I scrollBounds)
         {
+            int start, end;
+            GetEntriesInRange(scrollBounds.y, scrollBounds.y + scrollBounds.height, 1, out start, out end);
+
             List<LibraryGUIEntry> elements = new List<LibraryGUIEntry>();
-            foreach (var element in entries)
+            for (int i = start; i < end; i++)
             {
-                if (element.Bounds.Overlaps(scrollBounds))
-                    elements.Add(element);
+                if (entries[i].Bounds.Overlaps(scrollBounds))
+                    elements.Add(entries[i]);
             }
 
             return elements.ToArray();
@@ -479,6 +528,63 @@ namespace bs.Editor
             return entryLookup.TryGetValue(path, out entry);
         }
 
+        /// <summary>
+        /// Shows entries that are in or near the visible part of the scroll area, and hides the entries that are not.
+        /// </summary>
+        private void UpdateVisibleEntries()
+        {
+            Rect2I scrollBounds = parent.Bounds;
+            Rect2I layoutBounds = parent.Layout.Bounds;
+
+            int top = scrollBounds.y - layoutBounds.y;
+            int bottom = top + scrollBounds.height;
+
+            int start, end;
+            GetEntriesInRange(top, bottom, VISIBLE_ROW_MARGIN, out start, out end);
+
+            if (start == visibleStart && end == visibleEnd)
+                return;
+
+            for (int i = visibleStart; i < visibleEnd; i++)
+            {
+                if (i < start || i >= end)
+                    entries[i].Hide();
+            }
+
+            for (int i = start; i < end; i++)
+            {
+                if (i < visibleStart || i >= visibleEnd)
+                    entries[i].Show();
+            }
+
+            visibleStart = start;
+            visibleEnd = end;
+        }
+
+        /// <summary>
+        /// Finds the range of entries in rows overlapping the specified vertical range.
+        /// </summary>
+        /// <param name="top">Top of the range, relative to the content area.</param>
+        /// <param name="bottom">Bottom of the range, relative to the content area.</param>
+        /// <param name="rowMargin">Number of extra rows to include above and below the range.</param>
+        /// <param name="start">Index of the first entry in the range.</param>
+        /// <param name="end">Index one past the last entry in the range.</param>
+        private void GetEntriesInRange(int top, int bottom, int rowMargin, out int start, out int end)
+        {
+            if (entries.Count == 0 || rowHeight <= 0)
+            {
+                start = 0;
+                end = 0;
+                return;
+            }
+
+            int firstRow = MathEx.FloorToInt((top - TOP_MARGIN) / (float)rowHeight) - rowMargin;
+            int lastRow = MathEx.FloorToInt((bottom - TOP_MARGIN) / (float)rowHeight) + rowMargin;
+
+            start = MathEx.Clamp(firstRow * elementsPerRow, 0, entries.Count);
+            end = MathEx.Clamp((lastRow + 1) * elementsPerRow, start, entries.Count);
+        }
+
         /// <summary>
         /// Helper structure containing information about a single entry to display in the library.
         /// </summary>
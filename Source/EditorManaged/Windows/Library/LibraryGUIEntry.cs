@@ -46,13 +46,20 @@ namespace bs.Editor
         public Rect2I bounds;
         public int spacing;
 
+        private GUIButton overlayBtn;
         private GUITexture underlay;
         private GUITexture groupUnderlay;
         private LibraryGUIContent owner;
         private UnderlayState underlayState;
         private GUITextBox renameTextBox;
 
-        private int width;
+        private Rect2I iconBounds;
+        private Rect2I labelBounds;
+        private Rect2I groupUnderlayBounds;
+        private string groupUnderlayStyle;
+        private bool isCut;
+        private bool iconRequested;
+
         private LibraryGUIEntryType type;
         private bool delayedSelect;
         private float delayedSelectTime;
@@ -67,119 +74,142 @@ namespace bs.Editor
         }
 
         /// <summary>
-        /// Constructs a new resource tile entry.
+        /// Checks if the entry's GUI elements currently exist. Only the entries in or near the visible part of the content
+        /// area are shown.
+        /// </summary>
+        public bool IsVisible
+        {
+            get { return icon != null; }
+        }
+
+        /// <summary>
+        /// Constructs a new resource tile entry. The entry's GUI elements are not created until <see cref="Show"/> is
+        /// called.
         /// </summary>
         /// <param name="owner">Content area this entry is part of.</param>
-        /// <param name="parent">Parent layout to add this entry's GUI elements to.</param>
         /// <param name="path">Path to the project library entry to display data for.</param>
         /// <param name="index">Sequential index of the entry in the conent area.</param>
-        /// <param name="width">Width of the GUI entry.</param>
-        /// <param name="height">Maximum allowed height for the label.</param>
+        /// <param name="area">Area of the entry's icon and label, relative to the content area.</param>
         /// <param name="spacing">Spacing between this element and the next element on the same row. 0 if last.</param>
         /// <param name="type">Type of the entry, which controls its style and/or behaviour.</param>
-        public LibraryGUIEntry(LibraryGUIContent owner, GUILayout parent, string path, int index, int width, int height,
-            int spacing, LibraryGUIEntryType type)
+        public LibraryGUIEntry(LibraryGUIContent owner, string path, int index, Rect2I area, int spacing,
+            LibraryGUIEntryType type)
         {
-            GUILayout entryLayout;
-
-            if (owner.GridLayout)
-                entryLayout = parent.AddLayoutY();
-            else
-                entryLayout = parent.AddLayoutX();
-
-            SpriteTexture iconTexture = GetIcon(path, owner.TileSize);
-
-            icon = new GUITexture(iconTexture, GUITextureScaleMode.ScaleToFit,
-                true, GUIOption.FixedHeight(owner.TileSize), GUIOption.FixedWidth(owner.TileSize));
-
-            label = null;
+            this.owner = owner;
+            this.index = index;
+            this.path = path;
+            this.underlay = null;
+            this.type = type;
+            this.spacing = spacing;
 
-            string name = PathEx.GetTail(path);
+            int tileSize = owner.TileSize;
             if (owner.GridLayout)
             {
-                int labelHeight = height - owner.TileSize;
-
-                label = new GUILabel(name, EditorStyles.MultiLineLabelCentered,
-                    GUIOption.FixedWidth(width), GUIOption.FixedHeight(labelHeight));
+                iconBounds = new Rect2I(area.x + (area.width - tileSize) / 2, area.y, tileSize, tileSize);
+                labelBounds = new Rect2I(area.x, area.y + tileSize, area.width, area.height - tileSize);
+                bounds = new Rect2I(area.x, area.y - VERT_PADDING, area.width, area.height + VERT_PADDING * 2);
 
                 switch (type)
                 {
-                    case LibraryGUIEntryType.Single:
-                        break;
                     case LibraryGUIEntryType.MultiFirst:
-                        groupUnderlay = new GUITexture(null, LibraryEntryFirstBg);
+                        groupUnderlayStyle = LibraryEntryFirstBg;
                         break;
                     case LibraryGUIEntryType.MultiElement:
-                        groupUnderlay = new GUITexture(null, LibraryEntryBg);
+                        groupUnderlayStyle = LibraryEntryBg;
                         break;
                     case LibraryGUIEntryType.MultiLast:
-                        groupUnderlay = new GUITexture(null, LibraryEntryLastBg);
+                        groupUnderlayStyle = LibraryEntryLastBg;
                         break;
                 }
+
+                bool firstInRow = index % owner.ElementsPerRow == 0;
+                bool lastInRow = index % owner.ElementsPerRow == (owner.ElementsPerRow - 1);
+
+                int offsetToPrevious = 0;
+                if (type == LibraryGUIEntryType.MultiFirst)
+                {
+                    if (firstInRow)
+                        offsetToPrevious = owner.PaddingLeft / 3;
+                    else
+                        offsetToPrevious = spacing / 3;
+                }
+                else if (firstInRow)
+                    offsetToPrevious = owner.PaddingLeft;
+
+                int offsetToNext = spacing;
+                if (type == LibraryGUIEntryType.MultiLast)
+                {
+                    if (lastInRow)
+                        offsetToNext = owner.PaddingRight / 3;
+                    else
+                        offsetToNext = spacing / 3;
+                }
+                else if (lastInRow)
+                    offsetToNext = owner.PaddingRight + spacing;
+
+                groupUnderlayBounds = new Rect2I(bounds.x - offsetToPrevious, bounds.y,
+                    bounds.width + offsetToNext + offsetToPrevious, bounds.height);
             }
             else
             {
-                label = new GUILabel(name, GUIOption.FixedWidth(width - owner.TileSize), GUIOption.FixedHeight(height));
+                iconBounds = new Rect2I(area.x, area.y, tileSize, tileSize);
+                labelBounds = new Rect2I(area.x + tileSize, area.y, area.width - tileSize, area.height);
+                bounds = new Rect2I(area.x, area.y - VERT_PADDING, area.width, tileSize + VERT_PADDING);
 
                 switch (type)
                 {
-                    case LibraryGUIEntryType.Single:
-                        break;
                     case LibraryGUIEntryType.MultiFirst:
-                        groupUnderlay = new GUITexture(null, LibraryEntryVertFirstBg);
+                        groupUnderlayStyle = LibraryEntryVertFirstBg;
                         break;
                     case LibraryGUIEntryType.MultiElement:
-                        groupUnderlay = new GUITexture(null, LibraryEntryVertBg);
+                        groupUnderlayStyle = LibraryEntryVertBg;
                         break;
                     case LibraryGUIEntryType.MultiLast:
-                        groupUnderlay = new GUITexture(null, LibraryEntryVertLastBg);
+                        groupUnderlayStyle = LibraryEntryVertLastBg;
                         break;
                 }
-            }
 
-            entryLayout.AddElement(icon);
-            entryLayout.AddElement(label);
+                int offsetToNext = BG_VERT_PADDING + LibraryGUIContent.LIST_ENTRY_SPACING;
+                if (type == LibraryGUIEntryType.MultiLast)
+                    offsetToNext = BG_VERT_PADDING * 2;
 
-            if (groupUnderlay != null)
-                owner.DeepUnderlay.AddElement(groupUnderlay);
-
-            this.owner = owner;
-            this.index = index;
-            this.path = path;
-            this.bounds = new Rect2I();
-            this.underlay = null;
-            this.type = type;
-            this.width = width;
-            this.spacing = spacing;
+                groupUnderlayBounds = new Rect2I(bounds.x, bounds.y - BG_VERT_PADDING,
+                    bounds.width, bounds.height + offsetToNext);
+            }
         }
 
         /// <summary>
-        /// Positions the GUI elements. Must be called after construction, but only after all content area entries have
-        /// been constructed so that entry's final bounds are known.
+        /// Creates the GUI elements of the entry, if not already created. The icon is displayed from the content area's
+        /// icon cache if available, or requested from it otherwise.
         /// </summary>
-        public void Initialize()
+        public void Show()
         {
-            Rect2I iconBounds = icon.Bounds;
-            bounds = iconBounds;
-            Rect2I labelBounds = label.Bounds;
+            if (IsVisible)
+                return;
 
-            if (owner.GridLayout)
+            SpriteTexture iconTexture;
+            if (!owner.IconCache.TryGetIcon(path, owner.TileSize, out iconTexture) && !iconRequested)
             {
-                bounds.x = labelBounds.x;
-                bounds.y -= VERT_PADDING;
-                bounds.width = labelBounds.width;
-                bounds.height = (labelBounds.y + labelBounds.height + VERT_PADDING) - bounds.y;
+                owner.IconCache.RequestIcon(this);
+                iconRequested = true;
             }
+
+            icon = new GUITexture(iconTexture, GUITextureScaleMode.ScaleToFit, true);
+            icon.Bounds = iconBounds;
+            owner.ContentPanel.AddElement(icon);
+
+            string name = PathEx.GetTail(path);
+            if (owner.GridLayout)
+                label = new GUILabel(name, EditorStyles.MultiLineLabelCentered);
             else
-            {
-                bounds.y -= VERT_PADDING;
-                bounds.width = width;
-                bounds.height += VERT_PADDING;
-            }
+                label = new GUILabel(name);
+
+            label.Bounds = labelBounds;
+            owner.ContentPanel.AddElement(label);
 
             string hoistedPath = path;
 
-            GUIButton overlayBtn = new GUIButton("", EditorStyles.Blank);
+            overlayBtn = new GUIButton("", EditorStyles.Blank);
             overlayBtn.Bounds = bounds;
             overlayBtn.OnClick += () => OnEntryClicked(hoistedPath);
             overlayBtn.OnDoubleClick += () => OnEntryDoubleClicked(hoistedPath);
@@ -188,51 +218,67 @@ namespace bs.Editor
 
             owner.Overlay.AddElement(overlayBtn);
 
-            if (groupUnderlay != null)
+            if (groupUnderlayStyle != null)
             {
-                if (owner.GridLayout)
-                {
-                    bool firstInRow = index % owner.ElementsPerRow == 0;
-                    bool lastInRow = index % owner.ElementsPerRow == (owner.ElementsPerRow - 1);
+                groupUnderlay = new GUITexture(null, groupUnderlayStyle);
+                groupUnderlay.Bounds = groupUnderlayBounds;
+                owner.DeepUnderlay.AddElement(groupUnderlay);
+            }
 
-                    int offsetToPrevious = 0;
-                    if (type == LibraryGUIEntryType.MultiFirst)
-                    {
-                        if (firstInRow)
-                            offsetToPrevious = owner.PaddingLeft / 3;
-                        else
-                            offsetToPrevious = spacing / 3;
-                    }
-                    else if (firstInRow)
-                        offsetToPrevious = owner.PaddingLeft;
+            if (isCut)
+                icon.SetTint(CUT_COLOR);
 
-                    int offsetToNext = spacing;
-                    if (type == LibraryGUIEntryType.MultiLast)
-                    {
-                        if (lastInRow)
-                            offsetToNext = owner.PaddingRight / 3;
-                        else
-                            offsetToNext = spacing / 3;
-                    }
-                    else if (lastInRow)
-                        offsetToNext = owner.PaddingRight + spacing;
+            UpdateUnderlay();
+        }
 
-                    Rect2I bgBounds = new Rect2I(bounds.x - offsetToPrevious, bounds.y,
-                        bounds.width + offsetToNext + offsetToPrevious, bounds.height);
-                    groupUnderlay.Bounds = bgBounds;
-                }
-                else
-                {
-                    int offsetToNext = BG_VERT_PADDING + LibraryGUIContent.LIST_ENTRY_SPACING;
-                    if (type == LibraryGUIEntryType.MultiLast)
-                        offsetToNext = BG_VERT_PADDING * 2;
+        /// <summary>
+        /// Destroys the GUI elements of the entry, while keeping its state (e.g. selection) so it is restored on the next
+        /// call to <see cref="Show"/>.
+        /// </summary>
+        public void Hide()
+        {
+            if (!IsVisible)
+                return;
 
-                    Rect2I bgBounds = new Rect2I(bounds.x, bounds.y - BG_VERT_PADDING,
-                        bounds.width, bounds.height + offsetToNext);
+            icon.Destroy();
+            label.Destroy();
+            overlayBtn.Destroy();
 
-                    groupUnderlay.Bounds = bgBounds;
-                }
+            icon = null;
+            label = null;
+            overlayBtn = null;
+
+            if (groupUnderlay != null)
+            {
+                groupUnderlay.Destroy();
+                groupUnderlay = null;
             }
+
+            if (underlay != null)
+            {
+                underlay.Destroy();
+                underlay = null;
+            }
+        }
+
+        /// <summary>
+        /// Assigns an icon loaded by the content area's icon cache, in response to an earlier request.
+        /// </summary>
+        /// <param name="texture">Icon to display, or null if the entry has no icon.</param>
+        internal void SetIcon(SpriteTexture texture)
+        {
+            iconRequested = false;
+
+            if (icon != null)
+                icon.SetTexture(texture);
+        }
+
+        /// <summary>
+        /// Notifies the entry that its pending icon request was discarded without being processed.
+        /// </summary>
+        internal void CancelIconRequest()
+        {
+            iconRequested = false;
         }
 
         /// <summary>
@@ -265,6 +311,11 @@ namespace bs.Editor
         /// <param name="enable">True if mark as cut, false to reset to normal.</param>
         public void MarkAsCut(bool enable)
         {
+            isCut = enable;
+
+            if (icon == null)
+                return;
+
             if (enable)
                 icon.SetTint(CUT_COLOR);
             else
@@ -281,16 +332,11 @@ namespace bs.Editor
                 return;
 
             if (enable)
-            {
-                CreateUnderlay();
-                underlay.SetTint(SELECTION_COLOR);
                 underlayState = UnderlayState.Selected;
-            }
             else
-            {
-                ClearUnderlay();
                 underlayState = UnderlayState.None;
-            }
+
+            UpdateUnderlay();
         }
 
         /// <summary>
@@ -303,16 +349,11 @@ namespace bs.Editor
                 return;
 
             if (enable)
-            {
-                CreateUnderlay();
-                underlay.SetTint(PING_COLOR);
                 underlayState = UnderlayState.Pinged;
-            }
             else
-            {
-                ClearUnderlay();
                 underlayState = UnderlayState.None;
-            }
+
+            UpdateUnderlay();
         }
 
         /// <summary>
@@ -325,16 +366,11 @@ namespace bs.Editor
                 return;
 
             if (enable)
-            {
-                CreateUnderlay();
-                underlay.SetTint(HOVER_COLOR);
                 underlayState = UnderlayState.Hovered;
-            }
             else
-            {
-                ClearUnderlay();
                 underlayState = UnderlayState.None;
-            }
+
+            UpdateUnderlay();
         }
 
         /// <summary>
@@ -346,7 +382,7 @@ namespace bs.Editor
                 return;
 
             renameTextBox = new GUITextBox(true);
-            Rect2I renameBounds = label.Bounds;
+            Rect2I renameBounds = labelBounds;
 
             // Rename box allows for less space for text than label, so adjust it slightly so it's more likely to be able
             // to display all visible text.
@@ -387,24 +423,22 @@ namespace bs.Editor
         }
 
         /// <summary>
-        /// Clears the underlay GUI element (for example ping, hover, select).
+        /// Creates, updates or destroys the underlay GUI element used for displaying the current underlay state (for
+        /// example ping, hover, select). Only has an effect while the entry is visible.
         /// </summary>
-        private void ClearUnderlay()
+        private void UpdateUnderlay()
         {
-            if (underlay != null)
+            if (underlayState == UnderlayState.None || !IsVisible)
             {
-                underlay.Destroy();
-                underlay = null;
-            }
+                if (underlay != null)
+                {
+                    underlay.Destroy();
+                    underlay = null;
+                }
 
-            underlayState = UnderlayState.None;
-        }
+                return;
+            }
 
-        /// <summary>
-        /// Creates a GUI elements that may be used for underlay effects (for example ping, hover, select).
-        /// </summary>
-        private void CreateUnderlay()
-        {
             if (underlay == null)
             {
                 underlay = new GUITexture(Builtin.WhiteTexture);
@@ -412,6 +446,19 @@ namespace bs.Editor
 
                 owner.Underlay.AddElement(underlay);
             }
+
+            switch (underlayState)
+            {
+                case UnderlayState.Hovered:
+                    underlay.SetTint(HOVER_COLOR);
+                    break;
+                case UnderlayState.Selected:
+                    underlay.SetTint(SELECTION_COLOR);
+                    break;
+                case UnderlayState.Pinged:
+                    underlay.SetTint(PING_COLOR);
+                    break;
+            }
         }
 
         /// <summary>
@@ -470,77 +517,6 @@ namespace bs.Editor
                 }
             }
         }
-
-        /// <summary>
-        /// Returns an icon that can be used for displaying a resource of the specified type.
-        /// </summary>
-        /// <param name="path">Path to the project library entry to display data for.</param>
-        /// <param name="size">Size of the icon to retrieve, in pixels.</param>
-        /// <returns>Icon to display for the specified entry.</returns>
-        private static SpriteTexture GetIcon(string path, int size)
-        {
-            LibraryEntry entry = ProjectLibrary.GetEntry(path);
-            if (entry.Type == LibraryEntryType.Directory)
-            {
-                return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.Folder, size);
-            }
-            else
-            {
-                ResourceMeta meta = ProjectLibrary.GetMeta(path);
-                ProjectResourceIcons icons = meta.Icons;
-
-                RRef<Texture> icon;
-                if (size <= 16)
-                    icon = icons.icon16;
-                else if (size <= 32)
-                    icon = icons.icon32;
-                else if (size <= 48)
-                    icon = icons.icon48;
-                else
-                    icon = icons.icon64;
-
-                if (icon.Value != null)
-                    return new SpriteTexture(icon);
-
-                switch (meta.ResType)
-                {
-                    case ResourceType.Font:
-                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.Font, size);
-                    case ResourceType.Mesh:
-                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.Mesh, size);
-                    case ResourceType.Texture:
-                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.Texture, size);
-                    case ResourceType.PlainText:
-                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.PlainText, size);
-                    case ResourceType.ScriptCode:
-                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.ScriptCode, size);
-                    case ResourceType.SpriteTexture:
-                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.SpriteTexture, size);
-                    case ResourceType.Shader:
-                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.Shader, size);
-                    case ResourceType.ShaderInclude:
-                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.Shader, size);
-                    case ResourceType.Material:
-                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.Material, size);
-                    case ResourceType.Prefab:
-                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.Prefab, size);
-                    case ResourceType.GUISkin:
-                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.GUISkin, size);
-                    case ResourceType.PhysicsMaterial:
-                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.PhysicsMaterial, size);
-                    case ResourceType.PhysicsMesh:
-                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.PhysicsMesh, size);
-                    case ResourceType.AudioClip:
-                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.AudioClip, size);
-                    case ResourceType.AnimationClip:
-                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.AnimationClip, size);
-                    case ResourceType.VectorField:
-                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.VectorField, size);
-                }
-            }
-
-            return null;
-        }
     }
 
     /// <summary>
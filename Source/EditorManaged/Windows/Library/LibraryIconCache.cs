@@ -0,0 +1,246 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Collections.Generic;
+using bs;
+
+namespace bs.Editor
+{
+    /** @addtogroup Library
+     *  @{
+     */
+
+    /// <summary>
+    /// Caches icons displayed by <see cref="LibraryGUIContent"/>, keeping only the most recently used ones. Icons that
+    /// aren't cached are loaded on request, a limited number per frame, so that displaying a folder with a large number of
+    /// resources doesn't stall the editor.
+    /// </summary>
+    internal class LibraryIconCache
+    {
+        private const int MAX_CACHED_ICONS = 1024;
+        private const int MAX_LOADS_PER_FRAME = 32;
+
+        /// <summary>
+        /// A single icon in the cache.
+        /// </summary>
+        private struct CachedIcon
+        {
+            public CachedIcon(string path, int size, SpriteTexture texture)
+            {
+                this.path = path;
+                this.size = size;
+                this.texture = texture;
+            }
+
+            public string path;
+            public int size;
+            public SpriteTexture texture;
+        }
+
+        private LinkedList<CachedIcon> icons = new LinkedList<CachedIcon>();
+        private Dictionary<string, LinkedListNode<CachedIcon>> iconLookup =
+            new Dictionary<string, LinkedListNode<CachedIcon>>();
+        private Queue<LibraryGUIEntry> requests = new Queue<LibraryGUIEntry>();
+
+        /// <summary>
+        /// Attempts to retrieve a cached icon for the specified entry.
+        /// </summary>
+        /// <param name="path">Project library path of the entry to retrieve the icon for.</param>
+        /// <param name="size">Size of the icon, in pixels.</param>
+        /// <param name="texture">Cached icon, or null if not cached or the entry has no icon.</param>
+        /// <returns>True if the icon was found in the cache, false otherwise.</returns>
+        public bool TryGetIcon(string path, int size, out SpriteTexture texture)
+        {
+            LinkedListNode<CachedIcon> node;
+            if (!iconLookup.TryGetValue(GetKey(path, size), out node))
+            {
+                texture = null;
+                return false;
+            }
+
+            icons.Remove(node);
+            icons.AddFirst(node);
+
+            texture = node.Value.texture;
+            return true;
+        }
+
+        /// <summary>
+        /// Queues the icon of the provided entry for loading. Once loaded the icon is assigned to the entry, as long as
+        /// the entry is still visible.
+        /// </summary>
+        /// <param name="entry">Entry to load the icon for.</param>
+        public void RequestIcon(LibraryGUIEntry entry)
+        {
+            requests.Enqueue(entry);
+        }
+
+        /// <summary>
+        /// Discards all pending icon requests. Should be called when the requesting entries are no longer used.
+        /// </summary>
+        public void ClearRequests()
+        {
+            foreach (var entry in requests)
+                entry.CancelIconRequest();
+
+            requests.Clear();
+        }
+
+        /// <summary>
+        /// Removes cached icons for the specified entry, and any entries it contains, so they are reloaded the next time
+        /// they are needed.
+        /// </summary>
+        /// <param name="path">Project library path of the entry whose icons to remove.</param>
+        public void Invalidate(string path)
+        {
+            LinkedListNode<CachedIcon> node = icons.First;
+            while (node != null)
+            {
+                LinkedListNode<CachedIcon> next = node.Next;
+                if (node.Value.path.StartsWith(path, StringComparison.OrdinalIgnoreCase))
+                {
+                    iconLookup.Remove(GetKey(node.Value.path, node.Value.size));
+                    icons.Remove(node);
+                }
+
+                node = next;
+            }
+        }
+
+        /// <summary>
+        /// Loads icons for pending requests, up to a per-frame limit. Should be called once per frame.
+        /// </summary>
+        /// <param name="size">Size of the icons currently displayed, in pixels.</param>
+        public void Update(int size)
+        {
+            int numLoaded = 0;
+            while (requests.Count > 0 && numLoaded < MAX_LOADS_PER_FRAME)
+            {
+                LibraryGUIEntry entry = requests.Dequeue();
+
+                // Entry was scrolled out of view before its icon was loaded
+                if (!entry.IsVisible)
+                {
+                    entry.CancelIconRequest();
+                    continue;
+                }
+
+                SpriteTexture texture;
+                if (!TryGetIcon(entry.path, size, out texture))
+                {
+                    texture = LoadIcon(entry.path, size);
+                    Add(entry.path, size, texture);
+                    numLoaded++;
+                }
+
+                entry.SetIcon(texture);
+            }
+        }
+
+        /// <summary>
+        /// Adds a new icon to the cache, evicting the least recently used icon if the cache is full.
+        /// </summary>
+        /// <param name="path">Project library path of the entry the icon belongs to.</param>
+        /// <param name="size">Size of the icon, in pixels.</param>
+        /// <param name="texture">Icon to add.</param>
+        private void Add(string path, int size, SpriteTexture texture)
+        {
+            if (icons.Count >= MAX_CACHED_ICONS)
+            {
+                LinkedListNode<CachedIcon> last = icons.Last;
+                iconLookup.Remove(GetKey(last.Value.path, last.Value.size));
+                icons.RemoveLast();
+            }
+
+            LinkedListNode<CachedIcon> node = icons.AddFirst(new CachedIcon(path, size, texture));
+            iconLookup[GetKey(path, size)] = node;
+        }
+
+        /// <summary>
+        /// Returns a key used for looking up icons in the cache.
+        /// </summary>
+        /// <param name="path">Project library path of the entry the icon belongs to.</param>
+        /// <param name="size">Size of the icon, in pixels.</param>
+        /// <returns>Key unique for the path and size combination.</returns>
+        private static string GetKey(string path, int size)
+        {
+            return size + ":" + path;
+        }
+
+        /// <summary>
+        /// Loads an icon that can be used for displaying a resource of the specified type.
+        /// </summary>
+        /// <param name="path">Path to the project library entry to display data for.</param>
+        /// <param name="size">Size of the icon to retrieve, in pixels.</param>
+        /// <returns>Icon to display for the specified entry.</returns>
+        private static SpriteTexture LoadIcon(string path, int size)
+        {
+            LibraryEntry entry = ProjectLibrary.GetEntry(path);
+            if (entry == null)
+                return null;
+
+            if (entry.Type == LibraryEntryType.Directory)
+            {
+                return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.Folder, size);
+            }
+            else
+            {
+                ResourceMeta meta = ProjectLibrary.GetMeta(path);
+                ProjectResourceIcons icons = meta.Icons;
+
+                RRef<Texture> icon;
+                if (size <= 16)
+                    icon = icons.icon16;
+                else if (size <= 32)
+                    icon = icons.icon32;
+                else if (size <= 48)
+                    icon = icons.icon48;
+                else
+                    icon = icons.icon64;
+
+                if (icon.Value != null)
+                    return new SpriteTexture(icon);
+
+                switch (meta.ResType)
+                {
+                    case ResourceType.Font:
+                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.Font, size);
+                    case ResourceType.Mesh:
+                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.Mesh, size);
+                    case ResourceType.Texture:
+                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.Texture, size);
+                    case ResourceType.PlainText:
+                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.PlainText, size);
+                    case ResourceType.ScriptCode:
+                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.ScriptCode, size);
+                    case ResourceType.SpriteTexture:
+                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.SpriteTexture, size);
+                    case ResourceType.Shader:
+                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.Shader, size);
+                    case ResourceType.ShaderInclude:
+                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.Shader, size);
+                    case ResourceType.Material:
+                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.Material, size);
+                    case ResourceType.Prefab:
+                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.Prefab, size);
+                    case ResourceType.GUISkin:
+                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.GUISkin, size);
+                    case ResourceType.PhysicsMaterial:
+                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.PhysicsMaterial, size);
+                    case ResourceType.PhysicsMesh:
+                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.PhysicsMesh, size);
+                    case ResourceType.AudioClip:
+                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.AudioClip, size);
+                    case ResourceType.AnimationClip:
+                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.AnimationClip, size);
+                    case ResourceType.VectorField:
+                        return EditorBuiltin.GetProjectLibraryIcon(ProjectLibraryIcon.VectorField, size);
+                }
+            }
+
+            return null;
+        }
+    }
+
+    /** @} */
+}
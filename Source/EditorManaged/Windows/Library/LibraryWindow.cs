@@ -830,30 +830,25 @@ namespace bs.Editor
         {
             requiresRefresh = false;
 
-            LibraryEntry[] entriesToDisplay = new LibraryEntry[0];
+            LibraryQuery entriesToDisplay;
             if (IsSearchActive)
             {
-                entriesToDisplay = ProjectLibrary.Search("*" + searchQuery + "*");
+                entriesToDisplay = ProjectLibrary.Query("*" + searchQuery + "*");
             }
             else
             {
-                DirectoryEntry entry = ProjectLibrary.GetEntry(CurrentFolder) as DirectoryEntry;
-                if (entry == null)
+                entriesToDisplay = ProjectLibrary.QueryChildren(CurrentFolder);
+                if (entriesToDisplay == null)
                 {
                     CurrentFolder = ProjectLibrary.Root.Path;
-                    entry = ProjectLibrary.GetEntry(CurrentFolder) as DirectoryEntry;
+                    entriesToDisplay = ProjectLibrary.QueryChildren(CurrentFolder);
                 }
-
-                if(entry != null)
-                    entriesToDisplay = entry.Children;
             }
 
             inProgressRenameElement = null;
 
             RefreshDirectoryBar();
 
-            SortEntries(entriesToDisplay);
-
             Rect2I visibleContentBounds = GetScrollAreaBounds();
             content.Refresh(viewType, entriesToDisplay, visibleContentBounds);
 
@@ -1178,7 +1173,24 @@ namespace bs.Editor
             if (filePaths.Length == 0)
                 return;
 
-            DialogBox.Open(new LocEdString("Confirm deletion"), new LocEdString("Are you sure you want to delete the selected object(s)?"),
+            int numReferenced = 0;
+            foreach (var path in filePaths)
+            {
+                if (ProjectLibrary.IsReferenced(path))
+                    numReferenced++;
+            }
+
+            LocString message;
+            if (numReferenced > 0)
+            {
+                message = new LocEdString("{0} of the selected object(s) are referenced by other resources, and those " +
+                    "references will be broken. Are you sure you want to delete the selected object(s)?");
+                message.SetParameter(0, numReferenced.ToString());
+            }
+            else
+                message = new LocEdString("Are you sure you want to delete the selected object(s)?");
+
+            DialogBox.Open(new LocEdString("Confirm deletion"), message,
                 DialogBox.Type.YesNo,
                 type =>
                 {
@@ -1293,6 +1305,7 @@ namespace bs.Editor
         /// <param name="entry">Project library path of the changed entry.</param>
         private void OnEntryChanged(string entry)
         {
+            content.InvalidateIcon(entry);
             requiresRefresh = true;
         }
 
@@ -1606,21 +1619,6 @@ namespace bs.Editor
             searchQuery = newValue;
             Refresh();
         }
-
-        /// <summary>
-        /// Sorts the specified set of project library entries by type (folder or resource), followed by name.
-        /// </summary>
-        /// <param name="input">Set of project library entries to sort.</param>
-        private static void SortEntries(LibraryEntry[] input)
-        {
-            Array.Sort(input, (x, y) =>
-            {
-                if (x.Type == y.Type)
-                    return x.Name.CompareTo(y.Name);
-                else
-                    return x.Type == LibraryEntryType.File ? 1 : -1;
-            });
-        }
     }
 
     /** @} */
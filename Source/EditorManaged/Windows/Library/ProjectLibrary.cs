@@ -212,6 +212,56 @@ namespace bs.Editor
             return Internal_Search(pattern, types);
         }
 
+        /// <summary>
+        /// Searches the library for a pattern, same as <see cref="Search"/>. Instead of creating an object for every
+        /// matched entry, the results are returned as a query that can be read in pages of compact data, and entry objects
+        /// are only created for the results that are accessed. Prefer this over <see cref="Search"/> when the number of 
+        /// results can be large.
+        /// </summary>
+        /// <param name="pattern">Pattern to search for. Use wildcard * to match any character(s).</param>
+        /// <param name="types">Type of resources to search for. If null all entries will be searched.</param>
+        /// <returns>Query containing the matched entries, directories first and then files, each sorted by name.</returns>
+        public static LibraryQuery Query(string pattern, ResourceType[] types = null)
+        {
+            return Internal_Query(pattern, types);
+        }
+
+        /// <summary>
+        /// Retrieves the contents of a folder in the project library, same as <see cref="DirectoryEntry.Children"/>, but
+        /// as a query that can be read in pages of compact data. See <see cref="Query"/>.
+        /// </summary>
+        /// <param name="path">Path to the folder, absolute or relative to resources folder.</param>
+        /// <returns>Query containing the folder's children, directories first and then files, each sorted by name. Null if
+        ///          the path doesn't point to a folder.</returns>
+        public static LibraryQuery QueryChildren(string path)
+        {
+            return Internal_QueryChildren(path);
+        }
+
+        /// <summary>
+        /// Finds all entries containing resources that reference any of the resources in the provided entry (for example
+        /// materials referencing a texture). Does not require any resources to be loaded.
+        /// </summary>
+        /// <param name="path">Path to the entry, absolute or relative to resources folder. If a sub-resource is provided
+        ///                    only references to that sub-resource are returned.</param>
+        /// <returns>A set of referencing entries. These objects can become invalid on the next library refresh and you are
+        ///          not meant to hold a permanent reference to them.</returns>
+        public static LibraryEntry[] FindReferences(string path)
+        {
+            return Internal_FindReferences(path);
+        }
+
+        /// <summary>
+        /// Checks are any of the resources in the provided entry referenced by resources in other entries. Deleting a
+        /// referenced entry will break those references.
+        /// </summary>
+        /// <param name="path">Path to the entry, absolute or relative to resources folder.</param>
+        /// <returns>True if the entry is referenced by other entries.</returns>
+        public static bool IsReferenced(string path)
+        {
+            return Internal_IsReferenced(path);
+        }
+
         /// <summary>
         /// Returns a path to a resource stored in the project library.
         /// </summary>
@@ -409,6 +459,18 @@ namespace bs.Editor
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern LibraryEntry[] Internal_Search(string path, ResourceType[] types);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern LibraryQuery Internal_Query(string path, ResourceType[] types);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern LibraryQuery Internal_QueryChildren(string path);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern LibraryEntry[] Internal_FindReferences(string path);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_IsReferenced(string path);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern string Internal_GetPath(Resource resource);
 
@@ -539,6 +601,205 @@ namespace bs.Editor
         private static extern bool Internal_GetIncludeInBuild(IntPtr thisPtr);
     }
 
+    /// <summary>
+    /// Results of a project library query, created through <see cref="ProjectLibrary.Query"/> or 
+    /// <see cref="ProjectLibrary.QueryChildren"/>. Holds a snapshot of the matched entries, which can be read in pages
+    /// using <see cref="ReadPage"/>, or accessed individually through <see cref="GetEntry"/>. The results can become
+    /// invalid on the next library refresh and you are not meant to hold a permanent reference to them.
+    /// </summary>
+    public sealed class LibraryQuery : ScriptObject
+    {
+        /// <summary>
+        /// Number of entries matched by the query.
+        /// </summary>
+        public int Count { get { return Internal_GetCount(mCachedPtr); } }
+
+        /// <summary>
+        /// Creates an object for the entry at the specified index.
+        /// </summary>
+        /// <param name="index">Index of the entry, in range [0, <see cref="Count"/>).</param>
+        /// <returns>Library entry at the specified index, or null if the index is out of range.</returns>
+        public LibraryEntry GetEntry(int index)
+        {
+            if (index < 0)
+                return null;
+
+            return Internal_GetEntry(mCachedPtr, index);
+        }
+
+        /// <summary>
+        /// Reads a range of the query results.
+        /// </summary>
+        /// <param name="start">Index of the first entry to read.</param>
+        /// <param name="count">Maximum number of entries to read.</param>
+        /// <param name="page">Page to read the results into. The page's buffers are reused if large enough, so the
+        ///                    same page object should be used when reading multiple pages. If null a new page is created.
+        ///                    </param>
+        /// <returns>Page containing the read results. Contains less than <paramref name="count"/> entries if the end of
+        ///          the results was reached.</returns>
+        public LibraryQueryPage ReadPage(int start, int count, LibraryQueryPage page = null)
+        {
+            if (page == null)
+                page = new LibraryQueryPage();
+
+            start = MathEx.Clamp(start, 0, Count);
+            count = Math.Max(Math.Min(count, Count - start), 0);
+
+            page.Reserve(count);
+            page.query = this;
+            page.start = start;
+            page.count = count;
+            page.strings = Internal_ReadPage(mCachedPtr, start, count, page.uuids, page.entryTypes,
+                page.resourceTypes, page.resourceCounts, page.pathOffsets, page.nameOffsets);
+
+            return page;
+        }
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern int Internal_GetCount(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern LibraryEntry Internal_GetEntry(IntPtr thisPtr, int index);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern string Internal_ReadPage(IntPtr thisPtr, int start, int count, UUID[] uuids,
+            LibraryEntryType[] entryTypes, ResourceType[] resourceTypes, int[] resourceCounts, int[] pathOffsets,
+            int[] nameOffsets);
+    }
+
+    /// <summary>
+    /// A range of results of a <see cref="LibraryQuery"/>, stored as a set of arrays with one element per entry. Paths
+    /// and names of all entries are stored in a single string, and separate strings are only created when requested.
+    /// </summary>
+    public sealed class LibraryQueryPage
+    {
+        internal LibraryQuery query;
+        internal int start;
+        internal int count;
+        internal string strings = "";
+
+        internal UUID[] uuids = new UUID[0];
+        internal LibraryEntryType[] entryTypes = new LibraryEntryType[0];
+        internal ResourceType[] resourceTypes = new ResourceType[0];
+        internal int[] resourceCounts = new int[0];
+        internal int[] pathOffsets = new int[1];
+        internal int[] nameOffsets = new int[0];
+
+        /// <summary>
+        /// Index of the first entry in the page, within the query results.
+        /// </summary>
+        public int Start { get { return start; } }
+
+        /// <summary>
+        /// Number of entries in the page.
+        /// </summary>
+        public int Count { get { return count; } }
+
+        /// <summary>
+        /// Returns the path of an entry, relative to the project library resources folder.
+        /// </summary>
+        /// <param name="index">Index of the entry within the page.</param>
+        /// <returns>Path of the entry.</returns>
+        public string GetPath(int index)
+        {
+            return strings.Substring(pathOffsets[index], nameOffsets[index] - pathOffsets[index]);
+        }
+
+        /// <summary>
+        /// Returns the name of an entry.
+        /// </summary>
+        /// <param name="index">Index of the entry within the page.</param>
+        /// <returns>Name of the entry.</returns>
+        public string GetName(int index)
+        {
+            return strings.Substring(nameOffsets[index], pathOffsets[index + 1] - nameOffsets[index]);
+        }
+
+        /// <summary>
+        /// Compares the name of an entry against the provided string, without creating a separate string for the name.
+        /// </summary>
+        /// <param name="index">Index of the entry within the page.</param>
+        /// <param name="name">Name to compare with.</param>
+        /// <param name="comparison">Type of comparison to perform.</param>
+        /// <returns>True if the names are equal, false otherwise.</returns>
+        public bool NameEquals(int index, string name, StringComparison comparison = StringComparison.Ordinal)
+        {
+            int length = pathOffsets[index + 1] - nameOffsets[index];
+            if (name.Length != length)
+                return false;
+
+            return string.Compare(strings, nameOffsets[index], name, 0, length, comparison) == 0;
+        }
+
+        /// <summary>
+        /// Returns the type of an entry.
+        /// </summary>
+        /// <param name="index">Index of the entry within the page.</param>
+        /// <returns>Type of the entry.</returns>
+        public LibraryEntryType GetEntryType(int index)
+        {
+            return entryTypes[index];
+        }
+
+        /// <summary>
+        /// Returns the UUID of the primary resource in a file entry.
+        /// </summary>
+        /// <param name="index">Index of the entry within the page.</param>
+        /// <returns>UUID of the primary resource, or an empty UUID for directories and files without resources.</returns>
+        public UUID GetUUID(int index)
+        {
+            return uuids[index];
+        }
+
+        /// <summary>
+        /// Returns the type of the primary resource in a file entry.
+        /// </summary>
+        /// <param name="index">Index of the entry within the page.</param>
+        /// <returns>Type of the primary resource, or <see cref="ResourceType.Undefined"/> for directories and files
+        ///          without resources.</returns>
+        public ResourceType GetResourceType(int index)
+        {
+            return resourceTypes[index];
+        }
+
+        /// <summary>
+        /// Returns the number of resources in a file entry.
+        /// </summary>
+        /// <param name="index">Index of the entry within the page.</param>
+        /// <returns>Number of resources in the file, or 0 for directories.</returns>
+        public int GetResourceCount(int index)
+        {
+            return resourceCounts[index];
+        }
+
+        /// <summary>
+        /// Creates an object for an entry in the page. See <see cref="LibraryQuery.GetEntry"/>.
+        /// </summary>
+        /// <param name="index">Index of the entry within the page.</param>
+        /// <returns>Library entry at the specified index.</returns>
+        public LibraryEntry GetEntry(int index)
+        {
+            return query.GetEntry(start + index);
+        }
+
+        /// <summary>
+        /// Makes sure the page buffers can hold at least the specified number of entries.
+        /// </summary>
+        /// <param name="count">Number of entries the buffers need to hold.</param>
+        internal void Reserve(int count)
+        {
+            if (uuids.Length >= count)
+                return;
+
+            uuids = new UUID[count];
+            entryTypes = new LibraryEntryType[count];
+            resourceTypes = new ResourceType[count];
+            resourceCounts = new int[count];
+            pathOffsets = new int[count + 1];
+            nameOffsets = new int[count];
+        }
+    }
+
     /// <summary>
     /// Contains meta-data for a resource in the ProjectLibrary.
     /// </summary>
@@ -33,6 +33,8 @@ namespace bs.Editor
     /// </summary>
     internal sealed class SceneSelection : ScriptObject
     {
+        private bool snapSessionActive;
+
         /// <summary>
         /// Settings that control how are pickable gizmos drawn.
         /// </summary>
@@ -107,6 +109,34 @@ namespace bs.Editor
             return Internal_Snap(mCachedPtr, ref pointerPos, out data, ignoreSceneObjects);
         }
 
+        /// <summary>
+        /// Starts a snap session, meant for continuous snapping such as while dragging an object across the scene. While
+        /// the session is active the scene is rendered for picking only once, and all <see cref="Snap"/> calls are answered
+        /// from the captured result. The capture is automatically refreshed if the camera moves or the ignored objects
+        /// change. Gizmos are not considered while a session is active. Does nothing if a session is already active.
+        /// </summary>
+        internal void BeginSnapSession()
+        {
+            if (snapSessionActive)
+                return;
+
+            Internal_BeginSnapSession(mCachedPtr);
+            snapSessionActive = true;
+        }
+
+        /// <summary>
+        /// Ends a snap session started with <see cref="BeginSnapSession"/> and releases the captured data. Does nothing if
+        /// no session is active.
+        /// </summary>
+        internal void EndSnapSession()
+        {
+            if (!snapSessionActive)
+                return;
+
+            Internal_EndSnapSession(mCachedPtr);
+            snapSessionActive = false;
+        }
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_Create(SceneSelection managedInstance, IntPtr camera, ref GizmoDrawSettings gizmoDrawSettings);
 
@@ -122,6 +152,12 @@ namespace bs.Editor
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern SceneObject Internal_Snap(IntPtr thisPtr, ref Vector2I pointerPos, out SnapData data, SceneObject[] ignoreRenderables);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_BeginSnapSession(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_EndSnapSession(IntPtr thisPtr);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_SetGizmoDrawSettings(IntPtr thisPtr, ref GizmoDrawSettings settings);
 
@@ -625,6 +625,7 @@ namespace bs.Editor
                 if (DragDrop.DropInProgress)
                 {
                     dragActive = false;
+                    sceneSelection.EndSnapSession();
                     if (draggedSO != null)
                     {
                         Selection.SceneObject = draggedSO;
@@ -697,6 +698,7 @@ namespace bs.Editor
                         if (Input.IsButtonHeld(ButtonCode.Space))
                         {
                             SnapData snapData;
+                            sceneSelection.BeginSnapSession();
                             sceneSelection.Snap(scenePos, out snapData, new SceneObject[] { draggedSO });
 
                             Quaternion q = Quaternion.FromToRotation(Vector3.YAxis, snapData.normal);
@@ -705,6 +707,8 @@ namespace bs.Editor
                         }
                         else
                         {
+                            sceneSelection.EndSnapSession();
+
                             Ray worldRay = camera.ScreenPointToRay(scenePos);
                             draggedSO.Position = worldRay * DefaultPlacementDepth - draggedSOOffset;
                         }
@@ -718,6 +722,7 @@ namespace bs.Editor
                 if (dragActive)
                 {
                     dragActive = false;
+                    sceneSelection.EndSnapSession();
 
                     if (draggedSO != null)
                     {
@@ -101,6 +101,26 @@ namespace bs.Editor
             set { Internal_SetFPSLimit(value); }
         }
 
+        /// <summary>
+        /// Maximum number of frames per second the editor is allowed to execute while idle (no input, log output, imports
+        /// or continuous redraw requests) or while none of its windows have focus. Zero disables idle throttling.
+        /// </summary>
+        public static int IdleFPSLimit
+        {
+            get { return Internal_GetIdleFPSLimit(); }
+            set { Internal_SetIdleFPSLimit(value); }
+        }
+
+        /// <summary>
+        /// Maximum number of worker processes used for importing resources. Importing in separate processes ensures a
+        /// failing importer cannot crash the editor. Zero means resources are imported in the editor process.
+        /// </summary>
+        public static int ImportWorkerCount
+        {
+            get { return Internal_GetImportWorkerCount(); }
+            set { Internal_SetImportWorkerCount(value); }
+        }
+
         /// <summary>
         /// Controls sensitivity of mouse movements in the editor. This doesn't apply to mouse cursor.
         /// Default value is 1.0f.
@@ -367,6 +387,14 @@ namespace bs.Editor
         private static extern int Internal_GetFPSLimit();
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_SetFPSLimit(int value);
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern int Internal_GetIdleFPSLimit();
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetIdleFPSLimit(int value);
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern int Internal_GetImportWorkerCount();
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetImportWorkerCount(int value);
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern float Internal_GetMouseSensitivity();
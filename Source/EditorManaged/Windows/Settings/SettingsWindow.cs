@@ -21,6 +21,8 @@ namespace bs.Editor
         private GUIToggleField autoLoadLastProjectField;
         private GUIListBoxField codeEditorField;
         private GUIIntField fpsLimitField;
+        private GUIIntField idleFpsLimitField;
+        private GUIIntField importWorkerCountField;
         private GUISliderField mouseSensitivityField;
 
         /// <summary>
@@ -71,6 +73,14 @@ namespace bs.Editor
             fpsLimitField.OnConfirmed += () => EditorSettings.FPSLimit = fpsLimitField.Value;
             fpsLimitField.OnFocusLost += () => EditorSettings.FPSLimit = fpsLimitField.Value;
 
+            idleFpsLimitField = new GUIIntField(new LocEdString("Idle FPS limit"), 200);
+            idleFpsLimitField.OnConfirmed += () => EditorSettings.IdleFPSLimit = idleFpsLimitField.Value;
+            idleFpsLimitField.OnFocusLost += () => EditorSettings.IdleFPSLimit = idleFpsLimitField.Value;
+
+            importWorkerCountField = new GUIIntField(new LocEdString("Import worker processes"), 200);
+            importWorkerCountField.OnConfirmed += () => EditorSettings.ImportWorkerCount = importWorkerCountField.Value;
+            importWorkerCountField.OnFocusLost += () => EditorSettings.ImportWorkerCount = importWorkerCountField.Value;
+
             mouseSensitivityField = new GUISliderField(0.2f, 2.0f, new LocEdString("Mouse sensitivity"));
             mouseSensitivityField.OnChanged += (x) => EditorSettings.MouseSensitivity = x;
 
@@ -99,6 +109,8 @@ namespace bs.Editor
             editorLayout.AddElement(autoLoadLastProjectField);
             editorLayout.AddElement(codeEditorField);
             editorLayout.AddElement(fpsLimitField);
+            editorLayout.AddElement(idleFpsLimitField);
+            editorLayout.AddElement(importWorkerCountField);
             editorLayout.AddElement(mouseSensitivityField);
 
             projectFoldout.Value = true;
@@ -113,6 +125,8 @@ namespace bs.Editor
             defaultHandleSizeField.Value = EditorSettings.DefaultHandleSize;
             autoLoadLastProjectField.Value = EditorSettings.AutoLoadLastProject;
             fpsLimitField.Value = EditorSettings.FPSLimit;
+            idleFpsLimitField.Value = EditorSettings.IdleFPSLimit;
+            importWorkerCountField.Value = EditorSettings.ImportWorkerCount;
             mouseSensitivityField.Value = EditorSettings.MouseSensitivity;
 
             CodeEditorType[] availableEditors = CodeEditor.AvailableEditors;
@@ -27,6 +27,7 @@
 #include "Wrappers/BsScriptEditorVirtualInput.h"
 #include "Wrappers/BsScriptUndoRedo.h"
 #include "BsEditorScriptLibrary.h"
+#include "BsScriptAttributeIndex.h"
 #include "Generated/BsScriptPlayInEditor.generated.h"
 
 namespace bs
@@ -39,6 +40,7 @@ namespace bs
 		SPtr<EditorResourceLoader> resourceLoader = bs_shared_ptr_new<EditorResourceLoader>();
 		GameResourceManager::instance().setLoader(resourceLoader);
 
+		ScriptAttributeIndex::startUp();
 		loadMonoTypes();
 
 		ScriptUndoRedo::startUp();
@@ -90,6 +92,7 @@ namespace bs
 		ScriptEditorVirtualInput::shutDown();
 		ScriptEditorInput::shutDown();
 		ScriptUndoRedo::shutDown();
+		ScriptAttributeIndex::shutDown();
 	}
 
 	void EditorScriptManager::update()
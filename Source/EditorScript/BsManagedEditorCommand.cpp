@@ -16,6 +16,7 @@ namespace bs
 {
 	MonoMethod* ScriptCmdManaged::sCommitMethod = nullptr;
 	MonoMethod* ScriptCmdManaged::sRevertMethod = nullptr;
+	MonoMethod* ScriptCmdManaged::sMergeMethod = nullptr;
 
 	ScriptCmdManaged::ScriptCmdManaged(MonoObject* managedInstance)
 		:ScriptObject(managedInstance)
@@ -49,6 +50,7 @@ namespace bs
 
 		sCommitMethod = metaData.scriptClass->getMethod("Commit");
 		sRevertMethod = metaData.scriptClass->getMethod("Revert");
+		sMergeMethod = metaData.scriptClass->getMethod("Merge", 1);
 	}
 
 	void ScriptCmdManaged::internal_CreateInstance(MonoObject* managedInstance)
@@ -74,6 +76,22 @@ namespace bs
 		sRevertMethod->invokeVirtual(obj, nullptr);
 	}
 
+	bool ScriptCmdManaged::triggerMerge(ScriptCmdManaged* next)
+	{
+		if (sMergeMethod == nullptr)
+			return false;
+
+		MonoObject* obj = MonoUtil::getObjectFromGCHandle(mGCHandle);
+		MonoObject* nextObj = MonoUtil::getObjectFromGCHandle(next->mGCHandle);
+		if (obj == nullptr || nextObj == nullptr)
+			return false;
+
+		void* params[1] = { nextObj };
+		MonoObject* output = sMergeMethod->invokeVirtual(obj, params);
+
+		return *(bool*)MonoUtil::unbox(output);
+	}
+
 	void ScriptCmdManaged::notifyCommandDestroyed()
 	{
 		mManagedCommand = nullptr;
@@ -241,6 +259,16 @@ namespace bs
 		mScriptObj->triggerRevert();
 	}
 
+	bool CmdManaged::merge(const SPtr<EditorCommand>& next)
+	{
+		// Only managed commands can be merged with managed commands, the managed side handles the rest
+		CmdManaged* nextCommand = dynamic_cast<CmdManaged*>(next.get());
+		if (mScriptObj == nullptr || nextCommand == nullptr || nextCommand->mScriptObj == nullptr)
+			return false;
+
+		return mScriptObj->triggerMerge(nextCommand->mScriptObj);
+	}
+
 	void CmdManaged::onCommandAdded()
 	{
 		if(mScriptObj)
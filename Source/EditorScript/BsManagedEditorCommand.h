@@ -36,6 +36,9 @@ namespace bs
 		/** Triggers the Revert() method on the managed object instance. */
 		void triggerRevert();
 
+		/** Triggers the Merge() method on the managed object instance. Returns true if the provided command was merged. */
+		bool triggerMerge(ScriptCmdManaged* next);
+
 		/**
 		 * Allocates a GC handle that ensures the object doesn't get GC collected. Must eventually be followed by
 		 * freeGCHandle().
@@ -81,6 +84,7 @@ namespace bs
 
 		static MonoMethod* sCommitMethod;
 		static MonoMethod* sRevertMethod;
+		static MonoMethod* sMergeMethod;
 	};
 
 	/** @} */
@@ -104,6 +108,9 @@ namespace bs
 		/** @copydoc EditorCommand::revert */
 		void revert() override;
 
+		/** @copydoc EditorCommand::merge */
+		bool merge(const SPtr<EditorCommand>& next) override;
+
 	private:
 		friend class UndoRedo;
 		friend class ScriptCmdManaged;
@@ -1,6 +1,7 @@
 //********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsMenuItemManager.h"
+#include "BsScriptAttributeIndex.h"
 #include "Serialization/BsScriptAssemblyManager.h"
 #include "BsMonoAssembly.h"
 #include "BsMonoClass.h"
@@ -86,45 +87,35 @@ namespace bs
 
 		MainEditorWindow* mainWindow = EditorWindowManager::instance().getMainWindow();
 
-		Vector<String> scriptAssemblyNames = mScriptObjectManager.getScriptAssemblies();
-		for (auto& assemblyName : scriptAssemblyNames)
+		// Find new menu item methods
+		Vector<MonoMethod*> methods = ScriptAttributeIndex::instance().getMethodsWithAttribute(mMenuItemAttribute);
+		for (auto& curMethod : methods)
 		{
-			MonoAssembly* assembly = MonoManager::instance().getAssembly(assemblyName);
-
-			// Find new menu item methods
-			const Vector<MonoClass*>& allClasses = assembly->getAllClasses();
-			for (auto curClass : allClasses)
+			String path;
+			ShortcutKey shortcutKey = ShortcutKey::NONE;
+			INT32 priority = 0;
+			bool separator = false;
+			if (parseMenuItemMethod(curMethod, path, shortcutKey, priority, separator))
 			{
-				const Vector<MonoMethod*>& methods = curClass->getAllMethods();
-				for (auto& curMethod : methods)
+				std::function<void()> callback = std::bind(&MenuItemManager::menuItemCallback, curMethod);
+
+				if (separator)
 				{
-					String path;
-					ShortcutKey shortcutKey = ShortcutKey::NONE;
-					INT32 priority = 0;
-					bool separator = false;
-					if (parseMenuItemMethod(curMethod, path, shortcutKey, priority, separator))
+					Vector<String> pathElements = StringUtil::split(path, "/");
+					String separatorPath;
+					if (pathElements.size() > 1)
 					{
-						std::function<void()> callback = std::bind(&MenuItemManager::menuItemCallback, curMethod);
-
-						if (separator)
-						{
-							Vector<String> pathElements = StringUtil::split(path, "/");
-							String separatorPath;
-							if (pathElements.size() > 1)
-							{
-								const String& lastElem = pathElements[pathElements.size() - 1];
-								separatorPath = path;
-								separatorPath.erase(path.size() - lastElem.size() - 1, lastElem.size() + 1);
-							}
-
-							GUIMenuItem* separatorItem = mainWindow->getMenuBar().addMenuItemSeparator(separatorPath, priority);
-							mMenuItems.push_back(separatorItem);
-						}
-
-						GUIMenuItem* menuItem = mainWindow->getMenuBar().addMenuItem(path, callback, priority, shortcutKey);
-						mMenuItems.push_back(menuItem);
+						const String& lastElem = pathElements[pathElements.size() - 1];
+						separatorPath = path;
+						separatorPath.erase(path.size() - lastElem.size() - 1, lastElem.size() + 1);
 					}
+
+					GUIMenuItem* separatorItem = mainWindow->getMenuBar().addMenuItemSeparator(separatorPath, priority);
+					mMenuItems.push_back(separatorItem);
 				}
+
+				GUIMenuItem* menuItem = mainWindow->getMenuBar().addMenuItem(path, callback, priority, shortcutKey);
+				mMenuItems.push_back(menuItem);
 			}
 		}
 	}
@@ -0,0 +1,414 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsScriptAttributeIndex.h"
+#include "BsEditorScriptLibrary.h"
+#include "BsEditorApplication.h"
+#include "Serialization/BsScriptAssemblyManager.h"
+#include "BsMonoManager.h"
+#include "BsMonoAssembly.h"
+#include "BsMonoClass.h"
+#include "BsMonoMethod.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+
+namespace bs
+{
+	const ScriptAttributeIndex::TrackedType ScriptAttributeIndex::TRACKED_TYPES[] =
+	{
+		{ "MenuItem", TrackedTypeKind::MethodAttribute },
+		{ "ToolbarItem", TrackedTypeKind::MethodAttribute },
+		{ "DrawGizmo", TrackedTypeKind::MethodAttribute },
+		{ "OnSelectionChanged", TrackedTypeKind::MethodAttribute },
+		{ "CustomHandle", TrackedTypeKind::ClassAttribute },
+		{ "CustomInspector", TrackedTypeKind::ClassAttribute },
+		{ "EditorWindow", TrackedTypeKind::BaseClass }
+	};
+
+	const UINT32 ScriptAttributeIndex::NUM_TRACKED_TYPES = sizeof(TRACKED_TYPES) / sizeof(TRACKED_TYPES[0]);
+	const char* ScriptAttributeIndex::CACHE_FILENAME = "ScriptAttributeIndex.txt";
+
+	/** Placeholder used in the cache file for empty values. */
+	static const char* CACHE_EMPTY_VALUE = "-";
+
+	ScriptAttributeIndex::ScriptAttributeIndex()
+	{
+		mDomainUnloadConn = MonoManager::instance().onDomainUnload.connect(std::bind(&ScriptAttributeIndex::clear, this));
+	}
+
+	ScriptAttributeIndex::~ScriptAttributeIndex()
+	{
+		mDomainUnloadConn.disconnect();
+	}
+
+	Vector<MonoClass*> ScriptAttributeIndex::getClassesWithAttribute(MonoClass* attribute)
+	{
+		return findEntries(attribute, TrackedTypeKind::ClassAttribute, &Entry::klass, StringUtil::BLANK);
+	}
+
+	Vector<MonoMethod*> ScriptAttributeIndex::getMethodsWithAttribute(MonoClass* attribute)
+	{
+		return findEntries(attribute, TrackedTypeKind::MethodAttribute, &Entry::method, StringUtil::BLANK);
+	}
+
+	Vector<MonoClass*> ScriptAttributeIndex::getDerivedClasses(MonoClass* baseClass, const String& assembly)
+	{
+		return findEntries(baseClass, TrackedTypeKind::BaseClass, &Entry::klass, assembly);
+	}
+
+	template<class T>
+	Vector<T*> ScriptAttributeIndex::findEntries(MonoClass* type, TrackedTypeKind kind, T* Entry::*member,
+		const String& assembly)
+	{
+		Vector<T*> output;
+		if (type == nullptr)
+			return output;
+
+		build();
+
+		auto iterFind = std::find(mTrackedClasses.begin(), mTrackedClasses.end(), type);
+		if (iterFind == mTrackedClasses.end())
+		{
+			BS_LOG(Error, Script, "Type {0} is not tracked by the script attribute index.", type->getFullName());
+			return output;
+		}
+
+		const auto typeIdx = (UINT32)(iterFind - mTrackedClasses.begin());
+		if (TRACKED_TYPES[typeIdx].kind != kind)
+			return output;
+
+		for (auto& assemblyIndex : mAssemblies)
+		{
+			if (!assembly.empty() && assemblyIndex.name != assembly)
+				continue;
+
+			for (auto& entry : assemblyIndex.entries)
+			{
+				if (entry.typeIdx == typeIdx)
+					output.push_back(entry.*member);
+			}
+		}
+
+		return output;
+	}
+
+	void ScriptAttributeIndex::build()
+	{
+		if (mTrackedClasses.empty())
+		{
+			mTrackedClasses.resize(NUM_TRACKED_TYPES, nullptr);
+
+			MonoAssembly* editorAssembly = MonoManager::instance().getAssembly(EDITOR_ASSEMBLY);
+			if (editorAssembly != nullptr)
+			{
+				for (UINT32 i = 0; i < NUM_TRACKED_TYPES; i++)
+					mTrackedClasses[i] = editorAssembly->getClass(EDITOR_NS, TRACKED_TYPES[i].name);
+			}
+		}
+
+		UnorderedMap<String, CachedAssembly> cache;
+		bool cacheLoaded = false;
+		bool cacheDirty = false;
+
+		// Script assemblies can be loaded additively without a domain reload, so check for any new ones
+		Vector<String> scriptAssemblyNames = ScriptAssemblyManager::instance().getScriptAssemblies();
+		for (auto& assemblyName : scriptAssemblyNames)
+		{
+			auto iterFind = std::find_if(mAssemblies.begin(), mAssemblies.end(), 
+				[&assemblyName](const AssemblyIndex& entry) { return entry.name == assemblyName; });
+
+			if (iterFind != mAssemblies.end())
+				continue;
+
+			MonoAssembly* assembly = MonoManager::instance().getAssembly(assemblyName);
+			if (assembly == nullptr)
+				continue;
+
+			mAssemblies.push_back(AssemblyIndex());
+
+			AssemblyIndex& assemblyIndex = mAssemblies.back();
+			assemblyIndex.name = assemblyName;
+			assemblyIndex.hash = hashFile(getAssemblyPath(assemblyName));
+
+			if (assemblyIndex.hash != 0)
+			{
+				if (!cacheLoaded)
+				{
+					cache = loadCache();
+					cacheLoaded = true;
+				}
+
+				auto iterFindCached = cache.find(assemblyName);
+				if (iterFindCached != cache.end() && iterFindCached->second.hash == assemblyIndex.hash)
+				{
+					if (resolveCachedAssembly(assembly, iterFindCached->second, assemblyIndex))
+						continue;
+				}
+			}
+
+			reflectAssembly(assembly, assemblyIndex);
+			cacheDirty = true;
+		}
+
+		if (cacheDirty)
+		{
+			if (!cacheLoaded)
+				cache = loadCache();
+
+			saveCache(cache);
+		}
+	}
+
+	void ScriptAttributeIndex::clear()
+	{
+		mTrackedClasses.clear();
+		mAssemblies.clear();
+	}
+
+	void ScriptAttributeIndex::reflectAssembly(MonoAssembly* assembly, AssemblyIndex& output) const
+	{
+		output.entries.clear();
+
+		bool hasMethodAttributes = false;
+		for (UINT32 i = 0; i < NUM_TRACKED_TYPES; i++)
+		{
+			if (TRACKED_TYPES[i].kind == TrackedTypeKind::MethodAttribute && mTrackedClasses[i] != nullptr)
+				hasMethodAttributes = true;
+		}
+
+		const Vector<MonoClass*>& allClasses = assembly->getAllClasses();
+		for (auto curClass : allClasses)
+		{
+			for (UINT32 i = 0; i < NUM_TRACKED_TYPES; i++)
+			{
+				MonoClass* trackedClass = mTrackedClasses[i];
+				if (trackedClass == nullptr)
+					continue;
+
+				if (TRACKED_TYPES[i].kind == TrackedTypeKind::ClassAttribute)
+				{
+					if (curClass->hasAttribute(trackedClass))
+						output.entries.push_back({ i, curClass, nullptr });
+				}
+				else if (TRACKED_TYPES[i].kind == TrackedTypeKind::BaseClass)
+				{
+					if (curClass != trackedClass && curClass->isSubClassOf(trackedClass))
+						output.entries.push_back({ i, curClass, nullptr });
+				}
+			}
+
+			if (!hasMethodAttributes)
+				continue;
+
+			const Vector<MonoMethod*>& methods = curClass->getAllMethods();
+			for (auto& curMethod : methods)
+			{
+				for (UINT32 i = 0; i < NUM_TRACKED_TYPES; i++)
+				{
+					MonoClass* trackedClass = mTrackedClasses[i];
+					if (trackedClass == nullptr || TRACKED_TYPES[i].kind != TrackedTypeKind::MethodAttribute)
+						continue;
+
+					if (curMethod->hasAttribute(trackedClass))
+						output.entries.push_back({ i, curClass, curMethod });
+				}
+			}
+		}
+	}
+
+	bool ScriptAttributeIndex::resolveCachedAssembly(MonoAssembly* assembly, const CachedAssembly& cached,
+		AssemblyIndex& output) const
+	{
+		output.entries.clear();
+
+		for (auto& cachedEntry : cached.entries)
+		{
+			if (cachedEntry.typeIdx >= NUM_TRACKED_TYPES)
+				return false;
+
+			MonoClass* trackedClass = mTrackedClasses[cachedEntry.typeIdx];
+			if (trackedClass == nullptr)
+				return false;
+
+			MonoClass* klass = assembly->getClass(cachedEntry.ns, cachedEntry.typeName);
+			if (klass == nullptr)
+				return false;
+
+			// Make sure the entry still matches, in case the lookup by name resolved to a different class or overload
+			MonoMethod* method = nullptr;
+			switch (TRACKED_TYPES[cachedEntry.typeIdx].kind)
+			{
+			case TrackedTypeKind::ClassAttribute:
+				if (!klass->hasAttribute(trackedClass))
+					return false;
+				break;
+			case TrackedTypeKind::BaseClass:
+				if (!klass->isSubClassOf(trackedClass))
+					return false;
+				break;
+			case TrackedTypeKind::MethodAttribute:
+				method = klass->getMethod(cachedEntry.methodName, cachedEntry.numParams);
+				if (method == nullptr || !method->hasAttribute(trackedClass))
+					return false;
+				break;
+			}
+
+			output.entries.push_back({ cachedEntry.typeIdx, klass, method });
+		}
+
+		return true;
+	}
+
+	UnorderedMap<String, ScriptAttributeIndex::CachedAssembly> ScriptAttributeIndex::loadCache() const
+	{
+		UnorderedMap<String, CachedAssembly> output;
+
+		const Path cachePath = getCachePath();
+		if (cachePath.isEmpty() || !FileSystem::isFile(cachePath))
+			return output;
+
+		auto getValue = [](const String& value)
+		{
+			return value == CACHE_EMPTY_VALUE ? StringUtil::BLANK : value;
+		};
+
+		String contents = FileSystem::openFile(cachePath)->getAsString();
+		Vector<String> lines = StringUtil::split(contents, "\n");
+
+		CachedAssembly* current = nullptr;
+		for (auto& line : lines)
+		{
+			Vector<String> params = StringUtil::split(line, "\t");
+			if (params.size() == 3 && params[0] == "A")
+			{
+				current = &output[params[1]];
+				current->hash = parseUINT64(params[2]);
+			}
+			else if (params.size() == 6 && params[0] == "E" && current != nullptr)
+			{
+				UINT32 typeIdx = NUM_TRACKED_TYPES;
+				for (UINT32 i = 0; i < NUM_TRACKED_TYPES; i++)
+				{
+					if (params[1] == TRACKED_TYPES[i].name)
+					{
+						typeIdx = i;
+						break;
+					}
+				}
+
+				current->entries.push_back({ typeIdx, getValue(params[2]), params[3], getValue(params[4]),
+					parseUINT32(params[5]) });
+			}
+		}
+
+		return output;
+	}
+
+	void ScriptAttributeIndex::saveCache(UnorderedMap<String, CachedAssembly>& cache) const
+	{
+		const Path cachePath = getCachePath();
+		if (cachePath.isEmpty())
+			return;
+
+		// Update the cache with the current index, keeping entries for assemblies that aren't currently loaded
+		for (auto& assemblyIndex : mAssemblies)
+		{
+			// Assemblies whose file is unknown can't be validated on load, so there's no point in caching them
+			if (assemblyIndex.hash == 0)
+				continue;
+
+			CachedAssembly& cachedAssembly = cache[assemblyIndex.name];
+			cachedAssembly.hash = assemblyIndex.hash;
+			cachedAssembly.entries.clear();
+
+			for (auto& entry : assemblyIndex.entries)
+			{
+				CachedEntry cachedEntry { entry.typeIdx, entry.klass->getNamespace(), entry.klass->getTypeName(), 
+					StringUtil::BLANK, 0 };
+
+				if (entry.method != nullptr)
+				{
+					cachedEntry.methodName = entry.method->getName();
+					cachedEntry.numParams = entry.method->getNumParameters();
+				}
+
+				cachedAssembly.entries.push_back(cachedEntry);
+			}
+		}
+
+		auto getValue = [](const String& value)
+		{
+			return value.empty() ? String(CACHE_EMPTY_VALUE) : value;
+		};
+
+		String contents;
+		for (auto& cachedAssembly : cache)
+		{
+			contents += "A\t" + cachedAssembly.first + "\t" + toString(cachedAssembly.second.hash) + "\n";
+
+			for (auto& entry : cachedAssembly.second.entries)
+			{
+				if (entry.typeIdx >= NUM_TRACKED_TYPES)
+					continue;
+
+				contents += String("E\t") + TRACKED_TYPES[entry.typeIdx].name + "\t" + getValue(entry.ns) + "\t" + 
+					entry.typeName + "\t" + getValue(entry.methodName) + "\t" + toString(entry.numParams) + "\n";
+			}
+		}
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(cachePath);
+		if (stream == nullptr)
+			return;
+
+		stream->writeString(contents);
+		stream->close();
+	}
+
+	Path ScriptAttributeIndex::getCachePath()
+	{
+		if (!gEditorApplication().isProjectLoaded())
+			return Path::BLANK;
+
+		Path cachePath = gEditorApplication().getProjectPath();
+		cachePath.append(PROJECT_INTERNAL_DIR);
+		cachePath.append(CACHE_FILENAME);
+
+		return cachePath;
+	}
+
+	Path ScriptAttributeIndex::getAssemblyPath(const String& name)
+	{
+		EditorScriptLibrary& library = EditorScriptLibrary::instance();
+
+		if (name == ENGINE_ASSEMBLY)
+			return library.getEngineAssemblyPath();
+		else if (name == EDITOR_ASSEMBLY)
+			return library.getEditorAssemblyPath();
+		else if (name == SCRIPT_GAME_ASSEMBLY)
+			return library.getGameAssemblyPath();
+		else if (name == SCRIPT_EDITOR_ASSEMBLY)
+			return library.getEditorScriptAssemblyPath();
+
+		return Path::BLANK;
+	}
+
+	UINT64 ScriptAttributeIndex::hashFile(const Path& path)
+	{
+		if (path.isEmpty() || !FileSystem::isFile(path))
+			return 0;
+
+		SPtr<DataStream> stream = FileSystem::openFile(path);
+		if (stream == nullptr)
+			return 0;
+
+		const size_t size = stream->size();
+
+		String contents(size, '\0');
+		stream->read(&contents[0], size);
+
+		UINT64 hash = bs_hash(contents);
+		bs_hash_combine(hash, (UINT64)size);
+
+		// Reserve zero for "no hash"
+		return hash != 0 ? hash : 1;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEditorPrerequisites.h"
+#include "Utility/BsModule.h"
+
+namespace bs
+{
+	/** @addtogroup EditorScript
+	 *  @{
+	 */
+
+	/**
+	 * Index of managed classes and methods marked with editor attributes (e.g. MenuItem, CustomInspector), and of classes
+	 * deriving from editor base classes (e.g. EditorWindow), over all script assemblies.
+	 *
+	 * The index is built using a single reflection pass after each domain load, and shared by all the managers looking
+	 * for such types. Results for each assembly are cached in the project folder, keyed by the hash of the assembly file,
+	 * so assemblies that didn't change since the last load don't need to be reflected.
+	 */
+	class BS_SCR_BED_EXPORT ScriptAttributeIndex : public Module<ScriptAttributeIndex>
+	{
+		/** Determines how is a type tracked by the index used. */
+		enum class TrackedTypeKind
+		{
+			ClassAttribute, /**< Attribute placed on classes. */
+			MethodAttribute, /**< Attribute placed on methods. */
+			BaseClass /**< Base class of the classes to track. */
+		};
+
+		/** Editor type tracked by the index. */
+		struct TrackedType
+		{
+			const char* name;
+			TrackedTypeKind kind;
+		};
+
+		/** A single class or method in the index. */
+		struct Entry
+		{
+			UINT32 typeIdx;
+			MonoClass* klass;
+			MonoMethod* method;
+		};
+
+		/** All entries that belong to a single assembly. */
+		struct AssemblyIndex
+		{
+			String name;
+			UINT64 hash;
+			Vector<Entry> entries;
+		};
+
+		/** Index entry as stored in the on-disk cache. */
+		struct CachedEntry
+		{
+			UINT32 typeIdx;
+			String ns;
+			String typeName;
+			String methodName;
+			UINT32 numParams;
+		};
+
+		/** Cached index for a single assembly. */
+		struct CachedAssembly
+		{
+			UINT64 hash;
+			Vector<CachedEntry> entries;
+		};
+
+	public:
+		ScriptAttributeIndex();
+		~ScriptAttributeIndex();
+
+		/** Returns all classes in script assemblies that have the specified attribute. */
+		Vector<MonoClass*> getClassesWithAttribute(MonoClass* attribute);
+
+		/** Returns all methods in script assemblies that have the specified attribute. */
+		Vector<MonoMethod*> getMethodsWithAttribute(MonoClass* attribute);
+
+		/**
+		 * Returns all classes deriving from the specified base class.
+		 *
+		 * @param[in]	baseClass	Class to look for derived classes of. The class itself is not included in the output.
+		 * @param[in]	assembly	Name of the assembly to look in. If empty all script assemblies are searched.
+		 */
+		Vector<MonoClass*> getDerivedClasses(MonoClass* baseClass, const String& assembly = StringUtil::BLANK);
+
+	private:
+		/** Returns entries for the tracked type corresponding to the provided class, building the index if needed. */
+		template<class T>
+		Vector<T*> findEntries(MonoClass* type, TrackedTypeKind kind, T* Entry::*member, const String& assembly);
+
+		/** Adds any script assemblies loaded since the last call to the index. */
+		void build();
+
+		/** Clears the index. Called when the domain unloads, as all the referenced classes and methods go away. */
+		void clear();
+
+		/** Finds all the tracked types in the provided assembly using reflection. */
+		void reflectAssembly(MonoAssembly* assembly, AssemblyIndex& output) const;
+
+		/**
+		 * Resolves previously cached entries for the provided assembly. Returns false if any of the entries could not be
+		 * resolved, in which case the assembly should be reflected instead.
+		 */
+		bool resolveCachedAssembly(MonoAssembly* assembly, const CachedAssembly& cached, AssemblyIndex& output) const;
+
+		/** Loads the cached index from the project folder. */
+		UnorderedMap<String, CachedAssembly> loadCache() const;
+
+		/**
+		 * Updates the provided cache with the current index, and saves it to the project folder. Cached entries for
+		 * assemblies that are not currently loaded are preserved.
+		 */
+		void saveCache(UnorderedMap<String, CachedAssembly>& cache) const;
+
+		/** Returns the path of the file the cached index is stored in. Empty if no project is loaded. */
+		static Path getCachePath();
+
+		/** Returns the path to the file of the assembly with the specified name, or empty if not known. */
+		static Path getAssemblyPath(const String& name);
+
+		/** Calculates a hash of the contents of the file at the specified path. Returns 0 if the file doesn't exist. */
+		static UINT64 hashFile(const Path& path);
+
+		static const TrackedType TRACKED_TYPES[];
+		static const UINT32 NUM_TRACKED_TYPES;
+		static const char* CACHE_FILENAME;
+
+		Vector<MonoClass*> mTrackedClasses;
+		Vector<AssemblyIndex> mAssemblies;
+
+		HEvent mDomainUnloadConn;
+	};
+
+	/** @} */
+}
\ No newline at end of file
@@ -17,6 +17,8 @@
 #include "BsScriptGameObjectManager.h"
 #include "Wrappers/BsScriptComponent.h"
 #include "Wrappers/BsScriptSelection.h"
+#include "BsScriptAttributeIndex.h"
+#include "Utility/BsEditorProfiler.h"
 
 using namespace std::placeholders;
 
@@ -43,6 +45,8 @@ namespace bs
 
 	void ScriptGizmoManager::update()
 	{
+		BS_ED_PROFILE_SCOPE("ScriptGizmoManager::update");
+
 		GizmoManager::instance().clearGizmos();
 
 		HSceneObject rootSO = SceneManager::instance().getMainScene()->getRoot();
@@ -160,37 +164,36 @@ namespace bs
 
 		mGizmoDrawers.clear();
 
-		Vector<String> scriptAssemblyNames = mScriptObjectManager.getScriptAssemblies();
-		for (auto& assemblyName : scriptAssemblyNames)
-		{
-			MonoAssembly* assembly = MonoManager::instance().getAssembly(assemblyName);
+		ScriptAttributeIndex& attributeIndex = ScriptAttributeIndex::instance();
 
-			// Find new gizmo drawer & selection changed methods
-			const Vector<MonoClass*>& allClasses = assembly->getAllClasses();
-			for (auto curClass : allClasses)
+		// Find new gizmo drawer methods
+		Vector<MonoMethod*> drawGizmoMethods = attributeIndex.getMethodsWithAttribute(mDrawGizmoAttribute);
+		for (auto& curMethod : drawGizmoMethods)
+		{
+			UINT32 drawGizmoFlags = 0;
+			MonoClass* componentType = nullptr;
+			if (isValidDrawGizmoMethod(curMethod, componentType, drawGizmoFlags))
 			{
-				const Vector<MonoMethod*>& methods = curClass->getAllMethods();
-				for (auto& curMethod : methods)
-				{
-					UINT32 drawGizmoFlags = 0;
-					MonoClass* componentType = nullptr;
-					if (isValidDrawGizmoMethod(curMethod, componentType, drawGizmoFlags))
-					{
-						String fullComponentName = componentType->getFullName();
-						SmallVector<GizmoData, 2>& entries = mGizmoDrawers[fullComponentName];
+				String fullComponentName = componentType->getFullName();
+				SmallVector<GizmoData, 2>& entries = mGizmoDrawers[fullComponentName];
 
-						GizmoData data{componentType, curMethod, drawGizmoFlags};
-						entries.add(data);
-					}
-					else if(isValidOnSelectionChangedMethod(curMethod, componentType))
-					{
-						String fullComponentName = componentType->getFullName();
-						SelectionChangedData& data = mSelectionChangedCallbacks[fullComponentName];
+				GizmoData data{componentType, curMethod, drawGizmoFlags};
+				entries.add(data);
+			}
+		}
 
-						data.type = componentType;
-						data.method = curMethod;
-					}
-				}
+		// Find new selection changed methods
+		Vector<MonoMethod*> selectionChangedMethods = attributeIndex.getMethodsWithAttribute(mOnSelectionChangedAttribute);
+		for (auto& curMethod : selectionChangedMethods)
+		{
+			MonoClass* componentType = nullptr;
+			if(isValidOnSelectionChangedMethod(curMethod, componentType))
+			{
+				String fullComponentName = componentType->getFullName();
+				SelectionChangedData& data = mSelectionChangedCallbacks[fullComponentName];
+
+				data.type = componentType;
+				data.method = curMethod;
 			}
 		}
 	}
@@ -12,6 +12,7 @@
 #include "Scene/BsSceneObject.h"
 #include "BsManagedComponent.h"
 #include "BsScriptObjectManager.h"
+#include "BsScriptAttributeIndex.h"
 
 using namespace std::placeholders;
 
@@ -203,33 +204,27 @@ namespace bs
 		mDrawMethod = mHandleBaseClass->getMethod("Draw", 0);
 		mDestroyThunk = (DestroyThunkDef)mHandleBaseClass->getMethod("Destroy", 0)->getThunk();
 
-		Vector<String> scriptAssemblyNames = mScriptObjectManager.getScriptAssemblies();
-		for (auto& assemblyName : scriptAssemblyNames)
+		// Find new custom handle types
+		Vector<MonoClass*> handleClasses = ScriptAttributeIndex::instance().getClassesWithAttribute(mCustomHandleAttribute);
+		for (auto curClass : handleClasses)
 		{
-			MonoAssembly* assembly = MonoManager::instance().getAssembly(assemblyName);
+			MonoClass* componentType = nullptr;
+			MonoMethod* ctor = nullptr;
 
-			// Find new custom handle types
-			const Vector<MonoClass*>& allClasses = assembly->getAllClasses();
-			for (auto curClass : allClasses)
+			if (isValidHandleType(curClass, componentType, ctor))
 			{
-				MonoClass* componentType = nullptr;
-				MonoMethod* ctor = nullptr;
+				if (componentType != nullptr)
+				{
+					String fullComponentName = componentType->getFullName();
+					CustomHandleData& newHandleData = mHandles[fullComponentName];
 
-				if (isValidHandleType(curClass, componentType, ctor))
+					newHandleData.componentType = componentType;
+					newHandleData.handleType = curClass;
+					newHandleData.ctor = ctor;
+				}
+				else // Global handle
 				{
-					if (componentType != nullptr)
-					{
-						String fullComponentName = componentType->getFullName();
-						CustomHandleData& newHandleData = mHandles[fullComponentName];
-
-						newHandleData.componentType = componentType;
-						newHandleData.handleType = curClass;
-						newHandleData.ctor = ctor;
-					}
-					else // Global handle
-					{
-						mGlobalHandlesToCreate.push_back(curClass);
-					}
+					mGlobalHandlesToCreate.push_back(curClass);
 				}
 			}
 		}
@@ -1,6 +1,7 @@
 //********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsToolbarItemManager.h"
+#include "BsScriptAttributeIndex.h"
 #include "Serialization/BsScriptAssemblyManager.h"
 #include "BsMonoAssembly.h"
 #include "BsMonoClass.h"
@@ -62,40 +63,30 @@ namespace bs
 
 		MainEditorWindow* mainWindow = EditorWindowManager::instance().getMainWindow();
 
-		Vector<String> scriptAssemblyNames = mScriptObjectManager.getScriptAssemblies();
-		for (auto& assemblyName : scriptAssemblyNames)
+		// Find new toolbar item methods
+		Vector<MonoMethod*> methods = ScriptAttributeIndex::instance().getMethodsWithAttribute(mToolbarItemAttribute);
+		for (auto& curMethod : methods)
 		{
-			MonoAssembly* assembly = MonoManager::instance().getAssembly(assemblyName);
-
-			// Find new menu item methods
-			const Vector<MonoClass*>& allClasses = assembly->getAllClasses();
-			for (auto curClass : allClasses)
+			String name;
+			HSpriteTexture icon;
+			HString tooltip;
+			INT32 priority = 0;
+			bool separator = false;
+			if (parseToolbarItemMethod(curMethod, name, icon, tooltip, priority, separator))
 			{
-				const Vector<MonoMethod*>& methods = curClass->getAllMethods();
-				for (auto& curMethod : methods)
+				std::function<void()> callback = std::bind(&ToolbarItemManager::toolbarItemCallback, curMethod);
+
+				if (separator)
 				{
-					String name;
-					HSpriteTexture icon;
-					HString tooltip;
-					INT32 priority = 0;
-					bool separator = false;
-					if (parseToolbarItemMethod(curMethod, name, icon, tooltip, priority, separator))
-					{
-						std::function<void()> callback = std::bind(&ToolbarItemManager::toolbarItemCallback, curMethod);
-
-						if (separator)
-						{
-							String sepName = "s__" + name;
-
-							mainWindow->getMenuBar().addToolBarSeparator(sepName, priority);
-							mToolbarItems.push_back(sepName);
-						}
-
-						GUIContent content(icon, tooltip);
-						mainWindow->getMenuBar().addToolBarButton(name, content, callback, priority);
-						mToolbarItems.push_back(name);
-					}
+					String sepName = "s__" + name;
+
+					mainWindow->getMenuBar().addToolBarSeparator(sepName, priority);
+					mToolbarItems.push_back(sepName);
 				}
+
+				GUIContent content(icon, tooltip);
+				mainWindow->getMenuBar().addToolBarButton(name, content, callback, priority);
+				mToolbarItems.push_back(name);
 			}
 		}
 	}
@@ -12,6 +12,7 @@ set(BS_EDITORSCRIPT_INC_NOFILTER
 	"BsToolbarItemManager.h"
 	"BsScriptGizmoManager.h"
 	"BsManagedEditorCommand.h"
+	"BsScriptAttributeIndex.h"
 )
 
 set(BS_EDITORSCRIPT_SRC_WRAPPERS_GUI
@@ -81,6 +82,7 @@ set(BS_EDITORSCRIPT_SRC_NOFILTER
 	"BsEditorScriptLibrary.cpp"
 	"BsToolbarItemManager.cpp"
 	"BsManagedEditorCommand.cpp"
+	"BsScriptAttributeIndex.cpp"
 )
 
 set(BS_EDITORSCRIPT_INC_WRAPPERS
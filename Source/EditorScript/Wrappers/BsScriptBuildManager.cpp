@@ -21,6 +21,7 @@
 #include "Scene/BsSceneObject.h"
 #include "Debug/BsDebug.h"
 #include "Resources/BsGameResourceManager.h"
+#include "Build/BsBuildManifest.h"
 
 namespace bs
 {
@@ -43,6 +44,9 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_InjectIcons", (void*)&ScriptBuildManager::internal_InjectIcons);
 		metaData.scriptClass->addInternalCall("Internal_PackageResources", (void*)&ScriptBuildManager::internal_PackageResources);
 		metaData.scriptClass->addInternalCall("Internal_CreateStartupSettings", (void*)&ScriptBuildManager::internal_CreateStartupSettings);
+		metaData.scriptClass->addInternalCall("Internal_BeginBuild", (void*)&ScriptBuildManager::internal_BeginBuild);
+		metaData.scriptClass->addInternalCall("Internal_CopyToBuild", (void*)&ScriptBuildManager::internal_CopyToBuild);
+		metaData.scriptClass->addInternalCall("Internal_EndBuild", (void*)&ScriptBuildManager::internal_EndBuild);
 	}
 
 	MonoArray* ScriptBuildManager::internal_GetAvailablePlatforms()
@@ -225,191 +229,13 @@ namespace bs
 
 	void ScriptBuildManager::internal_PackageResources(MonoString* buildFolder, ScriptPlatformInfo* info)
 	{
-		UnorderedSet<Path> usedResources;
-		SPtr<ResourceMapping> resourceMap = ResourceMapping::create();
-
-		// Get all resources manually included in build
-		Vector<USPtr<ProjectLibrary::FileEntry>> buildResources = gProjectLibrary().getResourcesForBuild();
-		for (auto& entry : buildResources)
-		{
-			if (entry->meta == nullptr)
-			{
-				BS_LOG(Warning, Editor, "Cannot include resource in build, missing meta file for: {0}", entry->path);
-				continue;
-			}
-
-			auto& resourceMetas = entry->meta->getResourceMetaData();
-			for(auto& resMeta : resourceMetas)
-			{
-				Path resourcePath;
-				if (gResources().getFilePathFromUUID(resMeta->getUUID(), resourcePath))
-					usedResources.insert(resourcePath);
-				else
-					BS_LOG(Warning, Editor, "Cannot include resource in build, missing imported asset for: {0}", entry->path);
-			}
-		}
-
-		// Include main scene
 		SPtr<PlatformInfo> platformInfo;
 
 		if (info != nullptr)
 			platformInfo = info->getPlatformInfo();
 
-		if (platformInfo != nullptr)
-		{
-			Path resourcePath;
-			if (gResources().getFilePathFromUUID(platformInfo->mainScene.getUUID(), resourcePath))
-				usedResources.insert(resourcePath);
-			else
-				BS_LOG(Warning, Editor, "Cannot include main scene in build, missing imported asset.");
-		}
-
-		// Find dependencies of all resources
-		Vector<Path> newResources;
-		for (auto& entry : usedResources)
-			newResources.push_back(entry);
-
-		while (!newResources.empty())
-		{
-			Vector<Path> allDependencies;
-			for (auto& entry : newResources)
-			{
-				Vector<UUID> curDependencies = gResources().getDependencies(entry);
-				for (auto& entry : curDependencies)
-				{
-					Path resourcePath;
-					if (gResources().getFilePathFromUUID(entry, resourcePath))
-					{
-						if (usedResources.find(resourcePath) == usedResources.end())
-						{
-							allDependencies.push_back(resourcePath);
-							usedResources.insert(resourcePath);
-						}
-					}
-				}
-			}
-
-			newResources = allDependencies;
-		} 
-
-		// Copy resources
 		Path buildPath = MonoUtil::monoToString(buildFolder);
-
-		Path outputPath = buildPath;
-		outputPath.append(GAME_RESOURCES_FOLDER_NAME);
-
-		FileSystem::createDir(outputPath);
-
-		Path libraryDir = gProjectLibrary().getResourcesFolder();
-		for (auto& entry : usedResources)
-		{
-			UUID uuid;
-
-			const bool found = gResources().getUUIDFromFilePath(entry, uuid);
-			BS_ASSERT(found);
-
-			Path sourcePath = gProjectLibrary().uuidToPath(uuid);
-			if (sourcePath.isEmpty()) // Resource not part of library, meaning its built-in and we don't need to copy those here
-				continue;
-
-			SPtr<ProjectResourceMeta> resMeta = gProjectLibrary().findResourceMeta(sourcePath);
-			assert(resMeta != nullptr);
-
-			Path destPath = outputPath;
-			destPath.setFilename(entry.getFilename());
-
-			// Create library -> packaged resource mapping
-			Path relSourcePath = sourcePath;
-			if (sourcePath.isAbsolute())
-				relSourcePath.makeRelative(libraryDir);
-
-			Path relDestPath = GAME_RESOURCES_FOLDER_NAME;
-			relDestPath.setFilename(entry.getFilename());
-
-			resourceMap->add(relSourcePath, relDestPath);
-
-			// If resource is prefab make sure to update it in case any of the prefabs it is referencing changed
-			if (resMeta->getTypeID() == TID_Prefab)
-			{
-				bool reload = gResources().isLoaded(uuid);
-
-				HPrefab prefab = static_resource_cast<Prefab>(gProjectLibrary().load(sourcePath));
-				prefab->_updateChildInstances();
-
-				// Clear prefab diffs as they're not used in standalone
-				Stack<HSceneObject> todo;
-				todo.push(prefab->_getRoot());
-
-				while (!todo.empty())
-				{
-					HSceneObject current = todo.top();
-					todo.pop();
-
-					current->_clearPrefabDiff();
-
-					UINT32 numChildren = current->getNumChildren();
-					for (UINT32 i = 0; i < numChildren; i++)
-					{
-						HSceneObject child = current->getChild(i);
-						todo.push(child);
-					}
-				}
-
-				gResources().save(prefab, destPath, false);
-
-				// Need to unload this one as we modified it in memory, and we don't want to persist those changes past
-				// this point
-				gResources().release(prefab);
-
-				if (reload)
-					gProjectLibrary().load(sourcePath);
-			}
-			else
-				FileSystem::copy(entry, destPath);
-		}
-
-		// Save icon
-		Path iconFolder = BuiltinResources::getIconFolder();
-
-		Path sourceRoot = BuildManager::instance().getBuildFolder(BuildFolder::SourceRoot, platformInfo->type);
-		iconFolder.makeRelative(sourceRoot);
-
-		Path destRoot = BuildManager::instance().getBuildFolder(BuildFolder::DestinationRoot, platformInfo->type);
-		Path destIconFile = destRoot;
-		destIconFile.append(iconFolder);
-		destIconFile.setFilename(String(BuiltinResources::IconTextureName) + ".asset");
-
-		switch (platformInfo->type)
-		{
-		case PlatformType::Windows:
-		{
-			SPtr<WinPlatformInfo> winPlatformInfo = std::static_pointer_cast<WinPlatformInfo>(platformInfo);
-			
-			HTexture icon = static_resource_cast<Texture>(gResources().loadFromUUID(winPlatformInfo->icon.getUUID()));
-			if (icon != nullptr)
-				gResources().save(icon, destIconFile, true);
-		}
-			break;
-		default:
-			break;
-		};
-
-		// Save manifest
-		Path manifestPath = outputPath;
-		manifestPath.append(GAME_RESOURCE_MANIFEST_NAME);
-
-		Path internalResourcesFolder = gEditorApplication().getProjectPath();
-		internalResourcesFolder.append(PROJECT_INTERNAL_DIR);
-
-		SPtr<ResourceManifest> manifest = gProjectLibrary()._getManifest();
-		ResourceManifest::save(manifest, manifestPath, internalResourcesFolder);
-
-		// Save resource map
-		Path mappingPath = outputPath;
-		mappingPath.append(GAME_RESOURCE_MAPPING_NAME);
-
-		FileEncoder fe(mappingPath);
-		fe.encode(resourceMap.get());
+		BuildManager::instance().packageResources(buildPath, platformInfo);
 	}
 
 	void ScriptBuildManager::internal_CreateStartupSettings(MonoString* buildFolder, ScriptPlatformInfo* info)
@@ -419,32 +245,26 @@ namespace bs
 		if (info != nullptr)
 			platformInfo = info->getPlatformInfo();
 
-		SPtr<GameSettings> gameSettings;
-		if (platformInfo != nullptr)
-		{
-			gameSettings = bs_shared_ptr_new<GameSettings>();
-			gameSettings->mainSceneUUID = platformInfo->mainScene.getUUID();
-			gameSettings->fullscreen = platformInfo->fullscreen;
-			gameSettings->resolutionWidth = platformInfo->windowedWidth;
-			gameSettings->resolutionHeight = platformInfo->windowedHeight;
+		Path buildPath = MonoUtil::monoToString(buildFolder);
+		BuildManager::instance().createStartupSettings(buildPath, platformInfo);
+	}
 
-			switch (platformInfo->type)
-			{
-			case(PlatformType::Windows) :
-			{
-				SPtr<WinPlatformInfo> winPlatformInfo = std::static_pointer_cast<WinPlatformInfo>(platformInfo);
-				gameSettings->titleBarText = winPlatformInfo->titlebarText;
-			}
-				break;
-			default:
-				break;
-			}
-		}
+	void ScriptBuildManager::internal_BeginBuild(MonoString* destinationRoot)
+	{
+		Path destinationRootPath = MonoUtil::monoToString(destinationRoot);
+		BuildManager::instance().beginBuild(destinationRootPath);
+	}
 
-		Path outputPath = MonoUtil::monoToString(buildFolder);
-		outputPath.append(GAME_SETTINGS_NAME);
+	void ScriptBuildManager::internal_CopyToBuild(MonoString* source, MonoString* destination)
+	{
+		Path sourcePath = MonoUtil::monoToString(source);
+		Path destinationPath = MonoUtil::monoToString(destination);
 
-		FileEncoder fe(outputPath);
-		fe.encode(gameSettings.get());
+		BuildManager::instance().copyToBuild(sourcePath, destinationPath);
+	}
+
+	void ScriptBuildManager::internal_EndBuild()
+	{
+		BuildManager::instance().endBuild();
 	}
 }
@@ -50,6 +50,9 @@ namespace bs
 		static void internal_InjectIcons(MonoString* filePath, ScriptPlatformInfo* info);
 		static void internal_PackageResources(MonoString* buildFolder, ScriptPlatformInfo* info);
 		static void internal_CreateStartupSettings(MonoString* buildFolder, ScriptPlatformInfo* info);
+		static void internal_BeginBuild(MonoString* destinationRoot);
+		static void internal_CopyToBuild(MonoString* source, MonoString* destination);
+		static void internal_EndBuild();
 	};
 
 	/** @} */
@@ -22,6 +22,7 @@ namespace bs
 	void ScriptCodeEditor::initRuntimeData()
 	{
 		metaData.scriptClass->addInternalCall("Internal_SetActiveEditor", (void*)&ScriptCodeEditor::internal_SetActiveEditor);
+		metaData.scriptClass->addInternalCall("Internal_SetPreferredEditor", (void*)&ScriptCodeEditor::internal_SetPreferredEditor);
 		metaData.scriptClass->addInternalCall("Internal_GetActiveEditor", (void*)&ScriptCodeEditor::internal_GetActiveEditor);
 		metaData.scriptClass->addInternalCall("Internal_GetAvailableEditors", (void*)&ScriptCodeEditor::internal_GetAvailableEditors);
 		metaData.scriptClass->addInternalCall("Internal_OpenFile", (void*)&ScriptCodeEditor::internal_OpenFile);
@@ -39,6 +40,11 @@ namespace bs
 		CodeEditorManager::instance().setActive(type);
 	}
 
+	void ScriptCodeEditor::internal_SetPreferredEditor(CodeEditorType type)
+	{
+		CodeEditorManager::instance().setPreferred(type);
+	}
+
 	MonoArray* ScriptCodeEditor::internal_GetAvailableEditors()
 	{
 		Vector<CodeEditorType> availableEditors = CodeEditorManager::instance().getAvailableEditors();
@@ -24,6 +24,7 @@ namespace bs
 		/* 								CLR HOOKS						   		*/
 		/************************************************************************/
 		static void internal_SetActiveEditor(CodeEditorType type);
+		static void internal_SetPreferredEditor(CodeEditorType type);
 		static CodeEditorType internal_GetActiveEditor();
 		static MonoArray* internal_GetAvailableEditors();
 		static void internal_OpenFile(MonoString* path, UINT32 line);
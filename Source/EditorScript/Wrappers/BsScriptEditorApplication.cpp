@@ -25,6 +25,7 @@
 
 #include "Generated/BsScriptRenderTexture.generated.h"
 #include "BsEditorScriptLibrary.h"
+#include "Utility/BsEditorProfiler.h"
 
 namespace bs
 {
@@ -60,6 +61,7 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_GetScriptGameAssemblyName", (void*)&ScriptEditorApplication::internal_GetScriptGameAssemblyName);
 		metaData.scriptClass->addInternalCall("Internal_GetScriptEditorAssemblyName", (void*)&ScriptEditorApplication::internal_GetScriptEditorAssemblyName);
 		metaData.scriptClass->addInternalCall("Internal_SaveScene", (void*)&ScriptEditorApplication::internal_SaveScene);
+		metaData.scriptClass->addInternalCall("Internal_WaitForSceneSave", (void*)&ScriptEditorApplication::internal_WaitForSceneSave);
 		metaData.scriptClass->addInternalCall("Internal_IsValidProject", (void*)&ScriptEditorApplication::internal_IsValidProject);
 		metaData.scriptClass->addInternalCall("Internal_SaveProject", (void*)&ScriptEditorApplication::internal_SaveProject);
 		metaData.scriptClass->addInternalCall("Internal_LoadProject", (void*)&ScriptEditorApplication::internal_LoadProject);
@@ -72,6 +74,10 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_ToggleToolbarItem", (void*)&ScriptEditorApplication::internal_ToggleToolbarItem);
 		metaData.scriptClass->addInternalCall("Internal_SetMainRenderTarget", (void*)&ScriptEditorApplication::internal_SetMainRenderTarget);
 		metaData.scriptClass->addInternalCall("Internal_HasFocus", (void*)&ScriptEditorApplication::internal_HasFocus);
+		metaData.scriptClass->addInternalCall("Internal_Invalidate", (void*)&ScriptEditorApplication::internal_Invalidate);
+		metaData.scriptClass->addInternalCall("Internal_SetContinuousUpdate", (void*)&ScriptEditorApplication::internal_SetContinuousUpdate);
+		metaData.scriptClass->addInternalCall("Internal_GetSkippedFrameCount", (void*)&ScriptEditorApplication::internal_GetSkippedFrameCount);
+		metaData.scriptClass->addInternalCall("Internal_SaveProfilerTrace", (void*)&ScriptEditorApplication::internal_SaveProfilerTrace);
 
 		onProjectLoadedThunk = (OnProjectLoadedThunkDef)metaData.scriptClass->getMethod("Internal_OnProjectLoaded")->getThunk();
 		onStatusBarClickedThunk = (OnStatusBarClickedThunkDef)metaData.scriptClass->getMethod("Internal_OnStatusBarClicked")->getThunk();
@@ -106,6 +112,10 @@ namespace bs
 			ScriptManager::instance().reload();
 			mRequestAssemblyReload = false;
 		}
+
+		MainEditorWindow* mainWindow = EditorWindowManager::instance().getMainWindow();
+		if (mainWindow != nullptr)
+			mainWindow->getStatusBar().setIsSaving(gProjectLibrary().getInProgressSaveCount() > 0);
 	}
 
 	void ScriptEditorApplication::onStatusBarClicked()
@@ -224,7 +234,7 @@ namespace bs
 		return MonoUtil::stringToMono(String(SCRIPT_EDITOR_ASSEMBLY) + ".dll");
 	}
 
-	MonoObject* ScriptEditorApplication::internal_SaveScene(MonoString* path)
+	MonoObject* ScriptEditorApplication::internal_SaveScene(MonoString* path, bool async)
 	{
 		Path nativePath = MonoUtil::monoToString(path);
 		HSceneObject sceneRoot = gSceneManager().getMainScene()->getRoot();
@@ -236,10 +246,14 @@ namespace bs
 			if (resMeta->getTypeID() != TID_Prefab)
 				return nullptr;
 
+			// Loading waits for any previous save of the prefab to finish, as it must not be modified until then
 			scene = static_resource_cast<Prefab>(gProjectLibrary().load(nativePath));
+
+			// Updating the prefab clones the scene hierarchy, so the prefab acts as a snapshot that is independent of any
+			// further scene edits while the save is in progress
 			scene->update(sceneRoot);
 
-			gProjectLibrary().saveEntry(scene);
+			gProjectLibrary().saveEntry(scene, !async);
 		}
 		else
 		{
@@ -251,6 +265,11 @@ namespace bs
 		return scriptPrefab->getManagedInstance();
 	}
 
+	void ScriptEditorApplication::internal_WaitForSceneSave()
+	{
+		gProjectLibrary().waitForQueuedSaves();
+	}
+
 	bool ScriptEditorApplication::internal_IsValidProject(MonoString* path)
 	{
 		Path nativePath = MonoUtil::monoToString(path);
@@ -331,4 +350,27 @@ namespace bs
 	{
 		return EditorWindowManager::instance().hasFocus();
 	}
+
+	void ScriptEditorApplication::internal_Invalidate()
+	{
+		gEditorApplication().invalidate();
+	}
+
+	void ScriptEditorApplication::internal_SetContinuousUpdate(bool enabled)
+	{
+		gEditorApplication().setContinuousUpdate(enabled);
+	}
+
+	UINT64 ScriptEditorApplication::internal_GetSkippedFrameCount()
+	{
+		return gEditorApplication().getNumSkippedFrames();
+	}
+
+	MonoString* ScriptEditorApplication::internal_SaveProfilerTrace(MonoString* path, UINT32 numFrames)
+	{
+		Path nativePath = MonoUtil::monoToString(path);
+		String summary = EditorProfiler::instance().dumpTrace(nativePath, numFrames);
+
+		return MonoUtil::stringToMono(summary);
+	}
 }
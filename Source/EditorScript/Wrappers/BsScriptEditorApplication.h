@@ -23,7 +23,7 @@ namespace bs
 		/**	Unregisters internal callbacks. Must be called on scripting system shutdown. */
 		static void shutDown();
 
-		/**	Called every frame. Triggers delayed project load. */
+		/**	Called every frame. Triggers delayed project load and updates the background save status. */
 		 static void update();
 
 	private:
@@ -57,7 +57,8 @@ namespace bs
 		static MonoString* internal_GetEditorAssemblyName();
 		static MonoString* internal_GetScriptGameAssemblyName();
 		static MonoString* internal_GetScriptEditorAssemblyName();
-		static MonoObject* internal_SaveScene(MonoString* path);
+		static MonoObject* internal_SaveScene(MonoString* path, bool async);
+		static void internal_WaitForSceneSave();
 		static bool internal_IsValidProject(MonoString* path);
 		static void internal_SaveProject();
 		static void internal_LoadProject(MonoString* path);
@@ -75,6 +76,10 @@ namespace bs
 		static void internal_FrameStep();
 		static void internal_SetMainRenderTarget(ScriptRenderTarget* renderTarget);
 		static bool internal_HasFocus();
+		static void internal_Invalidate();
+		static void internal_SetContinuousUpdate(bool enabled);
+		static UINT64 internal_GetSkippedFrameCount();
+		static MonoString* internal_SaveProfilerTrace(MonoString* path, UINT32 numFrames);
 
 		typedef void(BS_THUNKCALL *OnProjectLoadedThunkDef)(MonoException**);
 		typedef void(BS_THUNKCALL *OnStatusBarClickedThunkDef) (MonoException**);
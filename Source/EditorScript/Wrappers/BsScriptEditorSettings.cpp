@@ -37,6 +37,10 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_SetActivePivotMode", (void*)&ScriptEditorSettings::internal_SetActivePivotMode);
 		metaData.scriptClass->addInternalCall("Internal_GetFPSLimit", (void*)&ScriptEditorSettings::internal_GetFPSLimit);
 		metaData.scriptClass->addInternalCall("Internal_SetFPSLimit", (void*)&ScriptEditorSettings::internal_SetFPSLimit);
+		metaData.scriptClass->addInternalCall("Internal_GetIdleFPSLimit", (void*)&ScriptEditorSettings::internal_GetIdleFPSLimit);
+		metaData.scriptClass->addInternalCall("Internal_SetIdleFPSLimit", (void*)&ScriptEditorSettings::internal_SetIdleFPSLimit);
+		metaData.scriptClass->addInternalCall("Internal_GetImportWorkerCount", (void*)&ScriptEditorSettings::internal_GetImportWorkerCount);
+		metaData.scriptClass->addInternalCall("Internal_SetImportWorkerCount", (void*)&ScriptEditorSettings::internal_SetImportWorkerCount);
 		metaData.scriptClass->addInternalCall("Internal_GetMouseSensitivity", (void*)&ScriptEditorSettings::internal_GetMouseSensitivity);
 		metaData.scriptClass->addInternalCall("Internal_SetMouseSensitivity", (void*)&ScriptEditorSettings::internal_SetMouseSensitivity);
 		metaData.scriptClass->addInternalCall("Internal_GetLastOpenProject", (void*)&ScriptEditorSettings::internal_GetLastOpenProject);
@@ -170,6 +174,30 @@ namespace bs
 		settings->setFPSLimit(value);
 	}
 
+	UINT32 ScriptEditorSettings::internal_GetIdleFPSLimit()
+	{
+		SPtr<EditorSettings> settings = gEditorApplication().getEditorSettings();
+		return settings->getIdleFPSLimit();
+	}
+
+	void ScriptEditorSettings::internal_SetIdleFPSLimit(UINT32 value)
+	{
+		SPtr<EditorSettings> settings = gEditorApplication().getEditorSettings();
+		settings->setIdleFPSLimit(value);
+	}
+
+	UINT32 ScriptEditorSettings::internal_GetImportWorkerCount()
+	{
+		SPtr<EditorSettings> settings = gEditorApplication().getEditorSettings();
+		return settings->getImportWorkerCount();
+	}
+
+	void ScriptEditorSettings::internal_SetImportWorkerCount(UINT32 value)
+	{
+		SPtr<EditorSettings> settings = gEditorApplication().getEditorSettings();
+		settings->setImportWorkerCount(value);
+	}
+
 	float ScriptEditorSettings::internal_GetMouseSensitivity()
 	{
 		SPtr<EditorSettings> settings = gEditorApplication().getEditorSettings();
@@ -41,6 +41,10 @@ namespace bs
 		static void internal_SetActivePivotMode(UINT32 value);
 		static UINT32 internal_GetFPSLimit();
 		static void internal_SetFPSLimit(UINT32 value);
+		static UINT32 internal_GetIdleFPSLimit();
+		static void internal_SetIdleFPSLimit(UINT32 value);
+		static UINT32 internal_GetImportWorkerCount();
+		static void internal_SetImportWorkerCount(UINT32 value);
 		static float internal_GetMouseSensitivity();
 		static void internal_SetMouseSensitivity(float value);
 
@@ -17,6 +17,7 @@
 #include "Platform/BsPlatform.h"
 #include "Input/BsInput.h"
 #include "Wrappers/BsScriptUndoRedo.h"
+#include "BsScriptAttributeIndex.h"
 
 #include "Generated/BsScriptHString.generated.h"
 
@@ -319,29 +320,27 @@ namespace bs
 
 			MonoClass* editorWindowClass = assembly->getClass(EDITOR_NS, "EditorWindow");
 
-			const Vector<MonoClass*>& allClasses = assembly->getAllClasses();
-			for(auto& curClass : allClasses)
+			Vector<MonoClass*> windowClasses = 
+				ScriptAttributeIndex::instance().getDerivedClasses(editorWindowClass, EDITOR_ASSEMBLY);
+			for(auto& curClass : windowClasses)
 			{
-				if(curClass->isSubClassOf(editorWindowClass) && curClass != editorWindowClass)
-				{
-					UINT32 width = 400;
-					UINT32 height = 400;
+				UINT32 width = 400;
+				UINT32 height = 400;
 
-					MonoObject* defaultSize = curClass->getAttribute(defaultSizeAttrib);
-					if (defaultSize != nullptr)
-					{
-						defaultWidthField->get(defaultSize, &width);
-						defaultHeightField->get(defaultSize, &height);
-					}
+				MonoObject* defaultSize = curClass->getAttribute(defaultSizeAttrib);
+				if (defaultSize != nullptr)
+				{
+					defaultWidthField->get(defaultSize, &width);
+					defaultHeightField->get(defaultSize, &height);
+				}
 
-					bool hasLocalUndoRedo = curClass->getAttribute(undoRedoLocalAttrib) != nullptr;
+				bool hasLocalUndoRedo = curClass->getAttribute(undoRedoLocalAttrib) != nullptr;
 
-					const String& className = curClass->getFullName();
-					EditorWidgetManager::instance().registerWidget(className, 
-						std::bind(&ScriptEditorWindow::openEditorWidgetCallback, curClass->getNamespace(), 
-						curClass->getTypeName(), width, height, hasLocalUndoRedo, _1));
-					AvailableWindowTypes.push_back(className);
-				}
+				const String& className = curClass->getFullName();
+				EditorWidgetManager::instance().registerWidget(className, 
+					std::bind(&ScriptEditorWindow::openEditorWidgetCallback, curClass->getNamespace(), 
+					curClass->getTypeName(), width, height, hasLocalUndoRedo, _1));
+				AvailableWindowTypes.push_back(className);
 			}
 		}
 	}
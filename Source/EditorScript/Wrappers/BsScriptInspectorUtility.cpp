@@ -10,6 +10,7 @@
 #include "BsScriptObjectManager.h"
 #include "Wrappers/BsScriptResource.h"
 #include "Wrappers/BsScriptComponent.h"
+#include "BsScriptAttributeIndex.h"
 
 namespace bs
 {
@@ -71,45 +72,38 @@ namespace bs
 
 		mTypeField = mCustomInspectorAtribute->getField("type");
 
-		ScriptAssemblyManager& sam = ScriptAssemblyManager::instance();
-
-		Vector<String> scriptAssemblyNames = sam.getScriptAssemblies();
-		for (auto& assemblyName : scriptAssemblyNames)
+		// Find new classes/structs with the custom inspector attribute
+		Vector<MonoClass*> inspectorClasses = 
+			ScriptAttributeIndex::instance().getClassesWithAttribute(mCustomInspectorAtribute);
+		for (auto curClass : inspectorClasses)
 		{
-			MonoAssembly* assembly = MonoManager::instance().getAssembly(assemblyName);
+			MonoObject* attrib = curClass->getAttribute(mCustomInspectorAtribute);
+			if (attrib == nullptr)
+				continue;
 
-			// Find new classes/structs with the custom inspector attribute
-			const Vector<MonoClass*>& allClasses = assembly->getAllClasses();
-			for (auto curClass : allClasses)
-			{
-				MonoObject* attrib = curClass->getAttribute(mCustomInspectorAtribute);
-				if (attrib == nullptr)
-					continue;
+			// Check if the attribute references a valid class
+			MonoReflectionType* referencedReflType = nullptr;
+			mTypeField->get(attrib, &referencedReflType);
 
-				// Check if the attribute references a valid class
-				MonoReflectionType* referencedReflType = nullptr;
-				mTypeField->get(attrib, &referencedReflType);
+			::MonoClass* referencedMonoClass = MonoUtil::getClass(referencedReflType);
 
-				::MonoClass* referencedMonoClass = MonoUtil::getClass(referencedReflType);
-
-				MonoClass* referencedClass = MonoManager::instance().findClass(referencedMonoClass);
-				if (referencedClass == nullptr)
-					continue;
+			MonoClass* referencedClass = MonoManager::instance().findClass(referencedMonoClass);
+			if (referencedClass == nullptr)
+				continue;
 
-				if (curClass->isSubClassOf(inspectorClass))
-				{
-					bool isValidInspectorType = referencedClass->isSubClassOf(ScriptResource::getMetaData()->scriptClass) ||
-						referencedClass->isSubClassOf(ScriptComponent::getMetaData()->scriptClass);
+			if (curClass->isSubClassOf(inspectorClass))
+			{
+				bool isValidInspectorType = referencedClass->isSubClassOf(ScriptResource::getMetaData()->scriptClass) ||
+					referencedClass->isSubClassOf(ScriptComponent::getMetaData()->scriptClass);
 
-					if (!isValidInspectorType)
-						continue;
+				if (!isValidInspectorType)
+					continue;
 
-					mInspectorTypes[referencedClass] = curClass;
-				}
-				else if (curClass->isSubClassOf(inspectableFieldClass) || curClass->isSubClassOf(systemAttributeClass))
-				{
-					mInspectableFieldTypes[referencedClass] = curClass;
-				}
+				mInspectorTypes[referencedClass] = curClass;
+			}
+			else if (curClass->isSubClassOf(inspectableFieldClass) || curClass->isSubClassOf(systemAttributeClass))
+			{
+				mInspectableFieldTypes[referencedClass] = curClass;
 			}
 		}
 	}
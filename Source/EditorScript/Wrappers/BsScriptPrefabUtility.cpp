@@ -11,6 +11,7 @@
 #include "BsMonoUtil.h"
 #include "BsScriptGameObjectManager.h"
 #include "Wrappers/BsScriptPrefab.h"
+#include "Scene/BsPrefabInstanceIndex.h"
 
 namespace bs
 {
@@ -28,6 +29,8 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_GetPrefabUUID", (void*)&ScriptPrefabUtility::internal_GetPrefabUUID);
 		metaData.scriptClass->addInternalCall("Internal_UpdateFromPrefab", (void*)&ScriptPrefabUtility::internal_UpdateFromPrefab);
 		metaData.scriptClass->addInternalCall("Internal_RecordPrefabDiff", (void*)&ScriptPrefabUtility::internal_RecordPrefabDiff);
+		metaData.scriptClass->addInternalCall("Internal_RecordPrefabInstanceDiffs", (void*)&ScriptPrefabUtility::internal_RecordPrefabInstanceDiffs);
+		metaData.scriptClass->addInternalCall("Internal_UpdatePrefabInstances", (void*)&ScriptPrefabUtility::internal_UpdatePrefabInstances);
 	}
 
 	void ScriptPrefabUtility::internal_breakPrefab(ScriptSceneObject* soPtr)
@@ -51,7 +54,11 @@ namespace bs
 		if (ScriptSceneObject::checkIfDestroyed(soPtr))
 			return;
 
-		PrefabUtility::revertToPrefab(soPtr->getHandle());
+		HSceneObject so = soPtr->getHandle();
+		PrefabUtility::revertToPrefab(so);
+
+		// Reverting re-creates the hierarchy, including any nested instances
+		PrefabInstanceIndex::instance().registerInstance(so);
 	}
 
 	bool ScriptPrefabUtility::internal_hasPrefabLink(ScriptSceneObject* soPtr)
@@ -99,7 +106,10 @@ namespace bs
 		HSceneObject prefabParent = so->getPrefabParent();
 
 		if(prefabParent != nullptr)
+		{
 			PrefabUtility::updateFromPrefab(prefabParent);
+			PrefabInstanceIndex::instance().registerInstance(prefabParent);
+		}
 	}
 
 	void ScriptPrefabUtility::internal_RecordPrefabDiff(ScriptSceneObject* soPtr)
@@ -110,4 +120,18 @@ namespace bs
 		HSceneObject so = soPtr->getHandle();
 		PrefabUtility::recordPrefabDiff(so);
 	}
+
+	void ScriptPrefabUtility::internal_RecordPrefabInstanceDiffs(ScriptPrefab* prefabPtr, ScriptSceneObject* excludePtr)
+	{
+		HSceneObject exclude;
+		if (excludePtr != nullptr && !ScriptSceneObject::checkIfDestroyed(excludePtr))
+			exclude = excludePtr->getHandle();
+
+		PrefabInstanceIndex::instance().recordInstanceDiffs(prefabPtr->getHandle(), exclude);
+	}
+
+	void ScriptPrefabUtility::internal_UpdatePrefabInstances(ScriptPrefab* prefabPtr)
+	{
+		PrefabInstanceIndex::instance().updateInstances(prefabPtr->getHandle());
+	}
 }
\ No newline at end of file
@@ -31,6 +31,8 @@ namespace bs
 		static void internal_GetPrefabUUID(ScriptSceneObject* soPtr, UUID* uuid);
 		static void internal_UpdateFromPrefab(ScriptSceneObject* soPtr);
 		static void internal_RecordPrefabDiff(ScriptSceneObject* soPtr);
+		static void internal_RecordPrefabInstanceDiffs(ScriptPrefab* prefabPtr, ScriptSceneObject* excludePtr);
+		static void internal_UpdatePrefabInstances(ScriptPrefab* prefabPtr);
 	};
 
 	/** @} */
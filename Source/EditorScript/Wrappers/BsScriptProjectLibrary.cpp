@@ -14,6 +14,7 @@
 #include "Serialization/BsManagedSerializableObject.h"
 #include "Reflection/BsRTTIType.h"
 #include "BsManagedResourceMetaData.h"
+#include "String/BsUnicode.h"
 
 #include "Generated/BsScriptProjectResourceIcons.generated.h"
 #include "Generated/BsScriptImportOptions.editor.generated.h"
@@ -51,6 +52,10 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_GetPath", (void*)&ScriptProjectLibrary::internal_GetPath);
 		metaData.scriptClass->addInternalCall("Internal_GetPathFromUUID", (void*)&ScriptProjectLibrary::internal_GetPathFromUUID);
 		metaData.scriptClass->addInternalCall("Internal_Search", (void*)&ScriptProjectLibrary::internal_Search);
+		metaData.scriptClass->addInternalCall("Internal_Query", (void*)&ScriptProjectLibrary::internal_Query);
+		metaData.scriptClass->addInternalCall("Internal_QueryChildren", (void*)&ScriptProjectLibrary::internal_QueryChildren);
+		metaData.scriptClass->addInternalCall("Internal_FindReferences", (void*)&ScriptProjectLibrary::internal_FindReferences);
+		metaData.scriptClass->addInternalCall("Internal_IsReferenced", (void*)&ScriptProjectLibrary::internal_IsReferenced);
 		metaData.scriptClass->addInternalCall("Internal_Delete", (void*)&ScriptProjectLibrary::internal_Delete);
 		metaData.scriptClass->addInternalCall("Internal_CreateFolder", (void*)&ScriptProjectLibrary::internal_CreateFolder);
 		metaData.scriptClass->addInternalCall("Internal_Rename", (void*)&ScriptProjectLibrary::internal_Rename);
@@ -242,6 +247,70 @@ namespace bs
 		return outArray.getInternal();
 	}
 
+	MonoObject* ScriptProjectLibrary::internal_Query(MonoString* pattern, MonoArray* types)
+	{
+		String strPattern = MonoUtil::monoToString(pattern);
+
+		Vector<UINT32> typeIds;
+		if (types != nullptr)
+		{
+			ScriptArray typeArray(types);
+			for (UINT32 i = 0; i < typeArray.size(); i++)
+			{
+				BuiltinResourceInfo* resInfo = ScriptAssemblyManager::instance().getBuiltinResourceInfo((ScriptResourceType)typeArray.get<UINT32>(i));
+				if (resInfo == nullptr)
+					continue;
+
+				typeIds.push_back(resInfo->typeId);
+			}
+		}
+
+		return ScriptLibraryQuery::create(gProjectLibrary().search(strPattern, typeIds));
+	}
+
+	MonoObject* ScriptProjectLibrary::internal_QueryChildren(MonoString* path)
+	{
+		Path assetPath = MonoUtil::monoToString(path);
+
+		USPtr<ProjectLibrary::LibraryEntry> entry = gProjectLibrary().findEntry(assetPath);
+		if (entry == nullptr || entry->type != ProjectLibrary::LibraryEntryType::Directory)
+			return nullptr;
+
+		auto* dirEntry = static_cast<ProjectLibrary::DirectoryEntry*>(entry.get());
+		return ScriptLibraryQuery::create(dirEntry->mChildren);
+	}
+
+	MonoArray* ScriptProjectLibrary::internal_FindReferences(MonoString* path)
+	{
+		Path assetPath = MonoUtil::monoToString(path);
+
+		Vector<USPtr<ProjectLibrary::LibraryEntry>> foundEntries = gProjectLibrary().findReferencingEntries(assetPath);
+
+		UINT32 idx = 0;
+		ScriptArray outArray = ScriptArray::create<ScriptLibraryEntry>((UINT32)foundEntries.size());
+		for (auto& entry : foundEntries)
+		{
+			MonoObject* managedEntry = nullptr;
+
+			if (entry->type == ProjectLibrary::LibraryEntryType::File)
+				managedEntry = ScriptFileEntry::create(static_pointer_cast<ProjectLibrary::FileEntry>(entry));
+			else
+				managedEntry = ScriptDirectoryEntry::create(static_pointer_cast<ProjectLibrary::DirectoryEntry>(entry));
+
+			outArray.set(idx, managedEntry);
+			idx++;
+		}
+
+		return outArray.getInternal();
+	}
+
+	bool ScriptProjectLibrary::internal_IsReferenced(MonoString* path)
+	{
+		Path assetPath = MonoUtil::monoToString(path);
+
+		return gProjectLibrary().isReferenced(assetPath);
+	}
+
 	void ScriptProjectLibrary::internal_Delete(MonoString* path)
 	{
 		Path pathToDelete = MonoUtil::monoToString(path);
@@ -512,6 +581,124 @@ namespace bs
 		return false;
 	}
 
+	ScriptLibraryQuery::ScriptLibraryQuery(MonoObject* instance, Vector<USPtr<ProjectLibrary::LibraryEntry>> entries)
+		:ScriptObject(instance), mEntries(std::move(entries))
+	{ }
+
+	MonoObject* ScriptLibraryQuery::create(Vector<USPtr<ProjectLibrary::LibraryEntry>> entries)
+	{
+		std::sort(entries.begin(), entries.end(), 
+			[](const USPtr<ProjectLibrary::LibraryEntry>& a, const USPtr<ProjectLibrary::LibraryEntry>& b)
+		{
+			if (a->type == b->type)
+			{
+				return std::lexicographical_compare(a->elementName.begin(), a->elementName.end(), 
+					b->elementName.begin(), b->elementName.end(), 
+					[](char x, char y) { return tolower((unsigned char)x) < tolower((unsigned char)y); });
+			}
+
+			return a->type == ProjectLibrary::LibraryEntryType::Directory;
+		});
+
+		MonoObject* managedInstance = metaData.scriptClass->createInstance();
+		bs_new<ScriptLibraryQuery>(managedInstance, std::move(entries));
+
+		return managedInstance;
+	}
+
+	void ScriptLibraryQuery::initRuntimeData()
+	{
+		metaData.scriptClass->addInternalCall("Internal_GetCount", (void*)&ScriptLibraryQuery::internal_GetCount);
+		metaData.scriptClass->addInternalCall("Internal_GetEntry", (void*)&ScriptLibraryQuery::internal_GetEntry);
+		metaData.scriptClass->addInternalCall("Internal_ReadPage", (void*)&ScriptLibraryQuery::internal_ReadPage);
+	}
+
+	UINT32 ScriptLibraryQuery::internal_GetCount(ScriptLibraryQuery* thisPtr)
+	{
+		return (UINT32)thisPtr->mEntries.size();
+	}
+
+	MonoObject* ScriptLibraryQuery::internal_GetEntry(ScriptLibraryQuery* thisPtr, UINT32 index)
+	{
+		if (index >= (UINT32)thisPtr->mEntries.size())
+			return nullptr;
+
+		const USPtr<ProjectLibrary::LibraryEntry>& entry = thisPtr->mEntries[index];
+		if (entry->type == ProjectLibrary::LibraryEntryType::File)
+			return ScriptFileEntry::create(static_pointer_cast<ProjectLibrary::FileEntry>(entry));
+		else
+			return ScriptDirectoryEntry::create(static_pointer_cast<ProjectLibrary::DirectoryEntry>(entry));
+	}
+
+	MonoString* ScriptLibraryQuery::internal_ReadPage(ScriptLibraryQuery* thisPtr, UINT32 start, UINT32 count, 
+		MonoArray* uuids, MonoArray* entryTypes, MonoArray* resourceTypes, MonoArray* resourceCounts, 
+		MonoArray* pathOffsets, MonoArray* nameOffsets)
+	{
+		const UINT32 numEntries = (UINT32)thisPtr->mEntries.size();
+		start = std::min(start, numEntries);
+		count = std::min(count, numEntries - start);
+
+		ScriptArray uuidArray(uuids);
+		ScriptArray entryTypeArray(entryTypes);
+		ScriptArray resourceTypeArray(resourceTypes);
+		ScriptArray resourceCountArray(resourceCounts);
+		ScriptArray pathOffsetArray(pathOffsets);
+		ScriptArray nameOffsetArray(nameOffsets);
+
+		// Managed strings are UTF-16, so offsets into the blob are counted in UTF-16 code units
+		const Path& resourcesFolder = gProjectLibrary().getResourcesFolder();
+		String blob;
+		UINT32 offset = 0;
+		for (UINT32 i = 0; i < count; i++)
+		{
+			const USPtr<ProjectLibrary::LibraryEntry>& entry = thisPtr->mEntries[start + i];
+
+			UUID uuid = UUID::EMPTY;
+			ScriptResourceType resourceType = ScriptResourceType::Undefined;
+			UINT32 resourceCount = 0;
+
+			if (entry->type == ProjectLibrary::LibraryEntryType::File)
+			{
+				auto* fileEntry = static_cast<ProjectLibrary::FileEntry*>(entry.get());
+				if (fileEntry->meta != nullptr)
+				{
+					auto& resourceMetas = fileEntry->meta->getResourceMetaData();
+					resourceCount = (UINT32)resourceMetas.size();
+
+					if (!resourceMetas.empty())
+					{
+						uuid = resourceMetas[0]->getUUID();
+
+						BuiltinResourceInfo* resInfo = 
+							ScriptAssemblyManager::instance().getBuiltinResourceInfo(resourceMetas[0]->getTypeID());
+						if (resInfo != nullptr)
+							resourceType = resInfo->resType;
+					}
+				}
+			}
+
+			Path relativePath = entry->path;
+			relativePath.makeRelative(resourcesFolder);
+			String path = relativePath.toString();
+
+			uuidArray.set(i, uuid);
+			entryTypeArray.set(i, (UINT32)entry->type);
+			resourceTypeArray.set(i, (UINT32)resourceType);
+			resourceCountArray.set(i, resourceCount);
+
+			pathOffsetArray.set(i, offset);
+			blob += path;
+			offset += (UINT32)UTF8::toUTF16(path).size();
+
+			nameOffsetArray.set(i, offset);
+			blob += entry->elementName;
+			offset += (UINT32)UTF8::toUTF16(entry->elementName).size();
+		}
+
+		pathOffsetArray.set(count, offset);
+		return MonoUtil::stringToMono(blob);
+	}
+
 	ScriptResourceMeta::ScriptResourceMeta(MonoObject* instance, const SPtr<ProjectResourceMeta>& meta)
 		:ScriptObject(instance), mMeta(meta)
 	{ }
@@ -79,6 +79,10 @@ namespace bs
 		static MonoString* internal_GetPathFromUUID(UUID* uuid);
 		static MonoString* internal_GetPath(MonoObject* resource);
 		static MonoArray* internal_Search(MonoString* pattern, MonoArray* types);
+		static MonoObject* internal_Query(MonoString* pattern, MonoArray* types);
+		static MonoObject* internal_QueryChildren(MonoString* path);
+		static MonoArray* internal_FindReferences(MonoString* path);
+		static bool internal_IsReferenced(MonoString* path);
 		static void internal_Delete(MonoString* path);
 		static void internal_CreateFolder(MonoString* path);
 		static void internal_Rename(MonoString* path, MonoString* name, bool overwrite);
@@ -160,6 +164,36 @@ namespace bs
 		static bool internal_GetIncludeInBuild(ScriptFileEntry* thisPtr);
 	};
 
+	/**
+	 * Interop class between C++ & CLR for LibraryQuery. Holds a snapshot of the entries matched by a project library query,
+	 * and provides them to managed code in pages of compact data, without creating a managed object per entry.
+	 */
+	class BS_SCR_BED_EXPORT ScriptLibraryQuery : public ScriptObject <ScriptLibraryQuery>
+	{
+	public:
+		SCRIPT_OBJ(EDITOR_ASSEMBLY, EDITOR_NS, "LibraryQuery")
+
+		ScriptLibraryQuery(MonoObject* instance, Vector<USPtr<ProjectLibrary::LibraryEntry>> entries);
+
+		/**
+		 * Creates a new interop object that holds the provided query results. Entries are sorted so that directories come
+		 * first, followed by files, each ordered by name.
+		 */
+		static MonoObject* create(Vector<USPtr<ProjectLibrary::LibraryEntry>> entries);
+
+	private:
+		Vector<USPtr<ProjectLibrary::LibraryEntry>> mEntries;
+
+		/************************************************************************/
+		/* 								CLR HOOKS						   		*/
+		/************************************************************************/
+		static UINT32 internal_GetCount(ScriptLibraryQuery* thisPtr);
+		static MonoObject* internal_GetEntry(ScriptLibraryQuery* thisPtr, UINT32 index);
+		static MonoString* internal_ReadPage(ScriptLibraryQuery* thisPtr, UINT32 start, UINT32 count, MonoArray* uuids,
+			MonoArray* entryTypes, MonoArray* resourceTypes, MonoArray* resourceCounts, MonoArray* pathOffsets,
+			MonoArray* nameOffsets);
+	};
+
 	/**	Interop class between C++ & CLR for ResourceMeta. */
 	class BS_SCR_BED_EXPORT ScriptResourceMeta : public ScriptObject <ScriptResourceMeta>
 	{
@@ -33,6 +33,8 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_PickObject", (void*)&ScriptSceneSelection::internal_PickObject);
 		metaData.scriptClass->addInternalCall("Internal_PickObjects", (void*)&ScriptSceneSelection::internal_PickObjects);
 		metaData.scriptClass->addInternalCall("Internal_Snap", (void*)&ScriptSceneSelection::internal_Snap);
+		metaData.scriptClass->addInternalCall("Internal_BeginSnapSession", (void*)&ScriptSceneSelection::internal_BeginSnapSession);
+		metaData.scriptClass->addInternalCall("Internal_EndSnapSession", (void*)&ScriptSceneSelection::internal_EndSnapSession);
 		metaData.scriptClass->addInternalCall("Internal_SetGizmoDrawSettings", (void*)&ScriptSceneSelection::internal_SetGizmoDrawSettings);
 		metaData.scriptClass->addInternalCall("Internal_GetGizmoDrawSettings", (void*)&ScriptSceneSelection::internal_GetGizmoDrawSettings);
 	}
@@ -181,8 +183,25 @@ namespace bs
 			}
 		}
 
-		HSceneObject instance = ScenePicking::instance().pickClosestObject(thisPtr->mCamera, thisPtr->mGizmoDrawSettings,
-			*inputPos, Vector2I(1, 1), ignoredSceneObjects, data);
+		HSceneObject instance;
+		if (thisPtr->mSnapSessionActive)
+		{
+			// Re-capture only if the view or the set of snapped objects changed since the last query
+			ScenePicking& scenePicking = ScenePicking::instance();
+			if (thisPtr->mSnapCache == nullptr || !scenePicking.isSnapCacheValid(*thisPtr->mSnapCache, thisPtr->mCamera) ||
+				thisPtr->mSnapIgnoredObjects != ignoredSceneObjects)
+			{
+				thisPtr->mSnapCache = scenePicking.captureSnapCache(thisPtr->mCamera, ignoredSceneObjects);
+				thisPtr->mSnapIgnoredObjects = ignoredSceneObjects;
+			}
+
+			instance = scenePicking.snapCached(thisPtr->mCamera, *thisPtr->mSnapCache, *inputPos, *data);
+		}
+		else
+		{
+			instance = ScenePicking::instance().pickClosestObject(thisPtr->mCamera, thisPtr->mGizmoDrawSettings,
+				*inputPos, Vector2I(1, 1), ignoredSceneObjects, data);
+		}
 
 		if (instance == nullptr)
 			return nullptr;
@@ -191,6 +210,18 @@ namespace bs
 		return scriptSO->getManagedInstance();
 	}
 
+	void ScriptSceneSelection::internal_BeginSnapSession(ScriptSceneSelection* thisPtr)
+	{
+		thisPtr->mSnapSessionActive = true;
+	}
+
+	void ScriptSceneSelection::internal_EndSnapSession(ScriptSceneSelection* thisPtr)
+	{
+		thisPtr->mSnapSessionActive = false;
+		thisPtr->mSnapCache = nullptr;
+		thisPtr->mSnapIgnoredObjects.clear();
+	}
+
 	void ScriptSceneSelection::internal_GetGizmoDrawSettings(ScriptSceneSelection* thisPtr, GizmoDrawSettings* settings)
 	{
 		*settings = thisPtr->mGizmoDrawSettings;
@@ -29,6 +29,10 @@ namespace bs
 		SelectionRenderer* mSelectionRenderer = nullptr;
 		GizmoDrawSettings mGizmoDrawSettings;
 
+		bool mSnapSessionActive = false;
+		SPtr<SnapCache> mSnapCache;
+		Vector<HSceneObject> mSnapIgnoredObjects;
+
 		/************************************************************************/
 		/* 								CLR HOOKS						   		*/
 		/************************************************************************/
@@ -37,6 +41,8 @@ namespace bs
 		static void internal_PickObject(ScriptSceneSelection* thisPtr, Vector2I* inputPos, bool additive, MonoArray* ignoreRenderables);
 		static void internal_PickObjects(ScriptSceneSelection* thisPtr, Vector2I* inputPos, Vector2I* area, bool additive, MonoArray* ignoreRenderables);
 		static MonoObject* internal_Snap(ScriptSceneSelection* thisPtr, Vector2I* inputPos, SnapData* data, MonoArray* ignoreRenderables);
+		static void internal_BeginSnapSession(ScriptSceneSelection* thisPtr);
+		static void internal_EndSnapSession(ScriptSceneSelection* thisPtr);
 		static void internal_SetGizmoDrawSettings(ScriptSceneSelection* thisPtr, GizmoDrawSettings* gizmoDrawSettings);
 		static void internal_GetGizmoDrawSettings(ScriptSceneSelection* thisPtr, GizmoDrawSettings* gizmoDrawSettings);
 	};
@@ -37,8 +37,12 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_PushGroup", (void*)&ScriptUndoRedo::internal_PushGroup);
 		metaData.scriptClass->addInternalCall("Internal_PopGroup", (void*)&ScriptUndoRedo::internal_PopGroup);
 		metaData.scriptClass->addInternalCall("Internal_Clear", (void*)&ScriptUndoRedo::internal_Clear);
+		metaData.scriptClass->addInternalCall("Internal_SerializeDeletedObjects", (void*)&ScriptUndoRedo::internal_SerializeDeletedObjects);
 		metaData.scriptClass->addInternalCall("Internal_GetTopCommandId", (void*)&ScriptUndoRedo::internal_GetTopCommandId);
 		metaData.scriptClass->addInternalCall("Internal_PopCommand", (void*)&ScriptUndoRedo::internal_PopCommand);
+		metaData.scriptClass->addInternalCall("Internal_BeginMergeGroup", (void*)&ScriptUndoRedo::internal_BeginMergeGroup);
+		metaData.scriptClass->addInternalCall("Internal_EndMergeGroup", (void*)&ScriptUndoRedo::internal_EndMergeGroup);
+		metaData.scriptClass->addInternalCall("Internal_IsMergeGroupActive", (void*)&ScriptUndoRedo::internal_IsMergeGroupActive);
 		metaData.scriptClass->addInternalCall("Internal_CloneSO", (void*)&ScriptUndoRedo::internal_CloneSO);
 		metaData.scriptClass->addInternalCall("Internal_CloneSOMulti", (void*)&ScriptUndoRedo::internal_CloneSOMulti);
 		metaData.scriptClass->addInternalCall("Internal_Instantiate", (void*)&ScriptUndoRedo::internal_Instantiate);
@@ -136,6 +140,12 @@ namespace bs
 		return undoRedo->clear();
 	}
 
+	void ScriptUndoRedo::internal_SerializeDeletedObjects(ScriptUndoRedo* thisPtr)
+	{
+		UndoRedo* undoRedo = thisPtr->mUndoRedo != nullptr ? thisPtr->mUndoRedo.get() : UndoRedo::instancePtr();
+		undoRedo->serializeDeletedObjects();
+	}
+
 	UINT32 ScriptUndoRedo::internal_GetTopCommandId(ScriptUndoRedo* thisPtr)
 	{
 		UndoRedo* undoRedo = thisPtr->mUndoRedo != nullptr ? thisPtr->mUndoRedo.get() : UndoRedo::instancePtr();
@@ -148,6 +158,24 @@ namespace bs
 		undoRedo->popCommand(id);
 	}
 
+	UINT32 ScriptUndoRedo::internal_BeginMergeGroup(ScriptUndoRedo* thisPtr)
+	{
+		UndoRedo* undoRedo = thisPtr->mUndoRedo != nullptr ? thisPtr->mUndoRedo.get() : UndoRedo::instancePtr();
+		return undoRedo->beginMergeGroup();
+	}
+
+	void ScriptUndoRedo::internal_EndMergeGroup(ScriptUndoRedo* thisPtr, UINT32 id)
+	{
+		UndoRedo* undoRedo = thisPtr->mUndoRedo != nullptr ? thisPtr->mUndoRedo.get() : UndoRedo::instancePtr();
+		undoRedo->endMergeGroup(id);
+	}
+
+	bool ScriptUndoRedo::internal_IsMergeGroupActive(ScriptUndoRedo* thisPtr)
+	{
+		UndoRedo* undoRedo = thisPtr->mUndoRedo != nullptr ? thisPtr->mUndoRedo.get() : UndoRedo::instancePtr();
+		return undoRedo->isMergeGroupActive();
+	}
+
 	MonoObject* ScriptUndoRedo::internal_CloneSO(ScriptSceneObject* soPtr, MonoString* description)
 	{
 		String nativeDescription = MonoUtil::monoToString(description);
@@ -265,12 +293,17 @@ namespace bs
 		String nativeDescription = MonoUtil::monoToString(description);
 
 		ScriptArray input(soPtrs);
+		Vector<HSceneObject> sceneObjects;
+		sceneObjects.reserve(input.size());
+
 		for (UINT32 i = 0; i < input.size(); i++)
 		{
 			ScriptSceneObject* soPtr = input.get<ScriptSceneObject*>(i);
-			HSceneObject so = soPtr->getHandle();
-			CmdReparentSO::execute(so, parent, nativeDescription);
+			if (soPtr != nullptr)
+				sceneObjects.push_back(soPtr->getHandle());
 		}
+
+		CmdReparentSO::execute(sceneObjects, parent, nativeDescription);
 	}
 
 	void ScriptUndoRedo::internal_BreakPrefab(ScriptSceneObject* soPtr, MonoString* description)
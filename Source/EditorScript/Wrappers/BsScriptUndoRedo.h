@@ -47,8 +47,12 @@ namespace bs
 		static void internal_PushGroup(ScriptUndoRedo* thisPtr, MonoString* name);
 		static void internal_PopGroup(ScriptUndoRedo* thisPtr, MonoString* name);
 		static void internal_Clear(ScriptUndoRedo* thisPtr);
+		static void internal_SerializeDeletedObjects(ScriptUndoRedo* thisPtr);
 		static UINT32 internal_GetTopCommandId(ScriptUndoRedo* thisPtr);
 		static void internal_PopCommand(ScriptUndoRedo* thisPtr, UINT32 id);
+		static UINT32 internal_BeginMergeGroup(ScriptUndoRedo* thisPtr);
+		static void internal_EndMergeGroup(ScriptUndoRedo* thisPtr, UINT32 id);
+		static bool internal_IsMergeGroupActive(ScriptUndoRedo* thisPtr);
 		static MonoObject* internal_CloneSO(ScriptSceneObject* soPtr, MonoString* description);
 		static MonoArray* internal_CloneSOMulti(MonoArray* soPtrs, MonoString* description);
 		static MonoObject* internal_Instantiate(ScriptPrefab* prefabPtr, MonoString* description);
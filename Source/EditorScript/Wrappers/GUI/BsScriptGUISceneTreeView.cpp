@@ -46,6 +46,8 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_RenameSelection", (void*)&ScriptGUISceneTreeView::internal_renameSelection);
 		metaData.scriptClass->addInternalCall("Internal_GetState", (void*)&ScriptGUISceneTreeView::internal_getState);
 		metaData.scriptClass->addInternalCall("Internal_SetState", (void*)&ScriptGUISceneTreeView::internal_setState);
+		metaData.scriptClass->addInternalCall("Internal_GetFilter", (void*)&ScriptGUISceneTreeView::internal_getFilter);
+		metaData.scriptClass->addInternalCall("Internal_SetFilter", (void*)&ScriptGUISceneTreeView::internal_setFilter);
 
 		onModifiedThunk = (OnModifiedThunkDef)metaData.scriptClass->getMethod("Internal_DoOnModified", 0)->getThunk();
 		onResourceDroppedThunk = (OnResourceDroppedThunkDef)metaData.scriptClass->getMethod("Internal_DoOnResourceDropped", 2)->getThunk();
@@ -156,4 +158,16 @@ namespace bs
 			treeView->setState(state);
 		}
 	}
+
+	MonoString* ScriptGUISceneTreeView::internal_getFilter(ScriptGUISceneTreeView* thisPtr)
+	{
+		GUISceneTreeView* treeView = static_cast<GUISceneTreeView*>(thisPtr->getGUIElement());
+		return MonoUtil::stringToMono(treeView->getFilter());
+	}
+
+	void ScriptGUISceneTreeView::internal_setFilter(ScriptGUISceneTreeView* thisPtr, MonoString* filter)
+	{
+		GUISceneTreeView* treeView = static_cast<GUISceneTreeView*>(thisPtr->getGUIElement());
+		treeView->setFilter(MonoUtil::monoToString(filter));
+	}
 }
\ No newline at end of file
@@ -43,6 +43,8 @@ namespace bs
 		static void internal_renameSelection(ScriptGUISceneTreeView* thisPtr);
 		static MonoObject* internal_getState(ScriptGUISceneTreeView* thisPtr);
 		static void internal_setState(ScriptGUISceneTreeView* thisPtr, MonoObject* obj);
+		static MonoString* internal_getFilter(ScriptGUISceneTreeView* thisPtr);
+		static void internal_setFilter(ScriptGUISceneTreeView* thisPtr, MonoString* filter);
 
 		typedef void(BS_THUNKCALL *OnModifiedThunkDef) (MonoObject*, MonoException**);
 		typedef void(BS_THUNKCALL *OnResourceDroppedThunkDef) (MonoObject*, MonoObject*, MonoArray*, MonoException**);